@@ -2,14 +2,33 @@
 
 // project
 #include "ltb/app/app.hpp"
+#include "ltb/dsp/am_detector.hpp"
+#include "ltb/dsp/fft.hpp"
+#include "ltb/gui/cam/orbit_camera.hpp"
+#include "ltb/gui/incremental_id_generator.hpp"
+#include "ltb/gui/line_lod.hpp"
+#include "ltb/gui/mesh_display_pipeline.hpp"
+#include "ltb/ils/course_analysis.hpp"
+#include "ltb/ils/field_evaluator.hpp"
+#include "ltb/ils/field_export.hpp"
+#include "ltb/ils/flight_receiver.hpp"
+#include "ltb/ils/volume.hpp"
+#include "ltb/ils/waveform_synthesizer.hpp"
 #include "ltb/ogl/framebuffer.hpp"
+#include "ltb/ogl/framebuffer_chain.hpp"
 #include "ltb/utils/initializable.hpp"
 
 // generated
 #include "ltb/ltb_config.hpp"
 
+// external
+#include <implot.h>
+
 // standard
+#include <array>
 #include <chrono>
+#include <memory>
+#include <optional>
 
 namespace ltb::app
 {
@@ -29,7 +48,8 @@ public:
     auto resize( glm::ivec2 framebuffer_size ) -> void override;
 
 private:
-    glm::ivec2 framebuffer_size_ = { };
+    glm::ivec2                       framebuffer_size_ = { };
+    std::shared_ptr< ImPlotContext > implot_context_   = nullptr;
 
     ogl::Shader< GL_VERTEX_SHADER > fullscreen_vertex_shader_ = {
         config::shader_dir_path( ) / "fullscreen.vert",
@@ -45,6 +65,11 @@ private:
     ogl::Uniform< glm::vec3 > output_scale_uniform_      = { program_, "output_scale" };
     ogl::Uniform< float32 >   time_s_uniform_            = { program_, "time_s" };
     ogl::Uniform< glm::vec2 > field_size_pixels_uniform_ = { program_, "field_size_pixels" };
+    ogl::Uniform< int32 >     summation_uniform_         = { program_, "summation" };
+    ogl::Uniform< glm::vec4 > excitations_uniform_       = { program_, "element_excitations" };
+    ogl::Uniform< float32 >   frag_coord_scale_uniform_  = { program_, "frag_coord_scale" };
+    ogl::Uniform< float32 >   antenna_height_m_uniform_  = { program_, "antenna_height_m" };
+    ogl::Uniform< float32 >   receiver_height_m_uniform_ = { program_, "receiver_height_m" };
 
     ogl::VertexArray vertex_array_ = { };
 
@@ -57,13 +82,141 @@ private:
     glm::vec3 output_channels_   = { 1.0F, 1.0F, 1.0F };
     float32   output_scale_      = 0.1F;
 
+    ils::Summation                        summation_   = ils::Summation::Pairwise;
+    std::vector< ils::ElementExcitation > excitations_ = ils::default_excitations( 1 );
+
+    // Multipath. Reflections are only evaluated on the CPU, so any reflector
+    // switches the field display over to progressive CPU rendering.
+    struct Wall
+    {
+        glm::vec2 start_m     = { 300.0F, 150.0F };
+        glm::vec2 end_m       = { 100.0F, 150.0F };
+        float32   height_m    = 20.0F;
+        glm::vec2 coefficient = { -0.5F, 0.0F };
+    };
+
+    float32             antenna_height_m_   = 3.0F;
+    float32             receiver_height_m_  = 3.0F;
+    bool                ground_reflection_  = false;
+    glm::vec2           ground_coefficient_ = { -1.0F, 0.0F };
+    std::vector< Wall > walls_              = { };
+
     enum class Display
     {
         CSB,
         SBO,
-        Both
+        Both,
+        DDM,
     };
     Display display_ = Display::Both;
+
+    // Progressive rendering. A coarse preview is drawn while the parameters change, then
+    // the full resolution field is accumulated a band of rows per frame. Once every row
+    // is done, frames only copy the accumulated field to the screen.
+    static constexpr auto coarse_index_       = 0_UZ;
+    static constexpr auto accumulation_index_ = 1_UZ;
+
+    ogl::FramebufferChain< 2 > field_chain_ = { };
+    // Never initialized, so binding it binds the default framebuffer.
+    ogl::Framebuffer default_framebuffer_ = { };
+
+    bool                              progressive_rendering_ = true;
+    int32                             refine_frames_         = 4;
+    std::optional< ils::FieldParams > accumulated_params_    = std::nullopt;
+    int32                             refined_rows_          = 0;
+
+    // CPU evaluation of the same field, used to validate the shader output.
+    ils::FieldEvaluator      cpu_field_evaluator_      = { };
+    bool                     validate_cpu_field_       = false;
+    std::optional< float32 > cpu_field_max_difference_ = std::nullopt;
+
+    ils::WaveformParams      transmitted_wave_params_ = { };
+    ils::WaveformSynthesizer transmitted_waves_       = { };
+
+    std::array< gui::LineLod< float32 >, 9 > transmitted_wave_lods_ = { };
+
+    // The spectrum of one transmitted wave, at the synthesizer's sample rate.
+    std::size_t                              spectrum_wave_          = 5;
+    dsp::SpectrumAnalyzer                    spectrum_analyzer_      = dsp::SpectrumAnalyzer{ { } };
+    std::vector< float32 >                   wave_spectrum_db_       = { };
+    std::vector< dsp::FftThroughput >        fft_throughput_         = { };
+    std::vector< dsp::AmDetectorThroughput > am_detector_throughput_ = { };
+
+    // Course structure measured on an arc around the array.
+    float32                            course_range_m_  = 1'000.0F;
+    bool                               course_analyzed_ = false;
+    std::optional< ils::CourseReport > course_report_   = std::nullopt;
+
+    // A straight-in approach flown through the field by the streaming receiver.
+    float32                  flight_start_range_m_    = 10'000.0F;
+    float32                  flight_start_offset_m_   = 200.0F;
+    float32                  flight_ground_speed_m_s_ = 70.0F;
+    float32                  flight_noise_sigma_      = 0.0F;
+    std::vector< float32 >   flight_ddm_              = { };
+    std::vector< float32 >   flight_envelope_         = { };
+    gui::LineLod< float32 >  flight_ddm_lod_          = { };
+    gui::LineLod< float32 >  flight_envelope_lod_     = { };
+    std::optional< float64 > flight_samples_per_s_    = std::nullopt;
+
+    // The localizer and glide slope evaluated in 3D, shown in place of the field as a
+    // point cloud of the approach funnel and slices through it.
+    gui::IncrementalIdGenerator< uint32 > id_generator_          = { };
+    gui::MeshDisplayPipeline              mesh_pipeline_         = { id_generator_ };
+    gui::cam::CameraInputSettings         camera_input_settings_ = { };
+    gui::cam::OrbitCamera                 camera_                = { };
+
+    bool                                 show_volume_           = false;
+    ils::GlideSlopeParams                glide_slope_params_    = { };
+    ils::VoxelGrid                       volume_grid_           = { };
+    float32                              horizontal_slice_m_    = 150.0F;
+    ils::CoverageRequirements            coverage_requirements_ = { };
+    std::vector< gui::MeshId >           volume_mesh_ids_       = { };
+    std::optional< ils::CoverageReport > coverage_report_       = std::nullopt;
+    std::optional< float64 >             volume_seconds_        = std::nullopt;
+
+    // The CPU field streamed to a tiled file at a resolution independent of the window.
+    glm::ivec2               export_size_pixels_ = { 16'384, 16'384 };
+    std::optional< float64 > export_seconds_     = std::nullopt;
+
+    [[nodiscard( "Const getter" )]]
+    auto field_params( ) const -> ils::FieldParams;
+
+    auto draw_field( float32 frag_coord_scale ) -> void;
+    auto render_progressive( ) -> void;
+
+    /// \brief Evaluate \p region of a field of \p field_size pixels on the CPU, each
+    ///        \p pixel_scale field pixels wide, and copy the colors into \p texture.
+    auto draw_cpu_field(
+        ogl::Texture const&   texture,
+        glm::ivec2            field_size,
+        math::Range2Di const& region,
+        float32               pixel_scale
+    ) -> utils::Result< void >;
+
+    [[nodiscard( "Const getter" )]]
+    auto cpu_rendering( ) const -> bool;
+
+    [[nodiscard( "Const getter" )]]
+    auto field_complete( ) const -> bool;
+
+    auto configure_excitations_gui( ) -> void;
+    auto configure_course_gui( ) -> void;
+    auto configure_multipath_gui( ) -> void;
+    auto configure_flight_gui( ) -> void;
+    auto configure_spectrum_gui( ) -> void;
+    auto configure_volume_gui( ) -> void;
+    auto configure_export_gui( ) -> void;
+
+    /// \brief Evaluate the volume and replace the meshes displayed in 3D.
+    auto build_volume_meshes( ) -> utils::Result< void >;
+
+    /// \brief Stream the current field to a tiled file one band of tiles at a time.
+    auto export_field( ) -> utils::Result< void >;
+
+    auto validate_cpu_field( ) -> utils::Result< void >;
+
+    /// \brief Transform the wave selected for the spectrum plot.
+    auto update_wave_spectrum( ) -> utils::Result< void >;
 };
 
 } // namespace ltb::app
@@ -1,18 +1,30 @@
 #pragma once
 
 // project
+#include "ltb/dsp/baseband.hpp"
+#include "ltb/dsp/fft.hpp"
+#include "ltb/dsp/noise.hpp"
+#include "ltb/dsp/resampler.hpp"
 #include "ltb/gui/imgui_setup.hpp"
+#include "ltb/gui/line_lod.hpp"
 #include "ltb/ogl/buffer.hpp"
 #include "ltb/ogl/framebuffer.hpp"
 #include "ltb/ogl/opengl_loader.hpp"
 #include "ltb/ogl/program.hpp"
 #include "ltb/ogl/shader.hpp"
 #include "ltb/ogl/vertex_array.hpp"
+#include "ltb/vor/bearing_sweep.hpp"
+#include "ltb/vor/scope.hpp"
+#include "ltb/vor/signal_chain.hpp"
 #include "ltb/window/window.hpp"
 
 // external
 #include <implot.h>
 
+// standard
+#include <chrono>
+#include <optional>
+
 namespace ltb::app
 {
 
@@ -33,17 +45,87 @@ private:
 
     ogl::OpenglLoader ogl_loader_ = { };
 
-    std::vector< float64 > time_ms_x_values_ = { };
+    int32 point_count_ = 50'000;
+
+    // The composite as complex baseband, with its I and Q parts and the passband
+    // upconverted to a slow display carrier plotted separately.
+    float64 carrier_offset_hz_   = 0.0;
+    float64 display_carrier_khz_ = 40.0;
+
+    std::vector< dsp::Iq > baseband_values_   = { };
+    std::vector< float32 > baseband_i_values_ = { };
+    std::vector< float32 > baseband_q_values_ = { };
+    std::vector< float32 > passband_values_   = { };
+
+    // Only the envelope visible at the current zoom is handed to ImPlot each frame.
+    gui::LineLod< float32 > baseband_i_lod_ = { };
+    gui::LineLod< float32 > baseband_q_lod_ = { };
+    gui::LineLod< float32 > passband_lod_   = { };
+
+    // The spectrum of the start of the baseband, centered on the tuned frequency.
+    dsp::SpectrumAnalyzer spectrum_analyzer_ = dsp::SpectrumAnalyzer{ { .size = 4'096 } };
+
+    std::vector< float32 >                  baseband_spectrum_     = { };
+    std::vector< dsp::FftThroughput >       fft_throughput_        = { };
+    std::vector< dsp::ResamplerThroughput > decimation_throughput_ = { };
+    std::optional< dsp::NoiseThroughput >   noise_throughput_      = std::nullopt;
+
+    // Streaming modulator -> receiver chain
+    float32 receiver_bearing_deg_ = 45.0F;
+    float32 receiver_duration_s_  = 2.0F;
+
+    // Noise and interference between the modulator and the receiver
+    bool    receiver_noise_enabled_ = false;
+    float32 receiver_cnr_db_        = 30.0F;
+    bool    receiver_cw_enabled_    = false;
+    bool    receiver_fm_enabled_    = false;
+
+    std::optional< vor::ChainThroughput > receiver_throughput_ = std::nullopt;
+    float32                               measured_bearing_deg_ = 0.0F;
+
+    std::vector< float64 >  receiver_composite_values_ = { };
+    std::vector< float64 >  receiver_bearing_values_   = { };
+    gui::LineLod< float64 > receiver_composite_lod_    = { };
+    gui::LineLod< float64 > receiver_bearing_lod_      = { };
+
+    // Live scope, advancing with the wall clock
+    bool       scope_running_     = true;
+    float32    scope_window_s_    = 2.0F;
+    float32    scope_bearing_deg_ = 90.0F;
+    vor::Scope scope_             = vor::Scope{ { } };
+
+    std::optional< std::chrono::steady_clock::time_point > scope_last_frame_ = std::nullopt;
+
+    // Bearing error sweep around a conventional VOR
+    float32   siting_half_side_m_     = 0.25F;
+    bool      siting_ground_enabled_  = true;
+    bool      siting_wall_enabled_    = false;
+    float32   siting_wall_radial_rad_ = 0.0F;
+    float32   siting_wall_range_m_    = 300.0F;
+    glm::vec2 siting_wall_size_m_     = { 100.0F, 15.0F };
+    int32     siting_radial_count_    = 360;
+    int32     siting_range_count_     = 200;
+    float32   siting_max_range_m_     = 50'000.0F;
+    int32     siting_altitude_index_  = 0;
+    float64   siting_seconds_         = 0.0;
 
-    float64 carrier_frequency_mhz_       = 117.3F;
-    float64 carrier_frequency_period_ms_ = { };
+    std::optional< vor::BearingErrorTable > siting_table_     = std::nullopt;
+    std::vector< vor::ErrorSummary >        siting_summaries_ = { };
 
-    std::vector< float64 > carrier_wave_y_values_         = { };
-    std::vector< float64 > reference_audio_wave_y_values_ = { };
-    std::vector< float64 > composite_radio_wave_y_values_ = { };
+    /// \brief The error plane of the selected altitude in degrees, last radial first, the
+    ///        row order `ImPlot::PlotHeatmap` draws top to bottom.
+    std::vector< float32 > siting_heat_map_deg_ = { };
 
     auto render_gui( ) -> void;
+    auto configure_receiver_gui( ) -> void;
+    auto configure_siting_gui( ) -> void;
+    auto configure_scope_gui( ) -> void;
+    auto configure_spectrum_gui( ) -> void;
     auto update_frequencies( ) -> void;
+    auto run_receiver( ) -> utils::Result< void >;
+    auto run_sweep( ) -> utils::Result< void >;
+    auto update_heat_map( ) -> void;
+    auto advance_scope( ) -> utils::Result< void >;
 };
 
 } // namespace ltb::app
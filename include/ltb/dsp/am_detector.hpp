@@ -0,0 +1,135 @@
+#pragma once
+
+// project
+#include "ltb/dsp/baseband.hpp"
+#include "ltb/dsp/filter.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// standard
+#include <span>
+#include <vector>
+
+namespace ltb::dsp
+{
+
+struct AmDetectorParams
+{
+    float64 sample_rate_hz = 48'000.0;
+
+    /// \brief Real input only: the rectified signal is low-passed to this bandwidth, which
+    ///        must be below the carrier frequency and half the sample rate.
+    float64 envelope_bandwidth_hz = 12'000.0;
+
+    /// \brief The AGC measures the carrier level as the mean envelope over
+    ///        `sample_rate_hz / agc_window_hz` samples, a whole number of them. At 30 Hz
+    ///        every ILS and VOR tone completes whole cycles in the window and drops out.
+    float64 agc_window_hz = 30.0;
+
+    /// \brief The carrier level the AGC holds the output at.
+    float32 target_level = 1.0F;
+
+    /// \brief The most gain the AGC applies, so silence isn't amplified without bound.
+    float32 max_gain = 1.0e6F;
+
+    /// \brief Independent signals detected side by side, such as one per receiver.
+    std::size_t channel_count = 1;
+
+    auto operator==( AmDetectorParams const& ) const -> bool = default;
+};
+
+/// \brief Detects the AM envelope of many channels and holds each at a constant carrier
+///        level with an automatic gain control, one block at a time.
+///
+/// Complex baseband is detected by its magnitude. Real passband is full-wave rectified,
+/// scaled by π/2 so a steady carrier keeps its amplitude, and smoothed by a Butterworth
+/// low-pass that removes the rectified carrier.
+///
+/// The AGC sums each channel's envelope over one window. At the end of every window the
+/// gain that brings its mean to `target_level` is known, and the gain ramps there
+/// linearly over the next window, so a steady signal gets a constant gain that leaves
+/// the depth of its tones untouched, and a fading one is followed within two windows.
+/// During the first window the gain follows the mean so far.
+///
+/// Every channel of one sample is updated in a contiguous loop, as in `BiquadCascade`,
+/// and nothing is allocated after construction. State carries over between calls to
+/// `process()`.
+class AmDetector
+{
+public:
+    explicit AmDetector( AmDetectorParams params );
+
+    [[nodiscard( "Const getter" )]]
+    auto params( ) const -> AmDetectorParams const&;
+
+    /// \brief The number of samples in the AGC window.
+    [[nodiscard( "Const getter" )]]
+    auto window_size( ) const -> std::size_t;
+
+    /// \brief The number of samples of each channel processed so far.
+    [[nodiscard( "Const getter" )]]
+    auto sample_count( ) const -> std::size_t;
+
+    /// \brief The gain the AGC applies to the next sample of each channel.
+    [[nodiscard( "Const getter" )]]
+    auto gains( ) const -> std::vector< float64 > const&;
+
+    /// \brief How many samples the envelope of real input lags it by, through the
+    ///        smoothing filter. Complex input isn't delayed.
+    [[nodiscard( "Const getter" )]]
+    auto passband_delay_samples( ) const -> float64;
+
+    /// \brief Detect the next `passband.size() / channel_count` samples of every channel of
+    ///        real passband, time-major: sample `n` of channel `c` is
+    ///        `passband[ n * channel_count + c ]`. \p envelope is laid out the same.
+    auto process( std::span< float32 const > passband, std::span< float32 > envelope )
+        -> utils::Result< void >;
+
+    /// \brief Like the real `process()`, from complex baseband laid out the same way.
+    auto process( std::span< Iq const > iq, std::span< float32 > envelope )
+        -> utils::Result< void >;
+
+private:
+    AmDetectorParams params_;
+    std::size_t      window_size_  = 0;
+    std::size_t      sample_count_ = 0;
+
+    BiquadCascade smoothing_;
+
+    /// \brief Per channel, the envelope summed over the current window, the gain applied
+    ///        to the next sample and the change in gain per sample.
+    std::vector< float64 > sums_  = { };
+    std::vector< float64 > gains_ = { };
+    std::vector< float64 > steps_ = { };
+
+    auto check( std::size_t inputs, std::size_t outputs ) const -> utils::Result< void >;
+
+    /// \brief Apply the AGC to \p envelope in place.
+    auto control( std::span< float32 > envelope ) -> void;
+};
+
+struct AmDetectorThroughput
+{
+    std::size_t channel_count = 0;
+
+    /// \brief Samples of each channel per call to `process()`.
+    std::size_t block_size = 0;
+
+    /// \brief The mean time to detect one block of every channel.
+    float64 passband_block_us = 0.0;
+    float64 iq_block_us       = 0.0;
+
+    /// \brief Samples of all channels together.
+    float64 passband_mega_samples_per_s = 0.0;
+    float64 iq_mega_samples_per_s       = 0.0;
+};
+
+/// \brief Time real and complex detection of blocks of \p block_size samples for every
+///        number of channels in \p channel_counts, each for at least \p seconds_per_count.
+auto measure_am_detector_throughput(
+    std::span< std::size_t const > channel_counts,
+    std::size_t                    block_size,
+    float64                        seconds_per_count
+) -> utils::Result< std::vector< AmDetectorThroughput > >;
+
+} // namespace ltb::dsp
@@ -0,0 +1,77 @@
+#pragma once
+
+// project
+#include "ltb/dsp/oscillator.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/glm.hpp>
+
+// standard
+#include <span>
+
+namespace ltb::dsp
+{
+
+/// \brief One complex baseband sample: the in-phase part in x and the quadrature part in y.
+///
+/// A passband signal `a(t) cos(ω t + φ(t))` is represented by `a(t) e^{jφ(t)}` relative to
+/// the carrier ω, so only the modulation has to be sampled, at audio rates, however high
+/// the carrier is.
+using Iq = glm::vec2;
+
+/// \brief Shifts complex baseband by a fixed frequency, one block at a time: the carrier
+///        offset of a receiver tuned slightly away from the transmitter, for example.
+///
+/// The shift comes from a rotating phasor, so it costs a complex multiply per sample.
+/// State carries over between calls to `process()`.
+class Mixer
+{
+public:
+    Mixer( ) = default;
+
+    /// \param frequency_hz The shift, negative to shift down.
+    /// \param sample_rate_hz The rate of the baseband samples.
+    /// \param start_time_s The time of sample 0.
+    Mixer( float64 frequency_hz, float64 sample_rate_hz, float64 start_time_s = 0.0 );
+
+    /// \brief The number of samples shifted so far.
+    [[nodiscard( "Const getter" )]]
+    auto sample_count( ) const -> std::size_t;
+
+    /// \brief Shift the next `iq.size()` samples in place.
+    auto process( std::span< Iq > iq ) -> void;
+
+private:
+    Oscillator  oscillator_   = { };
+    std::size_t sample_count_ = 0;
+};
+
+/// \brief The real passband `Re{ iq(t) e^{jω t} }` of \p iq on a carrier of \p carrier_hz,
+///        for plotting only.
+///
+/// The baseband is linearly interpolated to `passband.size() / iq.size()` passband samples
+/// per baseband sample, so a slow display carrier can be drawn from audio-rate baseband.
+/// `passband.size()` must be a whole multiple of `iq.size()`.
+auto upconvert(
+    std::span< Iq const > iq,
+    float64               sample_rate_hz,
+    float64               carrier_hz,
+    std::span< float32 >  passband
+) -> utils::Result< void >;
+
+/// \brief AM detection: the magnitude of each sample, which no carrier offset changes.
+auto envelope( std::span< Iq const > iq, std::span< float32 > magnitude ) -> utils::Result< void >;
+
+/// \brief FM detection: the phase advance from each sample to the next, in Hz.
+/// \param previous The sample before `iq.front()`, updated to `iq.back()` so the next
+///        block carries on from this one.
+auto instantaneous_frequency(
+    std::span< Iq const > iq,
+    float64               sample_rate_hz,
+    Iq&                   previous,
+    std::span< float32 >  frequency_hz
+) -> utils::Result< void >;
+
+} // namespace ltb::dsp
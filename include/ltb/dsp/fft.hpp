@@ -0,0 +1,153 @@
+#pragma once
+
+// project
+#include "ltb/dsp/baseband.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// standard
+#include <array>
+#include <span>
+#include <vector>
+
+namespace ltb::dsp
+{
+
+enum class Window
+{
+    Rectangular,
+    Hann,
+    BlackmanHarris,
+};
+
+/// \brief The periodic form of \p window over \p size samples, the one suited to spectra.
+auto window_coefficients( Window window, std::size_t size ) -> std::vector< float32 >;
+
+/// \brief A forward FFT of one power-of-two size, with every twiddle factor computed once
+///        up front.
+///
+/// The transform is a Stockham autosort FFT: radix-4 stages, plus one radix-2 stage when
+/// the size is an odd power of two, ping-ponging between two structure-of-arrays buffers
+/// so no bit reversal pass is needed. Each butterfly loop runs over contiguous float32
+/// values, walking whichever of the butterfly and stride indices is longer, so the
+/// compiler vectorizes every stage.
+class Fft
+{
+public:
+    Fft( ) = default;
+
+    /// \param size A power of two, at least 2.
+    explicit Fft( std::size_t size );
+
+    [[nodiscard( "Const getter" )]]
+    auto size( ) const -> std::size_t;
+
+    /// \brief The DFT `X[k] = Σ x[n] e^(-j 2π k n / N)` of \p input. Both spans must hold
+    ///        `size()` samples; they may be the same span.
+    auto forward( std::span< Iq const > input, std::span< Iq > output ) -> utils::Result< void >;
+
+private:
+    struct Stage
+    {
+        std::size_t radix    = 4;
+        std::size_t length   = 0;
+        std::size_t stride   = 1;
+        std::size_t twiddles = 0;
+    };
+
+    std::size_t            size_       = 0;
+    std::vector< Stage >   stages_     = { };
+    std::vector< float32 > twiddle_re_ = { };
+    std::vector< float32 > twiddle_im_ = { };
+
+    std::array< std::vector< float32 >, 2 > re_ = { };
+    std::array< std::vector< float32 >, 2 > im_ = { };
+};
+
+/// \brief A forward FFT of real samples, computed as a complex FFT of half the size whose
+///        even and odd samples are the real and imaginary parts.
+class RealFft
+{
+public:
+    RealFft( ) = default;
+
+    /// \param size A power of two, at least 4.
+    explicit RealFft( std::size_t size );
+
+    [[nodiscard( "Const getter" )]]
+    auto size( ) const -> std::size_t;
+
+    /// \brief Bins `0` to `size() / 2` of the DFT of the `size()` samples of \p input; the
+    ///        rest mirror them.
+    auto forward( std::span< float32 const > input, std::span< Iq > output )
+        -> utils::Result< void >;
+
+private:
+    std::size_t       size_     = 0;
+    Fft               half_     = { };
+    std::vector< Iq > packed_   = { };
+    std::vector< Iq > twiddles_ = { };
+};
+
+struct SpectrumParams
+{
+    /// \brief Samples per transform, a power of two.
+    std::size_t size = 8'192;
+
+    float64 sample_rate_hz = 48'000.0;
+
+    Window window = Window::BlackmanHarris;
+
+    auto operator==( SpectrumParams const& ) const -> bool = default;
+};
+
+/// \brief Windowed magnitude spectra in dB, scaled so a full-scale tone reads 0 dB.
+class SpectrumAnalyzer
+{
+public:
+    explicit SpectrumAnalyzer( SpectrumParams params );
+
+    [[nodiscard( "Const getter" )]]
+    auto params( ) const -> SpectrumParams const&;
+
+    /// \brief The width of each bin (Hz).
+    [[nodiscard( "Const getter" )]]
+    auto bin_hz( ) const -> float64;
+
+    /// \brief The spectrum of `size` real samples, bins `0` to `size / 2`, from 0 Hz to half
+    ///        the sample rate.
+    auto real_spectrum( std::span< float32 const > samples, std::span< float32 > db )
+        -> utils::Result< void >;
+
+    /// \brief The spectrum of `size` complex baseband samples, `size` bins centered on
+    ///        0 Hz: bin `size / 2` is 0 Hz and bin 0 is minus half the sample rate.
+    auto iq_spectrum( std::span< Iq const > samples, std::span< float32 > db )
+        -> utils::Result< void >;
+
+private:
+    SpectrumParams         params_;
+    std::vector< float32 > window_   = { };
+    float32                gain_     = 1.0F;
+    Fft                    complex_  = { };
+    RealFft                real_     = { };
+    std::vector< float32 > windowed_ = { };
+    std::vector< Iq >      bins_     = { };
+};
+
+/// \brief How fast complex FFTs of one size run on this machine.
+struct FftThroughput
+{
+    std::size_t size               = 0;
+    float64     transforms_per_s   = 0.0;
+    float64     mega_samples_per_s = 0.0;
+};
+
+/// \brief Time complex FFTs of every power of two from `2^min_log2` to `2^max_log2`
+///        points, repeating each size for at least \p seconds_per_size.
+auto measure_fft_throughput(
+    std::size_t min_log2,
+    std::size_t max_log2,
+    float64     seconds_per_size
+) -> utils::Result< std::vector< FftThroughput > >;
+
+} // namespace ltb::dsp
@@ -0,0 +1,97 @@
+#pragma once
+
+// project
+#include "ltb/dsp/filter_design.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// standard
+#include <span>
+#include <vector>
+
+namespace ltb::dsp
+{
+
+/// \brief Applies one FIR filter to many channels, one block at a time:
+///        `y[n] = Σ taps[k] x[n - k]`.
+///
+/// Each output is a dot product of the taps with the latest inputs of its channel, summed
+/// in independent lanes that compile to packed multiply-adds whatever the channel count.
+/// State carries over between calls to `process()`, starting from silence.
+class FirFilter
+{
+public:
+    FirFilter( ) = default;
+
+    /// \param channel_count Independent signals filtered side by side, such as one per
+    ///        receiver.
+    explicit FirFilter( std::span< float32 const > taps, std::size_t channel_count = 1 );
+
+    [[nodiscard( "Const getter" )]]
+    auto taps( ) const -> std::vector< float32 > const&;
+
+    [[nodiscard( "Const getter" )]]
+    auto channel_count( ) const -> std::size_t;
+
+    /// \brief Filter the next `input.size() / channel_count` samples of every channel,
+    ///        time-major: sample `n` of channel `c` is `input[ n * channel_count + c ]`.
+    ///        \p output is laid out the same and may be \p input itself.
+    auto process( std::span< float32 const > input, std::span< float32 > output )
+        -> utils::Result< void >;
+
+private:
+    std::vector< float32 > taps_          = { };
+    std::size_t            channel_count_ = 0;
+
+    /// \brief The taps reversed to line up with the inputs oldest first, with zeros in
+    ///        front up to a whole number of lanes.
+    std::vector< float32 > reversed_ = { };
+
+    /// \brief Per channel, the inputs the next output still needs followed by the block.
+    std::vector< std::vector< float32 > > inputs_ = { };
+};
+
+/// \brief Applies a cascade of biquad sections to many channels, one block at a time.
+///
+/// The sections run in transposed direct form II with float64 state, which keeps narrow
+/// filters at low frequencies, like a 90 Hz band-pass at 48 kHz, accurate. The recursion
+/// can't be vectorized along time, so it is across channels instead: every section
+/// updates all channels of one sample in a contiguous loop, which makes filtering a
+/// batch of receivers much cheaper per receiver than filtering each alone. State carries
+/// over between calls to `process()`, starting from silence.
+class BiquadCascade
+{
+public:
+    BiquadCascade( ) = default;
+
+    /// \param channel_count Independent signals filtered side by side, such as one per
+    ///        receiver.
+    explicit BiquadCascade( std::span< Biquad const > sections, std::size_t channel_count = 1 );
+
+    [[nodiscard( "Const getter" )]]
+    auto sections( ) const -> std::vector< Biquad > const&;
+
+    [[nodiscard( "Const getter" )]]
+    auto channel_count( ) const -> std::size_t;
+
+    /// \brief Filter the next `input.size() / channel_count` samples of every channel,
+    ///        laid out like `FirFilter::process()`. \p output may be \p input itself.
+    auto process( std::span< float32 const > input, std::span< float32 > output )
+        -> utils::Result< void >;
+
+    /// \brief Return every channel to silence.
+    auto reset( ) -> void;
+
+private:
+    std::vector< Biquad > sections_      = { };
+    std::size_t           channel_count_ = 0;
+
+    /// \brief The two delays of each section, one row of `channel_count_` per section.
+    std::vector< float64 > z1_ = { };
+    std::vector< float64 > z2_ = { };
+
+    /// \brief One sample of every channel as it passes through the sections.
+    std::vector< float64 > frame_ = { };
+};
+
+} // namespace ltb::dsp
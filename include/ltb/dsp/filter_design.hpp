@@ -0,0 +1,396 @@
+#pragma once
+
+// project
+#include "ltb/utils/size_utils.hpp"
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace ltb::dsp
+{
+namespace details
+{
+
+/// \brief `sin( x )`, from its Taylor series when evaluated at compile time, where
+///        `std::sin` isn't available.
+constexpr auto sin( float64 const x ) -> float64
+{
+    if ( !std::is_constant_evaluated( ) )
+    {
+        return std::sin( x );
+    }
+
+    constexpr auto pi      = glm::pi< float64 >( );
+    constexpr auto half_pi = glm::half_pi< float64 >( );
+
+    // Reduce to [-π, π], then to [-π/2, π/2], where 12 terms are exact in float64.
+    auto const turns = x / glm::two_pi< float64 >( );
+    auto const whole = static_cast< float64 >( static_cast< int64 >(
+        ( turns < 0.0 ) ? ( turns - 0.5 ) : ( turns + 0.5 )
+    ) );
+
+    auto y = x - ( whole * glm::two_pi< float64 >( ) );
+    if ( y > half_pi )
+    {
+        y = pi - y;
+    }
+    else if ( y < -half_pi )
+    {
+        y = -pi - y;
+    }
+
+    auto term = y;
+    auto sum  = y;
+    for ( auto n = 1; n < 12; ++n )
+    {
+        term *= -( y * y ) / static_cast< float64 >( ( 2 * n ) * ( ( 2 * n ) + 1 ) );
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr auto cos( float64 const x ) -> float64
+{
+    if ( !std::is_constant_evaluated( ) )
+    {
+        return std::cos( x );
+    }
+    return sin( x + glm::half_pi< float64 >( ) );
+}
+
+/// \brief The positive \p n th root of a positive \p value, by Newton's method at compile
+///        time.
+constexpr auto root( float64 const value, int32 const n ) -> float64
+{
+    if ( !std::is_constant_evaluated( ) )
+    {
+        return std::pow( value, 1.0 / static_cast< float64 >( n ) );
+    }
+
+    auto x = ( value > 1.0 ) ? value : 1.0;
+    for ( auto i = 0; i < 200; ++i )
+    {
+        auto power = 1.0;
+        for ( auto k = 1; k < n; ++k )
+        {
+            power *= x;
+        }
+        auto const slope = static_cast< float64 >( n ) * power;
+        auto const next  = x - ( ( ( power * x ) - value ) / slope );
+        if ( next == x )
+        {
+            break;
+        }
+        x = next;
+    }
+    return x;
+}
+
+} // namespace details
+
+/// \brief One second-order IIR section, normalized so `a0` is 1:
+///
+///     y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2]
+struct Biquad
+{
+    float64 b0 = 1.0;
+    float64 b1 = 0.0;
+    float64 b2 = 0.0;
+    float64 a1 = 0.0;
+    float64 a2 = 0.0;
+
+    auto operator==( Biquad const& ) const -> bool = default;
+};
+
+/// \brief The Q of a maximally flat second-order section.
+constexpr auto butterworth_q = 0.70710678118654752440;
+
+namespace details
+{
+
+/// \brief Scale a section so `a0` is 1.
+constexpr auto normalized(
+    float64 const b0,
+    float64 const b1,
+    float64 const b2,
+    float64 const a0,
+    float64 const a1,
+    float64 const a2
+) -> Biquad
+{
+    return { .b0 = b0 / a0, .b1 = b1 / a0, .b2 = b2 / a0, .a1 = a1 / a0, .a2 = a2 / a0 };
+}
+
+/// \brief `ω0 = 2π f0 / fs` as its cosine, and the bandwidth term `sin(ω0) / 2Q`.
+struct Prewarp
+{
+    float64 cos_w0 = 1.0;
+    float64 alpha  = 0.0;
+};
+
+constexpr auto prewarp( float64 const frequency_hz, float64 const sample_rate_hz, float64 const q )
+    -> Prewarp
+{
+    auto const w0 = glm::two_pi< float64 >( ) * frequency_hz / sample_rate_hz;
+    return { .cos_w0 = cos( w0 ), .alpha = sin( w0 ) / ( 2.0 * q ) };
+}
+
+} // namespace details
+
+// The sections below follow R. Bristow-Johnson's Audio EQ Cookbook. Each one can be
+// designed at compile time, so fixed receiver filters cost nothing to set up.
+
+/// \brief A second-order low-pass filter, 3 dB down at \p cutoff_hz when `q` is
+///        `butterworth_q`.
+constexpr auto low_pass_biquad(
+    float64 const cutoff_hz,
+    float64 const sample_rate_hz,
+    float64 const q = butterworth_q
+) -> Biquad
+{
+    auto const [ c, alpha ] = details::prewarp( cutoff_hz, sample_rate_hz, q );
+    return details::normalized(
+        ( 1.0 - c ) * 0.5,
+        1.0 - c,
+        ( 1.0 - c ) * 0.5,
+        1.0 + alpha,
+        -2.0 * c,
+        1.0 - alpha
+    );
+}
+
+/// \brief A second-order high-pass filter, 3 dB down at \p cutoff_hz when `q` is
+///        `butterworth_q`.
+constexpr auto high_pass_biquad(
+    float64 const cutoff_hz,
+    float64 const sample_rate_hz,
+    float64 const q = butterworth_q
+) -> Biquad
+{
+    auto const [ c, alpha ] = details::prewarp( cutoff_hz, sample_rate_hz, q );
+    return details::normalized(
+        ( 1.0 + c ) * 0.5,
+        -( 1.0 + c ),
+        ( 1.0 + c ) * 0.5,
+        1.0 + alpha,
+        -2.0 * c,
+        1.0 - alpha
+    );
+}
+
+/// \brief A second-order band-pass filter with unit gain at \p center_hz, about
+///        `center_hz / q` wide between its 3 dB points.
+constexpr auto band_pass_biquad(
+    float64 const center_hz,
+    float64 const sample_rate_hz,
+    float64 const q
+) -> Biquad
+{
+    auto const [ c, alpha ] = details::prewarp( center_hz, sample_rate_hz, q );
+    return details::normalized( alpha, 0.0, -alpha, 1.0 + alpha, -2.0 * c, 1.0 - alpha );
+}
+
+/// \brief A Butterworth low-pass filter of even \p Order, as `Order / 2` sections.
+template < std::size_t Order >
+constexpr auto butterworth_low_pass( float64 const cutoff_hz, float64 const sample_rate_hz )
+    -> std::array< Biquad, Order / 2_UZ >
+{
+    static_assert( ( Order > 0_UZ ) && ( 0_UZ == Order % 2_UZ ), "Order must be even" );
+
+    // Each section takes one conjugate pair of the poles spread around the unit circle.
+    auto sections = std::array< Biquad, Order / 2_UZ >{ };
+    for ( auto k = 0_UZ; k < sections.size( ); ++k )
+    {
+        auto const angle = glm::pi< float64 >( ) * static_cast< float64 >( ( 2_UZ * k ) + 1_UZ )
+                         / static_cast< float64 >( 2_UZ * Order );
+        sections[ k ] = low_pass_biquad( cutoff_hz, sample_rate_hz, 0.5 / details::cos( angle ) );
+    }
+    return sections;
+}
+
+/// \brief A Butterworth high-pass filter of even \p Order, as `Order / 2` sections.
+template < std::size_t Order >
+constexpr auto butterworth_high_pass( float64 const cutoff_hz, float64 const sample_rate_hz )
+    -> std::array< Biquad, Order / 2_UZ >
+{
+    static_assert( ( Order > 0_UZ ) && ( 0_UZ == Order % 2_UZ ), "Order must be even" );
+
+    auto sections = std::array< Biquad, Order / 2_UZ >{ };
+    for ( auto k = 0_UZ; k < sections.size( ); ++k )
+    {
+        auto const angle = glm::pi< float64 >( ) * static_cast< float64 >( ( 2_UZ * k ) + 1_UZ )
+                         / static_cast< float64 >( 2_UZ * Order );
+        sections[ k ] = high_pass_biquad( cutoff_hz, sample_rate_hz, 0.5 / details::cos( angle ) );
+    }
+    return sections;
+}
+
+/// \brief \p Sections identical band-pass sections with unit gain at \p center_hz, 3 dB
+///        down `bandwidth_hz` apart all together. More sections fall off faster outside the
+///        band, as when picking the 90 Hz tone of an ILS signal out from the 150 Hz one.
+template < std::size_t Sections >
+constexpr auto band_pass(
+    float64 const center_hz,
+    float64 const bandwidth_hz,
+    float64 const sample_rate_hz
+) -> std::array< Biquad, Sections >
+{
+    static_assert( Sections > 0_UZ );
+
+    // Each section is `1 / ( 1 + Q² u² )` in power, where `u = f / f0 - f0 / f` spans
+    // `bandwidth / f0` between the 3 dB points of the cascade.
+    auto const spread = details::root( 2.0, static_cast< int32 >( Sections ) ) - 1.0;
+    auto const q      = center_hz * details::root( spread, 2 ) / bandwidth_hz;
+
+    auto sections = std::array< Biquad, Sections >{ };
+    sections.fill( band_pass_biquad( center_hz, sample_rate_hz, q ) );
+    return sections;
+}
+
+/// \brief The gain of \p sections in series at \p frequency_hz.
+constexpr auto magnitude_response(
+    std::span< Biquad const > const sections,
+    float64 const                   frequency_hz,
+    float64 const                   sample_rate_hz
+) -> float64
+{
+    // H(z) at z = e^(jω), with z^-1 = cos ω - j sin ω and z^-2 = cos 2ω - j sin 2ω.
+    auto const w     = glm::two_pi< float64 >( ) * frequency_hz / sample_rate_hz;
+    auto const cos_1 = details::cos( w );
+    auto const sin_1 = details::sin( w );
+    auto const cos_2 = details::cos( 2.0 * w );
+    auto const sin_2 = details::sin( 2.0 * w );
+
+    auto power = 1.0;
+    for ( auto const& s : sections )
+    {
+        auto const num_re = s.b0 + ( s.b1 * cos_1 ) + ( s.b2 * cos_2 );
+        auto const num_im = -( s.b1 * sin_1 ) - ( s.b2 * sin_2 );
+        auto const den_re = 1.0 + ( s.a1 * cos_1 ) + ( s.a2 * cos_2 );
+        auto const den_im = -( s.a1 * sin_1 ) - ( s.a2 * sin_2 );
+        power *= ( ( num_re * num_re ) + ( num_im * num_im ) )
+               / ( ( den_re * den_re ) + ( den_im * den_im ) );
+    }
+    return details::root( power, 2 );
+}
+
+/// \brief How many samples \p sections in series delay frequencies near 0 Hz. Each
+///        polynomial `Σ c[k] z^-k` delays them by `Σ k c[k] / Σ c[k]`, so only filters
+///        that pass 0 Hz have one.
+constexpr auto group_delay_at_dc( std::span< Biquad const > const sections ) -> float64
+{
+    auto delay = 0.0;
+    for ( auto const& s : sections )
+    {
+        delay += ( s.b1 + ( 2.0 * s.b2 ) ) / ( s.b0 + s.b1 + s.b2 );
+        delay -= ( s.a1 + ( 2.0 * s.a2 ) ) / ( 1.0 + s.a1 + s.a2 );
+    }
+    return delay;
+}
+
+/// \brief Fill \p taps with a Blackman-windowed sinc low-pass filter with unit gain at
+///        0 Hz, symmetric so it delays every frequency by `( taps.size() - 1 ) / 2`.
+constexpr auto low_pass_fir(
+    std::span< float32 > const taps,
+    float64 const              cutoff_hz,
+    float64 const              sample_rate_hz
+) -> void
+{
+    if ( taps.size( ) < 2_UZ )
+    {
+        std::ranges::fill( taps, 1.0F );
+        return;
+    }
+
+    auto const cutoff = cutoff_hz / sample_rate_hz;
+    auto const last   = static_cast< float64 >( taps.size( ) - 1_UZ );
+
+    auto const tap = [ cutoff, last ]( std::size_t const i )
+    {
+        auto const n    = static_cast< float64 >( i ) - ( last * 0.5 );
+        auto const sinc = ( 0.0 == n ) ? ( 2.0 * cutoff )
+                                       : ( details::sin( glm::two_pi< float64 >( ) * cutoff * n )
+                                           / ( glm::pi< float64 >( ) * n ) );
+
+        auto const x      = glm::two_pi< float64 >( ) * static_cast< float64 >( i ) / last;
+        auto const window = 0.42 - ( 0.5 * details::cos( x ) ) + ( 0.08 * details::cos( 2.0 * x ) );
+        return sinc * window;
+    };
+
+    auto sum = 0.0;
+    for ( auto i = 0_UZ; i < taps.size( ); ++i )
+    {
+        sum += tap( i );
+    }
+    for ( auto i = 0_UZ; i < taps.size( ); ++i )
+    {
+        taps[ i ] = static_cast< float32 >( tap( i ) / sum );
+    }
+}
+
+/// \brief A `low_pass_fir()` of \p Taps taps, designed at compile time when it can be.
+template < std::size_t Taps >
+constexpr auto low_pass_fir( float64 const cutoff_hz, float64 const sample_rate_hz )
+    -> std::array< float32, Taps >
+{
+    auto taps = std::array< float32, Taps >{ };
+    low_pass_fir( taps, cutoff_hz, sample_rate_hz );
+    return taps;
+}
+
+/// \brief A `low_pass_fir()` of \p count taps, for lengths only known at run time.
+inline auto low_pass_fir(
+    std::size_t const count,
+    float64 const     cutoff_hz,
+    float64 const     sample_rate_hz
+) -> std::vector< float32 >
+{
+    auto taps = std::vector< float32 >( count );
+    low_pass_fir( taps, cutoff_hz, sample_rate_hz );
+    return taps;
+}
+
+/// \brief Fill \p taps with a band-pass filter with unit gain at \p center_hz: the
+///        `low_pass_fir()` half \p bandwidth_hz wide, shifted up to \p center_hz.
+constexpr auto band_pass_fir(
+    std::span< float32 > const taps,
+    float64 const              center_hz,
+    float64 const              bandwidth_hz,
+    float64 const              sample_rate_hz
+) -> void
+{
+    low_pass_fir( taps, 0.5 * bandwidth_hz, sample_rate_hz );
+
+    auto const middle = 0.5 * static_cast< float64 >( taps.size( ) - 1_UZ );
+    for ( auto i = 0_UZ; i < taps.size( ); ++i )
+    {
+        auto const n = static_cast< float64 >( i ) - middle;
+        auto const shift
+            = 2.0 * details::cos( glm::two_pi< float64 >( ) * center_hz * n / sample_rate_hz );
+        taps[ i ] = static_cast< float32 >( static_cast< float64 >( taps[ i ] ) * shift );
+    }
+}
+
+/// \brief A `band_pass_fir()` of \p Taps taps, designed at compile time when it can be.
+template < std::size_t Taps >
+constexpr auto band_pass_fir(
+    float64 const center_hz,
+    float64 const bandwidth_hz,
+    float64 const sample_rate_hz
+) -> std::array< float32, Taps >
+{
+    auto taps = std::array< float32, Taps >{ };
+    band_pass_fir( taps, center_hz, bandwidth_hz, sample_rate_hz );
+    return taps;
+}
+
+} // namespace ltb::dsp
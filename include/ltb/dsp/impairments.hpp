@@ -0,0 +1,111 @@
+#pragma once
+
+// project
+#include "ltb/dsp/baseband.hpp"
+#include "ltb/dsp/noise.hpp"
+#include "ltb/dsp/oscillator.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// standard
+#include <span>
+#include <vector>
+
+namespace ltb::dsp
+{
+
+/// \brief An unwanted carrier: a CW tone, or an FM broadcast modulated by one tone.
+struct InterfererParams
+{
+    /// \brief The carrier frequency in real signals, or its offset from the tuned frequency
+    ///        in complex baseband.
+    float64 offset_hz = 0.0;
+
+    float32 amplitude = 0.0F;
+
+    /// \brief The FM broadcast's peak deviation. 0 for a CW tone.
+    float64 deviation_hz = 0.0;
+
+    /// \brief The tone the FM broadcast is modulated with.
+    float64 modulation_hz = 1'000.0;
+
+    auto operator==( InterfererParams const& ) const -> bool = default;
+};
+
+/// \brief Adds one interferer to blocks of samples. Its phase carries over between calls.
+class Interferer
+{
+public:
+    Interferer( InterfererParams params, float64 sample_rate_hz );
+
+    [[nodiscard( "Const getter" )]]
+    auto params( ) const -> InterfererParams const&;
+
+    /// \brief Add the real carrier to the next `samples.size()` samples.
+    auto add( std::span< float32 > samples ) -> void;
+
+    /// \brief Add the complex carrier to the next `iq.size()` samples.
+    auto add( std::span< Iq > iq ) -> void;
+
+private:
+    InterfererParams params_;
+    std::size_t      sample_count_ = 0;
+
+    Oscillator carrier_;
+    Oscillator modulation_;
+
+    /// \brief The FM modulation index, `deviation_hz / modulation_hz`.
+    float64 index_ = 0.0;
+
+    /// \brief `amplitude e^(jφ)` of the next sample.
+    auto next( ) -> glm::dvec2;
+};
+
+/// \brief The standard deviation of noise \p snr_db below \p signal_power.
+auto noise_sigma( float64 signal_power, float64 snr_db ) -> float32;
+
+struct ImpairmentParams
+{
+    /// \brief The standard deviation of additive white Gaussian noise, split evenly between
+    ///        I and Q in complex baseband. `noise_sigma()` finds it for an SNR.
+    float32 noise_sigma = 0.0F;
+
+    std::vector< InterfererParams > interferers = { };
+
+    /// \brief The noise is stream `stream` of `seed`; see `NoiseStream`.
+    uint64 seed   = 0U;
+    uint32 stream = 0U;
+
+    auto operator==( ImpairmentParams const& ) const -> bool = default;
+};
+
+/// \brief Adds noise and interference to blocks of samples, to test receivers against
+///        them. The noise is reproducible and everything carries over between calls, so a
+///        signal impaired in blocks is the same as one impaired whole.
+class Impairments
+{
+public:
+    Impairments( ) = default;
+
+    Impairments( ImpairmentParams params, float64 sample_rate_hz );
+
+    [[nodiscard( "Const getter" )]]
+    auto params( ) const -> ImpairmentParams const&;
+
+    /// \brief Add the interferers' real carriers and then the noise to \p samples.
+    auto apply( std::span< float32 > samples ) -> utils::Result< void >;
+
+    /// \brief Add the interferers and then the noise to complex baseband \p iq.
+    auto apply( std::span< Iq > iq ) -> utils::Result< void >;
+
+private:
+    ImpairmentParams params_         = { };
+    float64          sample_rate_hz_ = 0.0;
+
+    NoiseStream               noise_       = { };
+    std::vector< Interferer > interferers_ = { };
+
+    auto check( ) const -> utils::Result< void >;
+};
+
+} // namespace ltb::dsp
@@ -0,0 +1,106 @@
+#pragma once
+
+// project
+#include "ltb/dsp/baseband.hpp"
+#include "ltb/utils/mapped_file.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// standard
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace ltb::dsp
+{
+
+/// \brief How each complex sample of a recording is stored: interleaved I then Q.
+enum class IqFormat
+{
+    /// \brief Two little-endian float32 values.
+    Cf32,
+    /// \brief Two little-endian int16 values, full scale at ±32768.
+    Cs16,
+};
+
+/// \brief The bytes taken by one complex sample.
+auto sample_bytes( IqFormat format ) -> std::size_t;
+
+struct IqRecordingInfo
+{
+    IqFormat format = IqFormat::Cf32;
+
+    float64 sample_rate_hz = 48'000.0;
+
+    /// \brief The RF frequency 0 Hz in the baseband corresponds to, when known.
+    float64 center_frequency_hz = 0.0;
+
+    auto operator==( IqRecordingInfo const& ) const -> bool = default;
+};
+
+/// \brief Write \p iq to a new recording at \p path, converted to `info.format`, after a
+///        64 byte header holding \p info. Cs16 samples are clamped to full scale.
+auto write_iq_recording(
+    std::filesystem::path const& path,
+    IqRecordingInfo const&       info,
+    std::span< Iq const >        iq
+) -> utils::Result< void >;
+
+/// \brief Streams a memory-mapped IQ recording in blocks, so recordings far larger than
+///        memory can be demodulated. Only the pages a block touches are read from disk.
+///
+/// Cf32 blocks are views straight into the mapping; Cs16 blocks are converted into one
+/// block of scratch space. Either way, a block is only valid until the next call.
+class IqRecording
+{
+public:
+    IqRecording( ) = default;
+
+    /// \brief Open a recording made by `write_iq_recording()`, described by its header.
+    static auto open( std::filesystem::path const& path ) -> utils::Result< IqRecording >;
+
+    /// \brief Open a headerless recording of interleaved samples, described by \p info.
+    static auto open_raw( std::filesystem::path const& path, IqRecordingInfo const& info )
+        -> utils::Result< IqRecording >;
+
+    [[nodiscard( "Const getter" )]]
+    auto info( ) const -> IqRecordingInfo const&;
+
+    [[nodiscard( "Const getter" )]]
+    auto sample_count( ) const -> std::size_t;
+
+    [[nodiscard( "Const getter" )]]
+    auto duration_s( ) const -> float64;
+
+    /// \brief The index of the next sample `next_block()` returns.
+    [[nodiscard( "Const getter" )]]
+    auto position( ) const -> std::size_t;
+
+    /// \brief Continue reading from sample \p index, at most `sample_count()`.
+    auto seek( std::size_t index ) -> utils::Result< void >;
+
+    /// \brief Continue reading from the sample at or just after \p time_s, where sample 0
+    ///        is at 0 s.
+    auto seek_time( float64 time_s ) -> utils::Result< void >;
+
+    /// \brief The next \p max_samples samples: fewer near the end of the recording, and
+    ///        none once it is done.
+    auto next_block( std::size_t max_samples ) -> std::span< Iq const >;
+
+private:
+    utils::MappedFile file_         = { };
+    IqRecordingInfo   info_         = { };
+    std::size_t       data_offset_  = 0;
+    std::size_t       sample_count_ = 0;
+    std::size_t       position_     = 0;
+    std::vector< Iq > block_        = { };
+
+    /// \brief The samples start \p data_offset bytes into the mapping of \p file.
+    static auto from_mapping(
+        utils::MappedFile      file,
+        IqRecordingInfo const& info,
+        std::size_t            data_offset
+    ) -> utils::Result< IqRecording >;
+};
+
+} // namespace ltb::dsp
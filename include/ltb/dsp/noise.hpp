@@ -0,0 +1,110 @@
+#pragma once
+
+// project
+#include "ltb/dsp/baseband.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// standard
+#include <array>
+#include <span>
+
+namespace ltb::dsp
+{
+
+/// \brief The Philox4x32-10 block function: four random words that depend only on
+///        \p counter and \p key, so any value of a sequence can be computed without the
+///        ones before it.
+constexpr auto philox( std::array< uint32, 4 > counter, std::array< uint32, 2 > key )
+    -> std::array< uint32, 4 >
+{
+    constexpr auto multipliers = std::array< uint64, 2 >{ 0xD2511F53U, 0xCD9E8D57U };
+    constexpr auto key_steps   = std::array< uint32, 2 >{ 0x9E3779B9U, 0xBB67AE85U };
+    constexpr auto rounds      = 10;
+
+    for ( auto round = 0; round < rounds; ++round )
+    {
+        auto const product_0 = multipliers[ 0 ] * counter[ 0 ];
+        auto const product_1 = multipliers[ 1 ] * counter[ 2 ];
+
+        counter = {
+            static_cast< uint32 >( product_1 >> 32U ) ^ counter[ 1 ] ^ key[ 0 ],
+            static_cast< uint32 >( product_1 ),
+            static_cast< uint32 >( product_0 >> 32U ) ^ counter[ 3 ] ^ key[ 1 ],
+            static_cast< uint32 >( product_0 ),
+        };
+        key[ 0 ] += key_steps[ 0 ];
+        key[ 1 ] += key_steps[ 1 ];
+    }
+    return counter;
+}
+
+/// \brief A reproducible stream of random values for noise studies.
+///
+/// Value `n` of a stream is computed from `philox()` of `n`, the stream and the seed
+/// alone, so it is the same whatever blocks the stream is drawn in and however many
+/// other streams are drawn alongside it. Give each thread, receiver or Monte-Carlo trial
+/// its own stream of a shared seed and a run repeats exactly however it is scheduled.
+///
+/// Gaussian values use a 128-layer ziggurat: about 99 % of them take one random word, a
+/// table lookup and a multiply. The rest retry with words from counters reserved for
+/// value `n`, so they don't disturb the values after it.
+class NoiseStream
+{
+public:
+    NoiseStream( ) = default;
+
+    NoiseStream( uint64 seed, uint32 stream );
+
+    /// \brief The index of the next value.
+    [[nodiscard( "Const getter" )]]
+    auto position( ) const -> uint64;
+
+    /// \brief Continue from value \p position, forwards or backwards.
+    auto seek( uint64 position ) -> void;
+
+    /// \brief Fill \p values with the next values, uniform in [0, 1).
+    auto uniform( std::span< float32 > values ) -> void;
+
+    /// \brief Fill \p values with the next values, normally distributed with zero mean and
+    ///        unit variance.
+    auto gaussian( std::span< float32 > values ) -> void;
+
+    /// \brief Add `sigma` times the next `values.size()` Gaussian values to \p values.
+    auto add_gaussian( std::span< float32 > values, float32 sigma ) -> void;
+
+    /// \brief Add complex Gaussian noise of power `sigma²`, split evenly between I and Q,
+    ///        to \p iq. Uses two values per sample.
+    auto add_gaussian( std::span< Iq > iq, float32 sigma ) -> void;
+
+private:
+    std::array< uint32, 2 > key_      = { 0U, 0U };
+    uint32                  stream_   = 0U;
+    uint64                  position_ = 0U;
+
+    /// \brief The four words that values `4 k` to `4 k + 3` come from.
+    [[nodiscard( "Const getter" )]]
+    auto words( uint64 k ) const -> std::array< uint32, 4 >;
+
+    /// \brief Value \p position from \p word, the first word drawn for it.
+    [[nodiscard( "Const getter" )]]
+    auto normal( uint32 word, uint64 position ) const -> float32;
+};
+
+struct NoiseThroughput
+{
+    /// \brief Values per second from `NoiseStream`.
+    float64 uniform_mega_samples_per_s  = 0.0;
+    float64 gaussian_mega_samples_per_s = 0.0;
+
+    /// \brief Gaussian values per second from `std::normal_distribution` and
+    ///        `std::mt19937`, for comparison.
+    float64 standard_mega_samples_per_s = 0.0;
+};
+
+/// \brief Time drawing blocks of \p block_size values for at least \p seconds_each per
+///        generator.
+auto measure_noise_throughput( std::size_t block_size, float64 seconds_each )
+    -> utils::Result< NoiseThroughput >;
+
+} // namespace ltb::dsp
@@ -0,0 +1,59 @@
+#pragma once
+
+// project
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/glm.hpp>
+
+// standard
+#include <cstddef>
+
+namespace ltb::dsp
+{
+
+/// \brief A unit phasor rotated by a constant angle every sample.
+///
+/// Rotating costs four multiplies per sample instead of a `sin` and `cos`. Rounding
+/// slowly drifts the phasor, so callers `reseed()` it to the exact phase of a sample
+/// index every `reseed_interval` samples.
+class Oscillator
+{
+public:
+    /// \brief Rounding errors can only build up over this many samples between reseeds.
+    static constexpr auto reseed_interval = std::size_t{ 1024 };
+
+    Oscillator( ) = default;
+
+    /// \param frequency Cycles per unit of time.
+    /// \param start The time of sample 0.
+    /// \param step The time between samples.
+    Oscillator( float64 frequency, float64 start, float64 step );
+
+    /// \brief Jump to the exact phase of sample \p index.
+    auto reseed( std::size_t index ) -> void;
+
+    /// \brief (cos, sin) of the current phase.
+    [[nodiscard( "Const getter" )]]
+    auto phasor( ) const -> glm::dvec2
+    {
+        return phasor_;
+    }
+
+    auto advance( ) -> void
+    {
+        phasor_ = {
+            ( phasor_.x * rotation_.x ) - ( phasor_.y * rotation_.y ),
+            ( phasor_.x * rotation_.y ) + ( phasor_.y * rotation_.x ),
+        };
+    }
+
+private:
+    float64    frequency_ = 0.0;
+    float64    start_     = 0.0;
+    float64    step_      = 0.0;
+    glm::dvec2 rotation_  = { 1.0, 0.0 };
+    glm::dvec2 phasor_    = { 1.0, 0.0 };
+};
+
+} // namespace ltb::dsp
@@ -0,0 +1,142 @@
+#pragma once
+
+// project
+#include "ltb/utils/size_utils.hpp"
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <execution>
+#include <tuple>
+#include <vector>
+
+namespace ltb::dsp
+{
+
+/// \brief Sine tones sampled at the same evenly spaced times.
+///
+/// Samples are generated in blocks that run in parallel. Each block starts from the exact
+/// float64 phase of its first samples, then rotates `lane_count` phasors per tone, one per
+/// consecutive sample, by `lane_count` steps at a time. The lanes are independent, so the
+/// rotation compiles to packed multiplies instead of a `sin` per sample, and reseeding every
+/// block keeps the accumulated rounding error below 1e-12.
+template < std::size_t ToneCount >
+class OscillatorBank
+{
+public:
+    using Tones = std::array< float64, ToneCount >;
+    using Block = std::array< float64, 1024 >;
+
+    static constexpr auto lane_count = 8_UZ;
+    static constexpr auto block_size = std::tuple_size_v< Block >;
+
+    static_assert( 0_UZ == block_size % lane_count );
+
+    OscillatorBank( ) = default;
+
+    /// \param frequencies Cycles per unit of time, one per tone.
+    /// \param start The time of sample 0.
+    /// \param step The time between samples.
+    OscillatorBank( Tones const& frequencies, float64 const start, float64 const step )
+        : frequencies_( frequencies )
+        , start_( start )
+        , step_( step )
+    {
+    }
+
+    /// \brief Call `write( index, sines )` for every sample index in [0, \p count), where
+    ///        `sines[ t ]` is `sin( 2π f_t t )` at the time of that sample.
+    ///
+    /// Blocks are written concurrently, so \p write must be safe to call from several
+    /// threads for different indices. Writing each sample straight into the final buffers
+    /// fuses any per-sample mixing into the same pass.
+    template < typename Write >
+    auto generate( std::size_t const count, Write const& write ) const -> void
+    {
+        auto block_starts = std::vector< std::size_t >{ };
+        for ( auto i = 0_UZ; i < count; i += block_size )
+        {
+            block_starts.push_back( i );
+        }
+
+        std::for_each(
+            std::execution::par,
+            block_starts.begin( ),
+            block_starts.end( ),
+            [ this, count, &write ]( std::size_t const block_start )
+            {
+                auto const block_count = std::min( block_size, count - block_start );
+                auto       sines       = std::array< Block, ToneCount >{ };
+
+                for ( auto t = 0_UZ; t < ToneCount; ++t )
+                {
+                    generate_block( t, block_start, sines[ t ] );
+                }
+
+                auto sample = Tones{ };
+                for ( auto i = 0_UZ; i < block_count; ++i )
+                {
+                    for ( auto t = 0_UZ; t < ToneCount; ++t )
+                    {
+                        sample[ t ] = sines[ t ][ i ];
+                    }
+                    write( block_start + i, sample );
+                }
+            }
+        );
+    }
+
+private:
+    Tones   frequencies_ = { };
+    float64 start_       = 0.0;
+    float64 step_        = 0.0;
+
+    /// \brief The unit phasor `frequency * time` cycles around, reduced to one cycle first
+    ///        so large times keep their precision.
+    static auto phasor( float64 const cycles ) -> glm::dvec2
+    {
+        auto const angle = glm::two_pi< float64 >( ) * ( cycles - std::floor( cycles ) );
+        return { std::cos( angle ), std::sin( angle ) };
+    }
+
+    auto generate_block( std::size_t const tone, std::size_t const block_start, Block& sines ) const
+        -> void
+    {
+        auto const frequency = frequencies_[ tone ];
+
+        // Split into real and imaginary arrays so the lane loop vectorizes.
+        auto re = std::array< float64, lane_count >{ };
+        auto im = std::array< float64, lane_count >{ };
+        for ( auto lane = 0_UZ; lane < lane_count; ++lane )
+        {
+            auto const time  = start_ + ( static_cast< float64 >( block_start + lane ) * step_ );
+            auto const start = phasor( frequency * time );
+            re[ lane ]       = start.x;
+            im[ lane ]       = start.y;
+        }
+
+        auto const rotation    = phasor( frequency * step_ * static_cast< float64 >( lane_count ) );
+        auto const rotation_re = rotation.x;
+        auto const rotation_im = rotation.y;
+
+        for ( auto i = 0_UZ; i < block_size; i += lane_count )
+        {
+            for ( auto lane = 0_UZ; lane < lane_count; ++lane )
+            {
+                sines[ i + lane ] = im[ lane ];
+
+                auto const next_re = ( re[ lane ] * rotation_re ) - ( im[ lane ] * rotation_im );
+                auto const next_im = ( re[ lane ] * rotation_im ) + ( im[ lane ] * rotation_re );
+                re[ lane ]         = next_re;
+                im[ lane ]         = next_im;
+            }
+        }
+    }
+};
+
+} // namespace ltb::dsp
@@ -0,0 +1,155 @@
+#pragma once
+
+// project
+#include "ltb/dsp/baseband.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// standard
+#include <span>
+#include <vector>
+
+namespace ltb::dsp
+{
+
+struct ResamplerParams
+{
+    /// \brief The output rate is the input rate times `interpolation / decimation`.
+    std::size_t interpolation = 1;
+    std::size_t decimation    = 10;
+
+    /// \brief The band kept flat, as a fraction of the lower of the input and output
+    ///        Nyquist frequencies.
+    float64 passband = 0.8;
+
+    /// \brief Where the filter reaches full attenuation, in the same units. Anything above
+    ///        `2 - passband` aliases into the passband, so that is as high as it should be;
+    ///        it can be higher when a later stage filters more narrowly anyway.
+    float64 stopband = 1.2;
+
+    /// \brief Independent signals resampled side by side, such as one per receiver.
+    std::size_t channel_count = 1;
+
+    auto operator==( ResamplerParams const& ) const -> bool = default;
+};
+
+/// \brief Changes the sample rate of many channels by a rational factor, one block at a
+///        time.
+///
+/// The anti-aliasing filter is a Blackman-Harris windowed sinc, around 90 dB down in the
+/// stopband, split into `interpolation` polyphase branches up front. Only the outputs are
+/// computed, each a dot product of one branch with the latest inputs, so decimating by M
+/// costs `1 / M` of filtering at the input rate. The dot products accumulate in
+/// independent lanes, which compile to packed multiply-adds.
+///
+/// The output lags the input by half the filter. State carries over between calls to
+/// `process()`, so any split of the input gives the same output.
+class Resampler
+{
+public:
+    explicit Resampler( ResamplerParams params );
+
+    [[nodiscard( "Const getter" )]]
+    auto params( ) const -> ResamplerParams const&;
+
+    /// \brief The taps in the whole prototype filter.
+    [[nodiscard( "Const getter" )]]
+    auto tap_count( ) const -> std::size_t;
+
+    /// \brief The number of output samples per channel the next \p input_count input
+    ///        samples per channel produce.
+    [[nodiscard( "Const getter" )]]
+    auto output_count( std::size_t input_count ) const -> std::size_t;
+
+    /// \brief Resample the next `input.size() / channel_count` samples of every channel,
+    ///        time-major like `ToneBank`. \p output must hold `output_count()` samples of
+    ///        every channel.
+    auto process( std::span< float32 const > input, std::span< float32 > output )
+        -> utils::Result< void >;
+
+    /// \brief Resample complex baseband, with I and Q as the two channels.
+    auto process( std::span< Iq const > input, std::span< Iq > output ) -> utils::Result< void >;
+
+private:
+    ResamplerParams params_;
+    std::size_t     branch_size_ = 0;
+
+    /// \brief `interpolation` branches of `branch_size_` taps, each reversed so it lines up
+    ///        with the inputs oldest first.
+    std::vector< float32 > branches_ = { };
+
+    /// \brief Per channel, the last `branch_size_ - 1` inputs followed by the current block.
+    std::vector< std::vector< float32 > > inputs_ = { };
+
+    /// \brief How far past the start of the next block the next output falls, in samples
+    ///        of the interpolated rate.
+    std::size_t offset_ = 0;
+
+    auto check( std::size_t input_count, std::size_t output_count, std::size_t channels ) const
+        -> utils::Result< void >;
+
+    /// \brief Filter the block already in `inputs_[ channel ]`, handing each output and its
+    ///        index to \p write.
+    template < typename Write >
+    auto filter( std::size_t channel, std::size_t input_count, Write const& write ) const -> void;
+
+    /// \brief Keep the last inputs of every channel and move the output phase on.
+    auto advance( std::size_t input_count ) -> void;
+};
+
+/// \brief Resamplers run one after another, each feeding the next, for factors too large
+///        to filter well in one stage.
+class ResamplerCascade
+{
+public:
+    explicit ResamplerCascade( std::vector< ResamplerParams > const& stages );
+
+    [[nodiscard( "Const getter" )]]
+    auto stages( ) const -> std::vector< Resampler > const&;
+
+    /// \brief The number of output samples per channel the next \p input_count input
+    ///        samples per channel produce.
+    [[nodiscard( "Const getter" )]]
+    auto output_count( std::size_t input_count ) const -> std::size_t;
+
+    /// \brief Like `Resampler::process()`, through every stage.
+    auto process( std::span< float32 const > input, std::span< float32 > output )
+        -> utils::Result< void >;
+
+    /// \brief Like `Resampler::process()`, through every stage.
+    auto process( std::span< Iq const > input, std::span< Iq > output ) -> utils::Result< void >;
+
+private:
+    std::vector< Resampler > stages_ = { };
+
+    /// \brief The output of each stage but the last.
+    std::vector< std::vector< float32 > > between_    = { };
+    std::vector< std::vector< Iq > >      between_iq_ = { };
+};
+
+/// \brief Stages that decimate by \p factor in total, largest factors first and none more
+///        than 10 unless \p factor has a larger prime factor.
+///
+/// Every stage keeps \p passband of the final output's Nyquist band free of aliases. The
+/// early stages only need to stop what would alias into that narrow band, so their
+/// filters are short and the cascade costs little more than its first stage.
+auto decimation_stages( std::size_t factor, float64 passband = 0.8, std::size_t channel_count = 1 )
+    -> std::vector< ResamplerParams >;
+
+/// \brief How fast a cascade decimating by one factor runs on this machine.
+struct ResamplerThroughput
+{
+    std::size_t decimation         = 0;
+    std::size_t stage_count        = 0;
+    std::size_t tap_count          = 0;
+    float64     mega_samples_per_s = 0.0;
+};
+
+/// \brief Time `decimation_stages()` cascades for every factor in \p factors, feeding
+///        each real input samples for at least \p seconds_per_factor.
+auto measure_decimation_throughput(
+    std::span< std::size_t const > factors,
+    float64                        seconds_per_factor
+) -> utils::Result< std::vector< ResamplerThroughput > >;
+
+} // namespace ltb::dsp
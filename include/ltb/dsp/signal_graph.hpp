@@ -0,0 +1,347 @@
+#pragma once
+
+// project
+#include "ltb/dsp/oscillator.hpp"
+#include "ltb/utils/size_utils.hpp"
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <execution>
+#include <functional>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace ltb::dsp
+{
+
+/// \brief The evenly spaced times every node in a graph is sampled at.
+struct SampleClock
+{
+    /// \brief The time of sample 0.
+    float64 start = 0.0;
+    /// \brief The time between samples.
+    float64 step = 1.0;
+
+    auto operator==( SampleClock const& ) const -> bool = default;
+};
+
+/// \brief A node in a signal graph.
+///
+/// Nodes are small value types that are combined into a single expression type, so a whole
+/// chain of sources, mixers, modulators and filters compiles to one loop with no buffers
+/// between the stages. `start( clock, index )` prepares a node to produce samples from
+/// \p index on, then each `next()` returns one sample. Nodes are `stateless` when their
+/// output only depends on the sample index, which lets a graph be rendered in blocks.
+template < typename Node >
+concept SignalNode = std::copy_constructible< Node >
+    && requires( Node node, SampleClock const& clock, std::size_t index ) {
+           { Node::stateless } -> std::convertible_to< bool >;
+           { node.start( clock, index ) } -> std::same_as< void >;
+           { node.next( ) } -> std::convertible_to< float64 >;
+       };
+
+/// \brief The same value at every sample.
+class Constant
+{
+public:
+    static constexpr auto stateless = true;
+
+    explicit constexpr Constant( float64 const value )
+        : value_( value )
+    {
+    }
+
+    auto start( SampleClock const&, std::size_t ) -> void { }
+
+    [[nodiscard]] auto next( ) const -> float64 { return value_; }
+
+private:
+    float64 value_ = 0.0;
+};
+
+/// \brief `sin( 2π f t + phase )`, generated by rotating a phasor instead of calling `sin`.
+class Tone
+{
+public:
+    static constexpr auto stateless = true;
+
+    /// \param frequency Cycles per unit of clock time.
+    explicit Tone( float64 const frequency, float64 const phase_rad = 0.0 )
+        : frequency_( frequency )
+        , phase_( std::cos( phase_rad ), std::sin( phase_rad ) )
+    {
+    }
+
+    auto start( SampleClock const& clock, std::size_t const index ) -> void
+    {
+        oscillator_ = Oscillator{ frequency_, clock.start, clock.step };
+        oscillator_.reseed( index );
+        index_ = index;
+    }
+
+    auto next( ) -> float64
+    {
+        auto const phasor = oscillator_.phasor( );
+        auto const value  = ( phasor.y * phase_.x ) + ( phasor.x * phase_.y );
+
+        if ( 0_UZ == ( ++index_ % Oscillator::reseed_interval ) )
+        {
+            oscillator_.reseed( index_ );
+        }
+        else
+        {
+            oscillator_.advance( );
+        }
+        return value;
+    }
+
+private:
+    float64     frequency_  = 0.0;
+    glm::dvec2  phase_      = { 1.0, 0.0 };
+    Oscillator  oscillator_ = { };
+    std::size_t index_      = 0;
+};
+
+/// \brief Applies \p Op to the current sample of every input.
+template < typename Op, SignalNode... Inputs >
+class Combine
+{
+public:
+    static constexpr auto stateless = ( Inputs::stateless && ... );
+
+    explicit Combine( Op op, Inputs... inputs )
+        : op_( std::move( op ) )
+        , inputs_( std::move( inputs )... )
+    {
+    }
+
+    auto start( SampleClock const& clock, std::size_t const index ) -> void
+    {
+        std::apply( [ & ]( auto&... inputs ) { ( inputs.start( clock, index ), ... ); }, inputs_ );
+    }
+
+    auto next( ) -> float64
+    {
+        return std::apply(
+            [ this ]( auto&... inputs ) { return op_( inputs.next( )... ); },
+            inputs_
+        );
+    }
+
+private:
+    Op                      op_;
+    std::tuple< Inputs... > inputs_;
+};
+
+/// \brief Applies \p op to every sample of \p inputs, e.g. to rectify or clip a signal.
+template < typename Op, SignalNode... Inputs >
+auto map( Op op, Inputs... inputs ) -> Combine< Op, Inputs... >
+{
+    return Combine< Op, Inputs... >{ std::move( op ), std::move( inputs )... };
+}
+
+template < SignalNode Lhs, SignalNode Rhs >
+auto operator+( Lhs lhs, Rhs rhs )
+{
+    return map( std::plus<>{ }, std::move( lhs ), std::move( rhs ) );
+}
+
+template < SignalNode Lhs, SignalNode Rhs >
+auto operator-( Lhs lhs, Rhs rhs )
+{
+    return map( std::minus<>{ }, std::move( lhs ), std::move( rhs ) );
+}
+
+/// \brief Mixes two signals.
+template < SignalNode Lhs, SignalNode Rhs >
+auto operator*( Lhs lhs, Rhs rhs )
+{
+    return map( std::multiplies<>{ }, std::move( lhs ), std::move( rhs ) );
+}
+
+template < SignalNode Rhs >
+auto operator*( float64 const lhs, Rhs rhs )
+{
+    return Constant{ lhs } * std::move( rhs );
+}
+
+template < SignalNode Lhs >
+auto operator+( Lhs lhs, float64 const rhs )
+{
+    return std::move( lhs ) + Constant{ rhs };
+}
+
+/// \brief \p carrier with its amplitude scaled by \p message, which is expected in [-1, 1].
+///        The envelope swings from `1 - 2 depth` to 1 so the output peaks at 1.
+template < SignalNode Carrier, SignalNode Message >
+auto amplitude_modulate( Carrier carrier, Message message, float64 const depth = 0.5 )
+{
+    return map(
+        [ depth ]( float64 const c, float64 const m )
+        { return c * ( ( 1.0 - depth ) + ( depth * m ) ); },
+        std::move( carrier ),
+        std::move( message )
+    );
+}
+
+/// \brief `sin( φ )` where φ advances at `center + deviation * message` cycles per unit
+///        of clock time. The phase is integrated sample by sample, so it is stateful.
+template < SignalNode Message >
+class FrequencyModulator
+{
+public:
+    static constexpr auto stateless = false;
+
+    FrequencyModulator( float64 const center, float64 const deviation, Message message )
+        : center_( center )
+        , deviation_( deviation )
+        , message_( std::move( message ) )
+    {
+    }
+
+    auto start( SampleClock const& clock, std::size_t const index ) -> void
+    {
+        message_.start( clock, index );
+        step_   = clock.step;
+        cycles_ = center_ * ( clock.start + ( static_cast< float64 >( index ) * clock.step ) );
+        cycles_ -= std::floor( cycles_ );
+    }
+
+    auto next( ) -> float64
+    {
+        auto const value = std::sin( glm::two_pi< float64 >( ) * cycles_ );
+        cycles_ += ( center_ + ( deviation_ * message_.next( ) ) ) * step_;
+        cycles_ -= std::floor( cycles_ );
+        return value;
+    }
+
+private:
+    float64 center_    = 0.0;
+    float64 deviation_ = 0.0;
+    Message message_;
+    float64 step_   = 0.0;
+    float64 cycles_ = 0.0;
+};
+
+template < SignalNode Message >
+auto frequency_modulate( float64 const center, float64 const deviation, Message message )
+{
+    return FrequencyModulator< Message >{ center, deviation, std::move( message ) };
+}
+
+/// \brief A single-pole low-pass filter, `y += a ( x - y )`, starting from rest.
+template < SignalNode Input >
+class LowPass
+{
+public:
+    static constexpr auto stateless = false;
+
+    /// \param cutoff The -3 dB frequency in cycles per unit of clock time.
+    LowPass( Input input, float64 const cutoff )
+        : input_( std::move( input ) )
+        , cutoff_( cutoff )
+    {
+    }
+
+    auto start( SampleClock const& clock, std::size_t const index ) -> void
+    {
+        input_.start( clock, index );
+        alpha_  = 1.0 - std::exp( -glm::two_pi< float64 >( ) * cutoff_ * clock.step );
+        output_ = 0.0;
+    }
+
+    auto next( ) -> float64
+    {
+        output_ += alpha_ * ( input_.next( ) - output_ );
+        return output_;
+    }
+
+private:
+    Input   input_;
+    float64 cutoff_ = 0.0;
+    float64 alpha_  = 0.0;
+    float64 output_ = 0.0;
+};
+
+template < SignalNode Input >
+auto low_pass( Input input, float64 const cutoff )
+{
+    return LowPass< Input >{ std::move( input ), cutoff };
+}
+
+/// \brief Samples every node in the same pass and calls `sink( index, values... )` for
+///        every sample index in [0, \p count).
+///
+/// Graphs made only of stateless nodes are rendered in parallel blocks, each starting from
+/// its own copy of the nodes, so \p sink must be safe to call from several threads for
+/// different indices. Graphs with filters or other state are rendered in order.
+template < typename Sink, SignalNode... Nodes >
+auto for_each_sample(
+    SampleClock const& clock,
+    std::size_t const  count,
+    Sink const&        sink,
+    Nodes const&... nodes
+) -> void
+{
+    constexpr auto block_size = Oscillator::reseed_interval;
+
+    auto const render_block = [ & ]( std::size_t const block_start, std::size_t const block_end )
+    {
+        auto block_nodes = std::tuple< Nodes... >{ nodes... };
+        std::apply(
+            [ & ]( auto&... block_node )
+            {
+                ( block_node.start( clock, block_start ), ... );
+                for ( auto i = block_start; i < block_end; ++i )
+                {
+                    sink( i, block_node.next( )... );
+                }
+            },
+            block_nodes
+        );
+    };
+
+    if constexpr ( ( Nodes::stateless && ... ) )
+    {
+        auto block_starts = std::vector< std::size_t >{ };
+        for ( auto i = 0_UZ; i < count; i += block_size )
+        {
+            block_starts.push_back( i );
+        }
+
+        std::for_each(
+            std::execution::par,
+            block_starts.begin( ),
+            block_starts.end( ),
+            [ & ]( std::size_t const block_start )
+            { render_block( block_start, std::min( block_start + block_size, count ) ); }
+        );
+    }
+    else
+    {
+        render_block( 0_UZ, count );
+    }
+}
+
+/// \brief Materialise \p node into \p values, one sample per value.
+template < SignalNode Node >
+auto render( Node const& node, SampleClock const& clock, std::span< float64 > const values )
+    -> void
+{
+    for_each_sample(
+        clock,
+        values.size( ),
+        [ values ]( std::size_t const i, float64 const value ) { values[ i ] = value; },
+        node
+    );
+}
+
+} // namespace ltb::dsp
@@ -0,0 +1,113 @@
+#pragma once
+
+// project
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/glm.hpp>
+
+// standard
+#include <span>
+#include <vector>
+
+namespace ltb::dsp
+{
+
+struct ToneBankParams
+{
+    float64 sample_rate_hz = 48'000.0;
+
+    /// \brief The DFT window is `sample_rate_hz / window_hz` samples long. Both the sample
+    ///        rate and every tone must be whole multiples of it.
+    float64 window_hz = 30.0;
+
+    /// \brief The frequencies tracked, by default every tone ILS and VOR receivers need.
+    std::vector< float64 > tones_hz = { 30.0, 90.0, 150.0, 9'960.0 };
+
+    /// \brief Independent signals tracked side by side, such as one per receiver.
+    std::size_t channel_count = 1;
+
+    /// \brief The time of the first sample, which phases are measured from.
+    float64 start_time_s = 0.0;
+
+    auto operator==( ToneBankParams const& ) const -> bool = default;
+};
+
+/// \brief Tracks the amplitude and phase of a few tones in many channels with a sliding
+///        DFT over the most recent window of samples.
+///
+/// Each tone completes whole cycles in the window, so the phasor a sample leaves the
+/// window with is the one it entered with, and one table of phasors per tone serves every
+/// sample. Each new sample then costs one complex multiply-add per tone per channel,
+/// however long the window, in loops over contiguous channels that the compiler
+/// vectorizes. The sums are recomputed from the window once it has been replaced, so
+/// rounding can't build up. Until the first window is full, the missing samples count
+/// as zeros.
+///
+/// State carries over between calls to `process()`.
+class ToneBank
+{
+public:
+    explicit ToneBank( ToneBankParams params );
+
+    [[nodiscard( "Const getter" )]]
+    auto params( ) const -> ToneBankParams const&;
+
+    /// \brief The number of samples in the DFT window.
+    [[nodiscard( "Const getter" )]]
+    auto window_size( ) const -> std::size_t;
+
+    /// \brief The number of samples of each channel processed so far.
+    [[nodiscard( "Const getter" )]]
+    auto sample_count( ) const -> std::size_t;
+
+    /// \brief Slide the window over the next `samples.size() / channel_count` samples of
+    ///        every channel, time-major: sample `n` of channel `c` is
+    ///        `samples[ n * channel_count + c ]`.
+    auto process( std::span< float32 const > samples ) -> utils::Result< void >;
+
+    /// \brief Like `process()` for one sample of every channel, without checking the
+    ///        parameters or the size of \p frame; for callers that already have.
+    auto push( std::span< float32 const > frame ) -> void;
+
+    /// \brief `A e^(jφ)` for the component `A cos(ω t + φ)` of the tone over the window.
+    ///        A 0 Hz tone reads the mean.
+    [[nodiscard( "Const getter" )]]
+    auto value( std::size_t tone, std::size_t channel ) const -> glm::dvec2;
+
+    /// \brief The amplitude `A` of the tone in every channel.
+    auto amplitudes( std::size_t tone, std::span< float32 > values ) const
+        -> utils::Result< void >;
+
+    /// \brief The phase `φ` of the tone in every channel, in (-π, π].
+    auto phases( std::size_t tone, std::span< float32 > values ) const -> utils::Result< void >;
+
+private:
+    ToneBankParams params_;
+    std::size_t    window_size_  = 0;
+    std::size_t    sample_count_ = 0;
+
+    /// \brief `window_size_` rows of `channel_count` samples; sample `n` is in row
+    ///        `n % window_size_`.
+    std::vector< float32 > history_ = { };
+
+    /// \brief `e^(-jωt)` of the sample in each history row, one row per tone.
+    std::vector< float64 > phasor_re_ = { };
+    std::vector< float64 > phasor_im_ = { };
+
+    /// \brief `Σ x e^(-jωt)` over the window, one row of `channel_count` per tone.
+    std::vector< float64 > sums_re_ = { };
+    std::vector< float64 > sums_im_ = { };
+
+    /// \brief The scale from each tone's sums to `value()`.
+    std::vector< float64 > scales_ = { };
+
+    auto check_tone( std::size_t tone, std::span< float32 > values ) const
+        -> utils::Result< void >;
+
+    /// \brief Recompute the sums from the window.
+    auto resum( ) -> void;
+};
+
+} // namespace ltb::dsp
@@ -1,8 +1,17 @@
 #pragma once
 
 // project
+#include "ltb/dsp/am_detector.hpp"
+#include "ltb/dsp/fft.hpp"
+#include "ltb/dsp/noise.hpp"
+#include "ltb/dsp/resampler.hpp"
 #include "ltb/gui/imgui.hpp"
 
+// standard
+#include <optional>
+#include <span>
+#include <vector>
+
 namespace ltb::gui
 {
 
@@ -10,4 +19,31 @@ auto configure_lines( ) -> void;
 
 auto configure_histogram( ) -> void;
 
+/// \brief `ImPlot::PlotLine` of a spectrum in dB, with bin `i` at `first_hz + i * bin_hz`.
+///        Call between `BeginPlot`/`EndPlot`.
+auto plot_spectrum(
+    char const*                label,
+    std::span< float32 const > db,
+    float64                    first_hz,
+    float64                    bin_hz
+) -> void;
+
+/// \brief A button that times complex FFTs of 2^10 to 2^22 points, and a table of the
+///        timings it last stored in \p throughput.
+auto configure_fft_benchmark( std::vector< dsp::FftThroughput >& throughput ) -> void;
+
+/// \brief A button that times decimation cascades from ×10 to ×1000, and a table of the
+///        timings it last stored in \p throughput.
+auto configure_decimation_benchmark( std::vector< dsp::ResamplerThroughput >& throughput )
+    -> void;
+
+/// \brief A button that times AM detection of 1 to 4096 channels, and a table of the
+///        timings it last stored in \p throughput.
+auto configure_am_detector_benchmark( std::vector< dsp::AmDetectorThroughput >& throughput )
+    -> void;
+
+/// \brief A button that times the noise generators against the standard library, and the
+///        rates it last stored in \p throughput.
+auto configure_noise_benchmark( std::optional< dsp::NoiseThroughput >& throughput ) -> void;
+
 } // namespace ltb::gui
@@ -0,0 +1,72 @@
+#pragma once
+
+// project
+#include "ltb/math/range.hpp"
+#include "ltb/utils/types.hpp"
+
+// standard
+#include <span>
+#include <vector>
+
+namespace ltb::gui
+{
+
+/// \brief The points to hand to a line plot, in increasing x.
+template < typename T >
+struct LineEnvelope
+{
+    std::vector< float64 > x = { };
+    std::vector< T >       y = { };
+};
+
+/// \brief A level-of-detail cache for plotting long, evenly spaced line series.
+///
+/// A min/max pyramid is built once when the values change. Each level stores the min
+/// and max of buckets `level_factor` times larger than the level below, so any view
+/// is drawn from a few points per pixel: the min and max of every bucket that fits
+/// in a pixel. Peaks are never lost, and the work per frame only depends on the plot
+/// width, not the number of samples.
+template < typename T >
+class LineLod
+{
+public:
+    static constexpr auto level_factor = std::size_t{ 4 };
+
+    LineLod( ) = default;
+
+    /// \brief Copy \p values, with sample `i` at `x_start + i * x_step`, and rebuild the
+    ///        pyramid.
+    auto set_values( std::span< T const > values, float64 x_start = 0.0, float64 x_step = 1.0 )
+        -> void;
+
+    [[nodiscard( "Const getter" )]]
+    auto values( ) const -> std::vector< T > const&;
+
+    /// \brief The x of the first and last sample.
+    [[nodiscard( "Const getter" )]]
+    auto x_range( ) const -> math::Range< float64 >;
+
+    /// \brief The points needed to draw the samples inside \p x_limits across
+    ///        \p pixel_width pixels. When there are fewer than `level_factor` samples per
+    ///        pixel the samples themselves are returned, otherwise each bucket adds its
+    ///        min and max at the bucket center.
+    [[nodiscard( "Const getter" )]]
+    auto envelope( math::Range< float64 > const& x_limits, int32 pixel_width ) const
+        -> LineEnvelope< T >;
+
+private:
+    struct Level
+    {
+        std::vector< T > min = { };
+        std::vector< T > max = { };
+    };
+
+    std::vector< T > values_ = { };
+    float64          x_start_ = 0.0;
+    float64          x_step_  = 1.0;
+
+    /// \brief `levels_[ k ]` holds buckets of `level_factor^(k + 1)` samples.
+    std::vector< Level > levels_ = { };
+};
+
+} // namespace ltb::gui
@@ -0,0 +1,38 @@
+#pragma once
+
+// project
+#include "ltb/gui/imgui.hpp"
+#include "ltb/gui/line_lod.hpp"
+#include "ltb/utils/ring_buffer.hpp"
+
+namespace ltb::gui
+{
+
+/// \brief `ImPlot::PlotLine` for a long series, drawing only the envelope of \p lod needed
+///        for the current axis limits and plot width. Call between `BeginPlot`/`EndPlot`.
+template < typename T >
+auto plot_line( char const* label, LineLod< T > const& lod ) -> void;
+
+/// \brief `ImPlot::PlotLine` read straight out of \p samples, oldest first, with sample `i`
+///        at `x_start + i * x_step`. Nothing is copied: when the view holds several samples
+///        per pixel, the min and max of each pixel's samples are found as ImPlot asks for
+///        them. Call between `BeginPlot`/`EndPlot`.
+template < typename T >
+auto plot_line(
+    char const*                   label,
+    utils::RingBuffer< T > const& samples,
+    float64                       x_start,
+    float64                       x_step
+) -> void;
+
+/// \brief `ImGui::PlotLines` for a long series, drawing the envelope of \p lod at the
+///        width of the graph.
+auto plot_lines(
+    char const*               label,
+    LineLod< float32 > const& lod,
+    float32                   scale_min,
+    float32                   scale_max,
+    ImVec2                    graph_size
+) -> void;
+
+} // namespace ltb::gui
@@ -0,0 +1,31 @@
+#pragma once
+
+namespace ltb::ils
+{
+
+/// \brief Constants shared by `ils.frag` and the CPU ILS evaluators.
+template < typename T >
+class Constants
+{
+public:
+    static constexpr auto speed_of_light_m_us( ) { return T( 299.792458 ); }
+
+    static constexpr auto localizer_frequency_mhz( ) { return T( 110.1 ); }
+
+    /// \brief Scale of the inverse-square falloff (`power` in `ils.frag`).
+    static constexpr auto antenna_power( ) { return T( 100'000.0 ); }
+
+    /// \brief DDM at the edge of the localizer course sector (full scale, 150 µA).
+    static constexpr auto course_sector_ddm( ) { return T( 0.155 ); }
+
+    /// \brief The glide slope channel paired with the 110.1 MHz localizer.
+    static constexpr auto glide_slope_frequency_mhz( ) { return T( 334.4 ); }
+
+    /// \brief DDM at the edge of the glide path sector (full scale, 150 µA), reached
+    ///        `glide_path_sector_fraction()` of the path angle above and below the path.
+    static constexpr auto glide_path_sector_ddm( ) { return T( 0.0875 ); }
+
+    static constexpr auto glide_path_sector_fraction( ) { return T( 0.12 ); }
+};
+
+} // namespace ltb::ils
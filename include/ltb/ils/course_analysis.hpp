@@ -0,0 +1,88 @@
+#pragma once
+
+// project
+#include "ltb/ils/constants.hpp"
+#include "ltb/ils/field_evaluator.hpp"
+#include "ltb/math/range.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// standard
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace ltb::ils
+{
+
+/// \brief Owning structure-of-arrays world positions (meters).
+struct Points
+{
+    std::vector< float32 > x_m = { };
+    std::vector< float32 > y_m = { };
+    /// \brief Optional heights, see `PointsView::z_m`.
+    std::vector< float32 > z_m = { };
+
+    [[nodiscard( "Const getter" )]]
+    auto view( ) const -> PointsView;
+};
+
+/// \brief \p count evenly spaced values from `range.min` to `range.max`, inclusive.
+auto linspace( math::Range< float32 > const& range, std::size_t count ) -> std::vector< float32 >;
+
+/// \brief Points on arcs of constant range around the center of the array.
+///
+/// Angles are measured from the approach course (+x) toward +y. The points are
+/// arc-major: point `arc * angles_rad.size() + a` is at `ranges_m[arc]`, `angles_rad[a]`.
+auto arc_points( std::span< float32 const > ranges_m, std::span< float32 const > angles_rad )
+    -> Points;
+
+/// \brief Points along radials from the center of the array, radial-major:
+///        point `radial * ranges_m.size() + r` is at `angles_rad[radial]`, `ranges_m[r]`.
+auto radial_points( std::span< float32 const > angles_rad, std::span< float32 const > ranges_m )
+    -> Points;
+
+/// \brief Evaluate the DDM at every point. \p params is always evaluated with
+///        `Summation::Phasor` since DDM is not defined for pairwise summation.
+auto evaluate_ddm( FieldParams params, PointsView points, std::span< float32 > ddm )
+    -> utils::Result< void >;
+
+/// \brief Course structure measured along one arc.
+struct CourseReport
+{
+    /// \brief Angle of the DDM zero crossing closest to the approach course.
+    float32 course_line_rad = 0.0F;
+
+    /// \brief Angle from the course line to the full-scale DDM on the +y side.
+    float32 positive_half_width_rad = 0.0F;
+
+    /// \brief Angle from the course line to the full-scale DDM on the -y side.
+    float32 negative_half_width_rad = 0.0F;
+
+    /// \brief Angle between the two full-scale DDM points.
+    float32 course_width_rad = 0.0F;
+
+    /// \brief Largest deviation inside the sector from a DDM that grows linearly from
+    ///        the course line to each edge, as a fraction of the full-scale DDM.
+    float32 linearity_error = 0.0F;
+};
+
+/// \brief Measure the course sector from DDM samples at ascending \p angles_rad.
+///        Returns `std::nullopt` when the samples do not contain a course line with
+///        a full-scale DDM on both sides of it.
+auto analyze_arc(
+    std::span< float32 const > angles_rad,
+    std::span< float32 const > ddm,
+    float32                    sector_ddm = Constants< float32 >::course_sector_ddm( )
+) -> std::optional< CourseReport >;
+
+/// \brief Evaluate and analyze one arc per range in parallel.
+/// \param angles_rad Ascending angles sampled on every arc.
+/// \return One report per range, in the same order as \p ranges_m.
+auto analyze_arcs(
+    FieldParams const&         params,
+    std::span< float32 const > ranges_m,
+    std::span< float32 const > angles_rad
+) -> utils::Result< std::vector< std::optional< CourseReport > > >;
+
+} // namespace ltb::ils
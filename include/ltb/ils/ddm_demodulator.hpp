@@ -0,0 +1,70 @@
+#pragma once
+
+// project
+#include "ltb/dsp/baseband.hpp"
+#include "ltb/dsp/tone_bank.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// standard
+#include <span>
+
+namespace ltb::ils
+{
+
+/// \brief Caller-owned storage for one value per sample in each span. All spans must be
+///        the same size.
+struct ReceiverOutput
+{
+    /// \brief Amplitude of the received RF envelope.
+    std::span< float32 > envelope;
+    /// \brief Demodulated depth of modulation of the 90 Hz tone.
+    std::span< float32 > ninety_hz;
+    /// \brief Demodulated depth of modulation of the 150 Hz tone.
+    std::span< float32 > one_fifty_hz;
+    /// \brief `ninety_hz - one_fifty_hz`.
+    std::span< float32 > ddm;
+};
+
+/// \brief Measures the depth of the 90 Hz and 150 Hz tones on an AM envelope, whether it
+///        comes from the simulated field or a recording.
+///
+/// Each tone's depth is its amplitude relative to the mean envelope, both tracked by a
+/// `dsp::ToneBank` over one 30 Hz period, in which both tones complete whole cycles. The
+/// outputs settle after the first period. State carries over between calls to
+/// `process()`.
+class DdmDemodulator
+{
+public:
+    DdmDemodulator( ) = default;
+
+    /// \param sample_rate_hz Must be a multiple of 30 Hz.
+    /// \param start_time_s The time of sample 0, which sets the phase of the references.
+    DdmDemodulator( float64 sample_rate_hz, float64 start_time_s = 0.0 );
+
+    /// \brief The number of samples demodulated so far.
+    [[nodiscard( "Const getter" )]]
+    auto sample_count( ) const -> std::size_t;
+
+    /// \brief Demodulate the next `envelope.size()` samples, which are also copied to
+    ///        `output.envelope`. \p envelope may be `output.envelope` itself.
+    auto process( std::span< float32 const > envelope, ReceiverOutput const& output )
+        -> utils::Result< void >;
+
+    /// \brief Like `process()`, but from complex baseband. The envelope is its magnitude,
+    ///        so a carrier offset doesn't matter.
+    auto process_iq( std::span< dsp::Iq const > iq, ReceiverOutput const& output )
+        -> utils::Result< void >;
+
+    /// \brief Demodulate one sample, for callers that produce the envelope a sample at a
+    ///        time. Returns the 90 Hz and 150 Hz depths.
+    auto demodulate( float64 envelope ) -> glm::vec2;
+
+private:
+    // The mean, then the 90 Hz and 150 Hz tones.
+    dsp::ToneBank tones_ = dsp::ToneBank{ { } };
+
+    auto check( std::size_t samples, ReceiverOutput const& output ) const -> utils::Result< void >;
+};
+
+} // namespace ltb::ils
@@ -0,0 +1,50 @@
+#pragma once
+
+// project
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/glm.hpp>
+
+// standard
+#include <vector>
+
+namespace ltb::ils
+{
+
+/// \brief The largest array `ils.frag` accepts (`max_antennas` in the shader).
+constexpr auto max_antenna_count = 24_UZ;
+
+/// \brief How the per-antenna contributions are combined at each point.
+enum class Summation
+{
+    /// \brief Sum `length(i + j)` and `length(i - j)` over every antenna pair. O(N²).
+    Pairwise,
+    /// \brief Sum each element's CSB and SBO phasors once. O(N).
+    Phasor,
+};
+
+/// \brief The CSB and SBO feed of a single antenna element.
+struct ElementExcitation
+{
+    float32 csb_amplitude = 1.0F;
+    float32 csb_phase_rad = 0.0F;
+    float32 sbo_amplitude = 0.0F;
+    float32 sbo_phase_rad = 0.0F;
+
+    auto operator==( ElementExcitation const& ) const -> bool = default;
+};
+
+/// \brief A uniform CSB feed with an antisymmetric SBO feed shifted by 90°, matching
+///        the "SBO 1" and "SBO 2" phase plots in `IlsApp`. Element 0 is the lowest
+///        antenna on the y axis.
+auto default_excitations( int32 antenna_pairs ) -> std::vector< ElementExcitation >;
+
+/// \brief The complex CSB (xy) and SBO (zw) feed of an element, as the shader uses it.
+auto excitation_phasors( ElementExcitation const& excitation ) -> glm::vec4;
+
+/// \brief Difference in depth of modulation from the received CSB and SBO phasors.
+///        Only the part of the SBO in phase with the CSB carrier is detected.
+auto ddm( glm::vec2 csb, glm::vec2 sbo ) -> float32;
+
+} // namespace ltb::ils
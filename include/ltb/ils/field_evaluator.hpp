@@ -0,0 +1,133 @@
+#pragma once
+
+// project
+#include "ltb/ils/excitation.hpp"
+#include "ltb/ils/multipath.hpp"
+#include "ltb/math/range.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/glm.hpp>
+
+// standard
+#include <span>
+#include <vector>
+
+namespace ltb::ils
+{
+
+/// \brief The uniforms `ils.frag` uses to generate the localizer field.
+struct FieldParams
+{
+    float32   pixel_size_m      = 1.0F;
+    int32     antenna_pairs     = 1;
+    float32   antenna_spacing_m = 5.0F;
+    glm::vec3 output_scale      = { 0.1F, 0.0F, 0.0F };
+
+    Summation summation = Summation::Pairwise;
+
+    /// \brief Per-element feeds used by `Summation::Phasor`. When empty,
+    ///        `default_excitations( antenna_pairs )` is used.
+    std::vector< ElementExcitation > excitations = { };
+
+    /// \brief Height of the array above the ground (z = 0).
+    float32 antenna_height_m = 0.0F;
+    /// \brief Height of the evaluated plane. `PointsView::z_m` overrides it per point.
+    float32 receiver_height_m = 0.0F;
+
+    /// \brief Planar reflectors, each adding one image source per antenna in front of it.
+    ///        Only evaluated on the CPU; `ils.frag` renders the direct field.
+    std::vector< Reflector > reflectors = { };
+
+    auto operator==( FieldParams const& ) const -> bool = default;
+};
+
+/// \brief Caller-owned storage for the field values. All spans are row-major with
+///        the bottom row first, matching `gl_FragCoord` and `glReadPixels`.
+struct FieldOutput
+{
+    /// \brief CSB magnitude (`signal.y` in `ils.frag`).
+    std::span< float32 > csb;
+    /// \brief SBO magnitude (`signal.z` in `ils.frag`).
+    std::span< float32 > sbo;
+    /// \brief Optional DDM (`signal.x` in phasor mode). Leave empty to skip.
+    std::span< float32 > ddm = { };
+};
+
+/// \brief Structure-of-arrays world positions (meters), in the same frame as
+///        `FieldEvaluator::evaluate_point`. All non-empty spans must be the same size.
+struct PointsView
+{
+    std::span< float32 const > x_m;
+    std::span< float32 const > y_m;
+    /// \brief Optional heights. When empty, `FieldParams::receiver_height_m` is used.
+    std::span< float32 const > z_m = { };
+};
+
+/// \brief Evaluates the `ils.frag` localizer field on the CPU without a GL context.
+///
+/// Rows are split into blocks that are evaluated in parallel. Within a row, each
+/// antenna's phasor is computed once for the whole row and then combined either
+/// pairwise (like the original shader) or as a single phasor sum per point, in
+/// contiguous loops the compiler can vectorize. Reflections are added to each
+/// antenna's row as image sources, masked by whether each point sees the reflector.
+class FieldEvaluator
+{
+public:
+    FieldEvaluator( ) = default;
+    explicit FieldEvaluator( FieldParams params );
+
+    auto set_params( FieldParams params ) -> void;
+
+    [[nodiscard( "Const getter" )]]
+    auto params( ) const -> FieldParams const&;
+
+    /// \brief Evaluate the CSB, SBO, and optionally DDM values for every pixel in \p region.
+    /// \param field_size_pixels The size of the whole field (`field_size_pixels` uniform).
+    /// \param region The pixels to evaluate, [min, max) in field pixel coordinates.
+    /// \param output Storage for `dimensions(region).x * dimensions(region).y` values.
+    auto evaluate(
+        glm::ivec2            field_size_pixels,
+        math::Range2Di const& region,
+        FieldOutput           output
+    ) const -> utils::Result< void >;
+
+    /// \brief Evaluate the CSB, SBO, and optionally DDM values for every pixel in the field.
+    auto evaluate( glm::ivec2 field_size_pixels, FieldOutput output ) const
+        -> utils::Result< void >;
+
+    /// \brief Evaluate the CSB, SBO, and optionally DDM values at arbitrary world positions.
+    /// \param points The positions to evaluate, in meters.
+    /// \param output Storage for one value per point, in the same order as \p points.
+    auto evaluate_points( PointsView points, FieldOutput output ) const -> utils::Result< void >;
+
+    /// \brief Evaluate the unclamped RGB colors `ils.frag` writes for every pixel in \p region.
+    auto evaluate_colors(
+        glm::ivec2             field_size_pixels,
+        math::Range2Di const&  region,
+        std::span< glm::vec3 > colors
+    ) const -> utils::Result< void >;
+
+    /// \brief Evaluate the unclamped RGB colors `ils.frag` writes for every pixel.
+    auto evaluate_colors( glm::ivec2 field_size_pixels, std::span< glm::vec3 > colors ) const
+        -> utils::Result< void >;
+
+    /// \brief The shader's `signal` at a single world position (meters):
+    ///        x is 1 (pairwise) or the DDM (phasor), y is CSB and z is SBO.
+    [[nodiscard( "Const getter" )]]
+    auto evaluate_point( glm::vec2 position_m ) const -> glm::vec3;
+
+    /// \brief The `signal` at a position with an explicit height.
+    [[nodiscard( "Const getter" )]]
+    auto evaluate_point( glm::vec3 position_m ) const -> glm::vec3;
+
+    /// \brief The color `ils.frag` writes for the given `signal`.
+    [[nodiscard( "Const getter" )]]
+    auto color( glm::vec3 signal ) const -> glm::vec3;
+
+private:
+    FieldParams params_ = { };
+};
+
+} // namespace ltb::ils
@@ -0,0 +1,46 @@
+#pragma once
+
+// project
+#include "ltb/ils/field_evaluator.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/tiled_field.hpp"
+
+// external
+#include <glm/glm.hpp>
+
+// standard
+#include <filesystem>
+
+namespace ltb::ils
+{
+
+/// \brief The channels of an exported field file, in file order. `Ddm` is only written
+///        for `Summation::Phasor`.
+enum class FieldChannel : int32
+{
+    Csb,
+    Sbo,
+    Ddm,
+};
+
+/// \brief The tiled file layout `export_field` writes for \p params, with the pixel centers
+///        in the same world positions `FieldEvaluator::evaluate` uses.
+auto field_export_layout(
+    FieldParams const& params,
+    glm::ivec2         field_size_pixels,
+    glm::ivec2         tile_size = { 256, 256 }
+) -> utils::TiledFieldLayout;
+
+/// \brief Evaluate the whole field and stream it to a tiled field file at \p path.
+///
+/// Only one band of tile-height rows is held in memory at a time, so fields far larger
+/// than memory (16k x 16k and up) can be exported and then read back with
+/// `utils::TiledFieldReader`.
+auto export_field(
+    FieldEvaluator const&        evaluator,
+    glm::ivec2                   field_size_pixels,
+    std::filesystem::path const& path,
+    glm::ivec2                   tile_size = { 256, 256 }
+) -> utils::Result< void >;
+
+} // namespace ltb::ils
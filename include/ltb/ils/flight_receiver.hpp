@@ -0,0 +1,119 @@
+#pragma once
+
+// project
+#include "ltb/dsp/impairments.hpp"
+#include "ltb/dsp/oscillator.hpp"
+#include "ltb/ils/ddm_demodulator.hpp"
+#include "ltb/ils/field_evaluator.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// standard
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace ltb::ils
+{
+
+/// \brief A time-stamped aircraft trajectory, structure-of-arrays. Positions are in the
+///        field frame (meters) and linearly interpolated between samples; the receiver
+///        holds the first or last position outside the time span. All spans must be the
+///        same, non-zero size, with increasing times.
+struct TrajectoryView
+{
+    std::span< float64 const > time_s;
+    std::span< float32 const > x_m;
+    std::span< float32 const > y_m;
+    std::span< float32 const > z_m;
+};
+
+struct ReceiverParams
+{
+    /// \brief Must be a multiple of 30 Hz so the demodulation window holds whole
+    ///        cycles of both tones.
+    float64 sample_rate_hz = 48'000.0;
+
+    /// \brief The time of the first sample.
+    float64 start_time_s = 0.0;
+
+    /// \brief Depth of each tone on the CSB carrier.
+    float32 modulation_depth = 0.2F;
+
+    /// \brief The field is evaluated every this many samples and linearly interpolated
+    ///        between. The aircraft moves millimetres per sample, far below the scale the
+    ///        field changes over.
+    std::size_t field_update_samples = 32;
+
+    /// \brief Samples produced per internal block.
+    std::size_t block_size = 4'096;
+
+    /// \brief Noise and interference added to the envelope before it is demodulated.
+    dsp::ImpairmentParams impairments = { };
+
+    auto operator==( ReceiverParams const& ) const -> bool = default;
+};
+
+/// \brief Flies a receiver through the localizer field, one block of samples at a time.
+///
+/// Each element radiates the CSB `C (1 + m sin(90 Hz) + m sin(150 Hz))` and the SBO
+/// `S (sin(90 Hz) - sin(150 Hz))`, where C and S are the received phasors from the field.
+/// The receiver envelope-detects the sum and measures each tone's depth with a
+/// `DdmDemodulator`, so the DDM matches `ddm()` of the field once the demodulator settles.
+///
+/// State carries over between calls to `process()`, so a long flight can be streamed
+/// through in pieces without storing the whole signal.
+class FlightReceiver
+{
+public:
+    FlightReceiver( FieldParams field, ReceiverParams params );
+
+    [[nodiscard( "Const getter" )]]
+    auto params( ) const -> ReceiverParams const&;
+
+    /// \brief The number of samples produced so far.
+    [[nodiscard( "Const getter" )]]
+    auto sample_count( ) const -> std::size_t;
+
+    /// \brief The time of the next sample.
+    [[nodiscard( "Const getter" )]]
+    auto time_s( ) const -> float64;
+
+    /// \brief Produce the next `output.envelope.size()` samples.
+    /// \param trajectory Positions covering the time of those samples.
+    auto process( TrajectoryView trajectory, ReceiverOutput output ) -> utils::Result< void >;
+
+private:
+    FieldEvaluator evaluator_;
+    ReceiverParams params_;
+
+    std::size_t sample_count_ = 0;
+
+    dsp::Oscillator  ninety_hz_    = { };
+    dsp::Oscillator  one_fifty_hz_ = { };
+    DdmDemodulator   demodulator_  = { };
+    dsp::Impairments impairments_  = { };
+
+    // Scratch space for the field nodes of one block. After evaluation, `node_sbo_`
+    // and `node_ddm_` are replaced by the imaginary and real parts of S / C.
+    std::vector< float32 > node_x_m_ = { };
+    std::vector< float32 > node_y_m_ = { };
+    std::vector< float32 > node_z_m_ = { };
+    std::vector< float32 > node_csb_ = { };
+    std::vector< float32 > node_sbo_ = { };
+    std::vector< float32 > node_ddm_ = { };
+
+    auto process_block( TrajectoryView const& trajectory, ReceiverOutput const& output )
+        -> utils::Result< void >;
+};
+
+/// \brief Fly \p trajectory from its first to its last time stamp, handing each block of
+///        samples to \p on_block as it is produced.
+auto simulate_flight(
+    FieldParams const&                             field,
+    ReceiverParams const&                          params,
+    TrajectoryView const&                          trajectory,
+    std::function< void( ReceiverOutput const& ) > on_block
+) -> utils::Result< void >;
+
+} // namespace ltb::ils
@@ -0,0 +1,65 @@
+#pragma once
+
+// project
+#include "ltb/ils/field_evaluator.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/glm.hpp>
+
+namespace ltb::ils
+{
+
+/// \brief A null-reference glide slope: a CSB antenna and an SBO antenna at twice its
+///        height on one mast, in the same frame as the localizer field.
+struct GlideSlopeParams
+{
+    float32 glide_path_rad = glm::radians( 3.0F );
+
+    /// \brief The foot of the mast. The localizer is at the origin and the approach
+    ///        comes in along +x, so the mast stands beside the touchdown zone.
+    glm::vec2 mast_position_m = { 3'000.0F, 120.0F };
+
+    /// \brief Complex reflection coefficient of the ground at z = 0. The glide path is
+    ///        formed by the interference of each antenna with its ground image.
+    glm::vec2 ground_coefficient = { -1.0F, 0.0F };
+
+    auto operator==( GlideSlopeParams const& ) const -> bool = default;
+};
+
+/// \brief The height of the CSB antenna, where its first lobe peaks at the glide path angle.
+///        The SBO antenna is twice as high, putting its first null on the glide path.
+auto csb_antenna_height_m( GlideSlopeParams const& params ) -> float32;
+
+/// \brief Evaluates the glide slope CSB, SBO, and DDM at arbitrary 3D positions.
+///
+/// Each antenna and its ground image radiate with the same inverse-square falloff as the
+/// localizer. The SBO feed is scaled so that over a perfect ground the DDM reaches the
+/// full-scale `Constants::glide_path_sector_ddm()` at the sector edges. The DDM is positive
+/// above the path, where the 90 Hz tone predominates.
+class GlideSlopeEvaluator
+{
+public:
+    GlideSlopeEvaluator( ) = default;
+    explicit GlideSlopeEvaluator( GlideSlopeParams params );
+
+    auto set_params( GlideSlopeParams params ) -> void;
+
+    [[nodiscard( "Const getter" )]]
+    auto params( ) const -> GlideSlopeParams const&;
+
+    /// \brief Evaluate the CSB, SBO, and optionally DDM values at every point.
+    /// \param points The positions to evaluate, in meters. Heights are required.
+    /// \param output Storage for one value per point, in the same order as \p points.
+    auto evaluate_points( PointsView points, FieldOutput output ) const -> utils::Result< void >;
+
+    /// \brief (DDM, CSB, SBO) at a single world position (meters).
+    [[nodiscard( "Const getter" )]]
+    auto evaluate_point( glm::vec3 position_m ) const -> glm::vec3;
+
+private:
+    GlideSlopeParams params_ = { };
+};
+
+} // namespace ltb::ils
@@ -0,0 +1,50 @@
+#pragma once
+
+// project
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/glm.hpp>
+
+// standard
+#include <limits>
+
+namespace ltb::ils
+{
+
+/// \brief A rectangular planar reflector (ground, hangar face, terrain facet).
+///
+/// Reflections are modelled with image theory. Each antenna in front of the plane is
+/// mirrored across it, and the mirrored source reaches every point in front of the plane
+/// whose specular point lies inside the rectangle, scaled by the reflection coefficient.
+struct Reflector
+{
+    glm::vec3 center_m = { 0.0F, 0.0F, 0.0F };
+
+    /// \brief Unit normal pointing to the reflecting side.
+    glm::vec3 normal = { 0.0F, 0.0F, 1.0F };
+
+    /// \brief Unit in-plane axis of `half_size_m.x`.
+    ///        `half_size_m.y` runs along `normal × tangent`.
+    glm::vec3 tangent = { 1.0F, 0.0F, 0.0F };
+
+    glm::vec2 half_size_m = glm::vec2( std::numeric_limits< float32 >::infinity( ) );
+
+    /// \brief Complex reflection coefficient.
+    glm::vec2 coefficient = { -1.0F, 0.0F };
+
+    auto operator==( Reflector const& ) const -> bool = default;
+};
+
+/// \brief The infinite ground plane at z = 0, reflecting upward.
+auto ground_plane( glm::vec2 coefficient ) -> Reflector;
+
+/// \brief A vertical wall standing on the ground along the segment \p start_m to \p end_m.
+///        It reflects toward the left of the direction from start to end.
+auto vertical_wall( glm::vec2 start_m, glm::vec2 end_m, float32 height_m, glm::vec2 coefficient )
+    -> Reflector;
+
+/// \brief \p point mirrored across the plane of \p reflector.
+auto mirror( glm::vec3 point, Reflector const& reflector ) -> glm::vec3;
+
+} // namespace ltb::ils
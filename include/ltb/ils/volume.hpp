@@ -0,0 +1,149 @@
+#pragma once
+
+// project
+#include "ltb/ils/course_analysis.hpp"
+#include "ltb/ils/field_evaluator.hpp"
+#include "ltb/ils/glide_slope.hpp"
+#include "ltb/math/mesh.hpp"
+#include "ltb/math/range.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/glm.hpp>
+
+// standard
+#include <limits>
+#include <span>
+
+namespace ltb::ils
+{
+
+/// \brief Voxel centers on a regular grid filling `bounds_m`. Voxels are ordered x-fastest,
+///        then y, then z, so each horizontal layer is contiguous.
+struct VoxelGrid
+{
+    math::Range< glm::vec3 > bounds_m = {
+        .min = { 0.0F, -1'000.0F, 0.0F },
+        .max = { 10'000.0F, 1'000.0F, 1'000.0F },
+    };
+    glm::ivec3 size = { 100, 40, 20 };
+
+    auto operator==( VoxelGrid const& ) const -> bool = default;
+};
+
+auto voxel_count( VoxelGrid const& grid ) -> std::size_t;
+
+/// \brief The voxel centers of layers [`first_layer`, `first_layer + layer_count`).
+auto layer_points( VoxelGrid const& grid, int32 first_layer, int32 layer_count ) -> Points;
+
+/// \brief A rectangle through the volume, sampled at the centers of a `size` grid of cells.
+///        Samples are ordered `u`-fastest. The plane can have any orientation, e.g. the
+///        vertical plane through the approach course for the glide path.
+struct Slice
+{
+    glm::vec3  corner_m   = { 0.0F, 0.0F, 0.0F };
+    glm::vec3  u_extent_m = { 10'000.0F, 0.0F, 0.0F };
+    glm::vec3  v_extent_m = { 0.0F, 0.0F, 1'000.0F };
+    glm::ivec2 size       = { 256, 64 };
+
+    auto operator==( Slice const& ) const -> bool = default;
+};
+
+auto slice_points( Slice const& slice ) -> Points;
+
+/// \brief The localizer and glide slope of one runway, in the localizer field frame.
+struct VolumeParams
+{
+    /// \brief Always evaluated with `Summation::Phasor`. Add `ground_plane()` to its
+    ///        reflectors for the localizer's ground image.
+    FieldParams      localizer   = { .summation = Summation::Phasor };
+    GlideSlopeParams glide_slope = { };
+
+    auto operator==( VolumeParams const& ) const -> bool = default;
+};
+
+/// \brief Caller-owned storage for one value per sample. Empty spans are skipped.
+struct VolumeOutput
+{
+    std::span< float32 > localizer_csb   = { };
+    std::span< float32 > localizer_ddm   = { };
+    std::span< float32 > glide_slope_csb = { };
+    std::span< float32 > glide_slope_ddm = { };
+};
+
+/// \brief Evaluates the localizer and glide slope together anywhere in 3D.
+///
+/// Voxel grids are evaluated a batch of layers at a time, so the positions and scratch
+/// space never grow past one batch however large the volume. Each batch is split into
+/// blocks that are evaluated in parallel.
+class VolumeEvaluator
+{
+public:
+    VolumeEvaluator( ) = default;
+    explicit VolumeEvaluator( VolumeParams params );
+
+    auto set_params( VolumeParams params ) -> void;
+
+    [[nodiscard( "Const getter" )]]
+    auto params( ) const -> VolumeParams const&;
+
+    /// \brief Evaluate arbitrary positions. Heights are required.
+    auto evaluate_points( PointsView points, VolumeOutput output ) const -> utils::Result< void >;
+
+    /// \brief Evaluate every voxel, with \p output holding `voxel_count( grid )` values.
+    auto evaluate( VoxelGrid const& grid, VolumeOutput output ) const -> utils::Result< void >;
+
+    /// \brief Evaluate every slice sample, with \p output holding `size.x * size.y` values.
+    auto evaluate( Slice const& slice, VolumeOutput output ) const -> utils::Result< void >;
+
+private:
+    VolumeParams        params_      = { };
+    FieldEvaluator      localizer_   = FieldEvaluator{ params_.localizer };
+    GlideSlopeEvaluator glide_slope_ = GlideSlopeEvaluator{ params_.glide_slope };
+};
+
+/// \brief Minimum CSB magnitudes, in the units of `FieldOutput::csb`. A single element
+///        delivers 1e-3 at 10 km.
+struct CoverageRequirements
+{
+    float32 localizer_min_csb   = 1.0e-3F;
+    float32 glide_slope_min_csb = 1.0e-3F;
+
+    auto operator==( CoverageRequirements const& ) const -> bool = default;
+};
+
+struct CoverageReport
+{
+    std::size_t voxel_count         = 0;
+    std::size_t localizer_covered   = 0;
+    std::size_t glide_slope_covered = 0;
+    std::size_t both_covered        = 0;
+
+    /// \brief The weakest CSB anywhere in the volume.
+    float32 localizer_min_csb   = std::numeric_limits< float32 >::infinity( );
+    float32 glide_slope_min_csb = std::numeric_limits< float32 >::infinity( );
+};
+
+/// \brief Count the voxels where each CSB meets \p requirements, without storing the volume.
+auto check_coverage(
+    VolumeEvaluator const&      evaluator,
+    VoxelGrid const&            grid,
+    CoverageRequirements const& requirements
+) -> utils::Result< CoverageReport >;
+
+/// \brief Blue where 150 Hz predominates (negative DDM) through white to yellow where
+///        90 Hz predominates, saturating at \p full_scale_ddm.
+auto ddm_color( float32 ddm, float32 full_scale_ddm ) -> glm::vec3;
+
+/// \brief A `MeshFormat::Points` cloud for `gui::MeshDisplayPipeline` with one vertex per
+///        point, drawn with `ColorMode::VertexColor`. Heights are required.
+auto point_cloud( PointsView points, std::span< glm::vec3 const > colors )
+    -> utils::Result< math::Mesh3 >;
+
+/// \brief A triangulated sheet through the sample points of \p slice for
+///        `gui::MeshDisplayPipeline`, with one color per sample and uvs spanning the slice.
+auto slice_mesh( Slice const& slice, std::span< glm::vec3 const > colors )
+    -> utils::Result< math::Mesh3 >;
+
+} // namespace ltb::ils
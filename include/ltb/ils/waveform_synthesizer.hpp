@@ -0,0 +1,63 @@
+#pragma once
+
+// project
+#include "ltb/math/range.hpp"
+#include "ltb/utils/types.hpp"
+
+// standard
+#include <optional>
+#include <vector>
+
+namespace ltb::ils
+{
+
+/// \brief Settings for the illustrative "Transmitted Waves" plots. The frequencies are
+///        in cycles per window unit, scaled down so individual cycles stay visible.
+struct WaveformParams
+{
+    float64                carrier_frequency      = 30.0;
+    float64                ninety_hz_frequency    = 0.9;
+    float64                one_fifty_hz_frequency = 1.5;
+    float64                modulation_depth       = 0.2;
+    math::Range< float64 > window                 = { .min = 0.0, .max = 2.0 };
+    std::size_t            sample_count           = 8192;
+
+    auto operator==( WaveformParams const& ) const -> bool = default;
+};
+
+/// \brief Sampled CSB and SBO signal components, one value per sample in each.
+struct TransmittedWaves
+{
+    std::vector< float32 > carrier       = { };
+    std::vector< float32 > ninety_hz     = { };
+    std::vector< float32 > one_fifty_hz  = { };
+    std::vector< float32 > csb_audio     = { };
+    std::vector< float32 > csb_modulated = { };
+    std::vector< float32 > csb_signal    = { };
+    std::vector< float32 > sbo_audio     = { };
+    std::vector< float32 > sbo_modulated = { };
+    std::vector< float32 > sbo_shifted   = { };
+};
+
+/// \brief Keeps the transmitted waveforms in persistent buffers and only resynthesizes
+///        them when the parameters change.
+///
+/// Each tone is generated by rotating a unit phasor by a fixed angle per sample rather
+/// than calling `std::sin` per sample. The carrier phasor's real part is the 90° shifted
+/// carrier used by the SBO, so it is also free.
+class WaveformSynthesizer
+{
+public:
+    /// \brief Resynthesize the waves if \p params differ from the last call.
+    /// \return true if the waves were recomputed.
+    auto update( WaveformParams const& params ) -> bool;
+
+    [[nodiscard( "Const getter" )]]
+    auto waves( ) const -> TransmittedWaves const&;
+
+private:
+    std::optional< WaveformParams > params_ = std::nullopt;
+    TransmittedWaves                waves_  = { };
+};
+
+} // namespace ltb::ils
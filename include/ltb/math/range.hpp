@@ -11,6 +11,8 @@ struct Range
 {
     T min = { };
     T max = { };
+
+    auto operator==( Range const& ) const -> bool = default;
 };
 
 template < typename T >
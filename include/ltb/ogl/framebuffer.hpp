@@ -70,6 +70,18 @@ public:
         GLenum                                           filter
     ) -> void;
 
+    /// \brief Copy a region of one framebuffer to a possibly differently sized
+    ///        region of another, scaling with \p filter.
+    static auto blit(
+        Bound< Framebuffer, GL_READ_FRAMEBUFFER > const& read_framebuffer,
+        Bound< Framebuffer, GL_DRAW_FRAMEBUFFER > const& draw_framebuffer,
+        math::Range2Di const&                            read_viewport,
+        math::Range2Di const&                            draw_viewport,
+        std::vector< FramebufferAttachmentPair > const&  attachments,
+        GLbitfield                                       mask,
+        GLenum                                           filter
+    ) -> void;
+
     /// \brief Read the pixels from the currently bound framebuffer.
     /// \code
     /// ogl::Framebuffer::read_pixels(GL_COLOR_ATTACHMENT1,
@@ -10,6 +10,9 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <spdlog/spdlog.h>
 
+// standard
+#include <span>
+
 namespace ltb::ogl
 {
 
@@ -236,6 +239,26 @@ auto set(
     detail::set_scalar_or_vec< size >( uniform, glm::value_ptr( value ), 1 );
 }
 
+/// \brief Sets the values of a vector array uniform, starting at element 0.
+template < glm::length_t size, typename ValueType >
+    requires detail::IsUniformScalarType< ValueType >
+
+auto set(
+    Uniform< glm::vec< size, ValueType > > const&  uniform,
+    std::span< glm::vec< size, ValueType > const > values
+) -> void
+{
+    if ( values.empty( ) )
+    {
+        return;
+    }
+    detail::set_scalar_or_vec< size >(
+        uniform,
+        glm::value_ptr( values.front( ) ),
+        static_cast< GLsizei >( values.size( ) )
+    );
+}
+
 /// \brief Sets the value of a matrix uniform.
 template < glm::length_t size, typename ValueType >
     requires detail::IsUniformMatrixType< ValueType >
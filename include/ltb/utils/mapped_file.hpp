@@ -0,0 +1,44 @@
+#pragma once
+
+// project
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// standard
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace ltb::utils
+{
+
+/// \brief A read-only memory mapping of a whole file. Pages are only read from disk
+///        when they are first touched, so large files can be accessed randomly without
+///        loading them.
+class MappedFile
+{
+public:
+    MappedFile( ) = default;
+    ~MappedFile( );
+
+    /// \brief Map the file at \p path. An empty file maps to no bytes.
+    static auto open( std::filesystem::path const& path ) -> Result< MappedFile >;
+
+    // move only
+    MappedFile( MappedFile&& other ) noexcept;
+    auto operator=( MappedFile&& other ) noexcept -> MappedFile&;
+
+    MappedFile( MappedFile const& )                    = delete;
+    auto operator=( MappedFile const& ) -> MappedFile& = delete;
+
+    [[nodiscard( "Const getter" )]]
+    auto bytes( ) const -> std::span< std::byte const >;
+
+private:
+    std::byte const* data_ = nullptr;
+    std::size_t      size_ = 0;
+
+    auto close( ) -> void;
+};
+
+} // namespace ltb::utils
@@ -0,0 +1,144 @@
+#pragma once
+
+// project
+#include "ltb/utils/ignore.hpp"
+#include "ltb/utils/types.hpp"
+
+// standard
+#include <algorithm>
+#include <array>
+#include <span>
+#include <vector>
+
+namespace ltb::utils
+{
+
+/// \brief A fixed-capacity FIFO of samples for passing blocks between streaming stages
+///        that produce and consume different block sizes.
+///
+/// The storage is allocated once. Values are copied in and out in at most two
+/// contiguous pieces, so no per-sample bookkeeping is needed.
+template < typename T >
+class RingBuffer
+{
+public:
+    RingBuffer( ) = default;
+
+    explicit RingBuffer( std::size_t const capacity )
+        : storage_( capacity )
+    {
+    }
+
+    [[nodiscard( "Const getter" )]]
+    auto capacity( ) const -> std::size_t
+    {
+        return storage_.size( );
+    }
+
+    [[nodiscard( "Const getter" )]]
+    auto size( ) const -> std::size_t
+    {
+        return size_;
+    }
+
+    [[nodiscard( "Const getter" )]]
+    auto available( ) const -> std::size_t
+    {
+        return capacity( ) - size_;
+    }
+
+    [[nodiscard( "Const getter" )]]
+    auto empty( ) const -> bool
+    {
+        return 0 == size_;
+    }
+
+    /// \brief Append as many of \p values as fit.
+    /// \return The number of values appended.
+    auto write( std::span< T const > const values ) -> std::size_t
+    {
+        auto const count = std::min( values.size( ), available( ) );
+        if ( 0 == count )
+        {
+            return 0;
+        }
+
+        auto const tail  = ( head_ + size_ ) % capacity( );
+        auto const first = std::min( count, capacity( ) - tail );
+        std::ranges::copy(
+            values.first( first ),
+            storage_.begin( ) + static_cast< std::ptrdiff_t >( tail )
+        );
+        std::ranges::copy( values.subspan( first, count - first ), storage_.begin( ) );
+
+        size_ += count;
+        return count;
+    }
+
+    /// \brief Append all of \p values, dropping the oldest values to make room. Only the
+    ///        newest `capacity()` values are kept if \p values is larger than the buffer.
+    auto overwrite( std::span< T const > values ) -> void
+    {
+        if ( values.size( ) >= capacity( ) )
+        {
+            values = values.last( capacity( ) );
+            head_  = 0;
+            size_  = 0;
+        }
+        consume( values.size( ) - std::min( values.size( ), available( ) ) );
+        utils::ignore( write( values ) );
+    }
+
+    /// \brief Remove the oldest `values.size()` values into \p values.
+    /// \return The number of values read, less than requested if the buffer runs out.
+    auto read( std::span< T > const values ) -> std::size_t
+    {
+        auto const count    = std::min( values.size( ), size_ );
+        auto const segments = contents( );
+        auto const first    = std::min( count, segments[ 0 ].size( ) );
+        std::ranges::copy( segments[ 0 ].first( first ), values.begin( ) );
+        std::ranges::copy(
+            segments[ 1 ].first( count - first ),
+            values.begin( ) + static_cast< std::ptrdiff_t >( first )
+        );
+        consume( count );
+        return count;
+    }
+
+    /// \brief Drop the oldest \p count values.
+    auto consume( std::size_t count ) -> void
+    {
+        count = std::min( count, size_ );
+        head_ = ( 0 == capacity( ) ) ? 0 : ( head_ + count ) % capacity( );
+        size_ -= count;
+    }
+
+    auto clear( ) -> void
+    {
+        head_ = 0;
+        size_ = 0;
+    }
+
+    /// \brief The \p index-th oldest stored value.
+    [[nodiscard( "Const getter" )]]
+    auto operator[]( std::size_t const index ) const -> T const&
+    {
+        return storage_[ ( head_ + index ) % capacity( ) ];
+    }
+
+    /// \brief The stored values, oldest first, as up to two contiguous pieces.
+    [[nodiscard( "Const getter" )]]
+    auto contents( ) const -> std::array< std::span< T const >, 2 >
+    {
+        auto const storage = std::span< T const >( storage_ );
+        auto const first   = std::min( size_, capacity( ) - head_ );
+        return { storage.subspan( head_, first ), storage.first( size_ - first ) };
+    }
+
+private:
+    std::vector< T > storage_ = { };
+    std::size_t      head_    = 0;
+    std::size_t      size_    = 0;
+};
+
+} // namespace ltb::utils
@@ -0,0 +1,115 @@
+#pragma once
+
+// project
+#include "ltb/math/range.hpp"
+#include "ltb/utils/mapped_file.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/glm.hpp>
+
+// standard
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <vector>
+
+namespace ltb::utils
+{
+
+/// \brief The shape of a tiled field file.
+///
+/// The file starts with a 64 byte header followed by every tile in row-major tile order,
+/// bottom row of tiles first. Each tile is stored at the full tile size, with the tiles on
+/// the top and right edges padded with zeros, so tile `t` starts at a fixed offset of
+/// `64 + t * tile_bytes`. Within a tile each channel is a row-major float32 plane, bottom
+/// row first like `FieldOutput`. Values are little-endian.
+struct TiledFieldLayout
+{
+    glm::ivec2 size_pixels   = { 0, 0 };
+    glm::ivec2 tile_size     = { 256, 256 };
+    int32      channel_count = 1;
+
+    /// \brief Pixel `p` is centered at `origin_m + p * pixel_step_m` in the world.
+    glm::dvec2 origin_m     = { 0.0, 0.0 };
+    glm::dvec2 pixel_step_m = { 1.0, 1.0 };
+
+    auto operator==( TiledFieldLayout const& ) const -> bool = default;
+};
+
+/// \brief The number of tiles along each axis.
+auto tile_count( TiledFieldLayout const& layout ) -> glm::ivec2;
+
+/// \brief The number of values in one tile across all channels.
+auto tile_value_count( TiledFieldLayout const& layout ) -> std::size_t;
+
+/// \brief The total size of a tiled field file.
+auto tiled_field_file_size( TiledFieldLayout const& layout ) -> std::size_t;
+
+/// \brief Streams tiles into a new tiled field file without holding the field in memory.
+///        Tiles can be written in any order.
+class TiledFieldWriter
+{
+public:
+    TiledFieldWriter( ) = default;
+
+    /// \brief Create (or replace) the file at \p path, sized for every tile.
+    static auto create( std::filesystem::path const& path, TiledFieldLayout const& layout )
+        -> Result< TiledFieldWriter >;
+
+    [[nodiscard( "Const getter" )]]
+    auto layout( ) const -> TiledFieldLayout const&;
+
+    /// \brief Write one tile.
+    /// \param values `tile_value_count()` values, one full tile plane per channel.
+    auto write_tile( glm::ivec2 tile, std::span< float32 const > values ) -> Result< void >;
+
+    /// \brief Write every tile of a band of full-width rows.
+    /// \param first_row Must be a multiple of the tile height.
+    /// \param channels One row-major plane of `size_pixels.x * row_count` values per
+    ///        channel, where `row_count` is the tile height or the rows left in the field.
+    auto write_rows( int32 first_row, std::span< std::span< float32 const > const > channels )
+        -> Result< void >;
+
+    /// \brief Flush and close the file. Fails if any tile was never written.
+    auto finish( ) -> Result< void >;
+
+private:
+    std::ofstream          file_    = { };
+    TiledFieldLayout       layout_  = { };
+    std::vector< bool >    written_ = { };
+    std::vector< float32 > tile_    = { };
+};
+
+/// \brief Random access to a memory-mapped tiled field file. Only the tiles that are
+///        read are loaded from disk.
+class TiledFieldReader
+{
+public:
+    TiledFieldReader( ) = default;
+
+    static auto open( std::filesystem::path const& path ) -> Result< TiledFieldReader >;
+
+    [[nodiscard( "Const getter" )]]
+    auto layout( ) const -> TiledFieldLayout const&;
+
+    /// \brief One channel of one tile, straight from the mapping, including any padding.
+    ///        \p tile and \p channel must be in range.
+    [[nodiscard( "Const getter" )]]
+    auto tile( glm::ivec2 tile, int32 channel ) const -> std::span< float32 const >;
+
+    /// \brief A single value. \p pixel and \p channel must be in range.
+    [[nodiscard( "Const getter" )]]
+    auto value( glm::ivec2 pixel, int32 channel ) const -> float32;
+
+    /// \brief Copy one channel of \p region into \p values, row-major, bottom row first.
+    auto read( math::Range2Di const& region, int32 channel, std::span< float32 > values ) const
+        -> Result< void >;
+
+private:
+    MappedFile       file_   = { };
+    TiledFieldLayout layout_ = { };
+};
+
+} // namespace ltb::utils
@@ -0,0 +1,105 @@
+#pragma once
+
+// project
+#include "ltb/dsp/baseband.hpp"
+#include "ltb/dsp/filter.hpp"
+#include "ltb/dsp/oscillator.hpp"
+#include "ltb/dsp/tone_bank.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/glm.hpp>
+
+// standard
+#include <span>
+
+namespace ltb::vor
+{
+
+struct BearingReceiverParams
+{
+    /// \brief Must be a multiple of 30 Hz so the demodulation window holds whole cycles
+    ///        of the 30 Hz signals and the subcarrier, and fast enough for the subcarrier.
+    float64 sample_rate_hz = 48'000.0;
+
+    /// \brief The time of the first sample.
+    float64 start_time_s = 0.0;
+
+    /// \brief Cutoff of the low-pass filter that isolates the subcarrier once it has been
+    ///        mixed down to 0 Hz. It must pass the 480 Hz deviation.
+    float64 subcarrier_cutoff_hz = 2'000.0;
+
+    /// \brief Length of the subcarrier filter. Must be odd.
+    std::size_t subcarrier_filter_taps = 63;
+
+    auto operator==( BearingReceiverParams const& ) const -> bool = default;
+};
+
+/// \brief Caller-owned storage for one value per sample in each span. All spans must be
+///        the same size.
+struct BearingOutput
+{
+    /// \brief The bearing from the station in [0, 2π), clockwise from north.
+    std::span< float32 > bearing_rad;
+    /// \brief Measured AM depth of the 30 Hz variable signal.
+    std::span< float32 > variable_depth;
+    /// \brief Measured peak deviation of the subcarrier (Hz).
+    std::span< float32 > deviation_hz;
+};
+
+/// \brief Recovers the bearing from a VOR composite (see `Modulator`), one block at a time.
+///
+/// The variable signal's phase is the phase of the composite's 30 Hz tone. For the
+/// reference signal the subcarrier is mixed down to 0 Hz, low-pass filtered and passed
+/// through a phase-difference FM discriminator, whose 30 Hz tone is measured the same
+/// way. The filter and discriminator delays are removed from the reference phase. Both
+/// tones are tracked by a `dsp::ToneBank` over one 30 Hz period, which holds whole cycles
+/// of every other component, so the outputs settle after one period plus the filter
+/// length.
+///
+/// State carries over between calls to `process()`.
+class BearingReceiver
+{
+public:
+    explicit BearingReceiver( BearingReceiverParams params );
+
+    [[nodiscard( "Const getter" )]]
+    auto params( ) const -> BearingReceiverParams const&;
+
+    /// \brief The number of samples processed so far.
+    [[nodiscard( "Const getter" )]]
+    auto sample_count( ) const -> std::size_t;
+
+    /// \brief Demodulate the next `composite.size()` samples.
+    auto process( std::span< float32 const > composite, BearingOutput output )
+        -> utils::Result< void >;
+
+    /// \brief Demodulate the next `iq.size()` samples of complex baseband, such as
+    ///        `Modulator::process_iq()` produces. The envelope is detected first, so any
+    ///        carrier offset drops out.
+    auto process_iq( std::span< dsp::Iq const > iq, BearingOutput output )
+        -> utils::Result< void >;
+
+private:
+    BearingReceiverParams params_;
+    std::size_t           sample_count_ = 0;
+
+    dsp::Oscillator subcarrier_ = { };
+
+    // Isolates the mixed-down subcarrier, as real and imaginary channels.
+    dsp::FirFilter subcarrier_filter_;
+    glm::dvec2     previous_ = { 0.0, 0.0 };
+
+    // The phase the reference signal lags by through the filter and discriminator.
+    float64 reference_delay_rad_ = 0.0;
+
+    // The mean and 30 Hz tone of two channels: the composite and the discriminator
+    // output.
+    dsp::ToneBank tones_;
+
+    /// \brief The instantaneous frequency (Hz) of the filtered, mixed-down subcarrier.
+    auto discriminate( glm::dvec2 filtered ) -> float64;
+};
+
+} // namespace ltb::vor
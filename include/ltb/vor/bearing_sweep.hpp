@@ -0,0 +1,134 @@
+#pragma once
+
+// project
+#include "ltb/ils/multipath.hpp"
+#include "ltb/vor/propagation.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/glm.hpp>
+
+// standard
+#include <span>
+#include <vector>
+
+namespace ltb::vor
+{
+
+/// \brief One sideband antenna of a conventional (rotating pattern) VOR.
+struct SidebandElement
+{
+    /// \brief Position relative to the carrier antenna (meters, x east and y north).
+    glm::vec2 position_m = { 0.0F, 0.0F };
+
+    /// \brief The element radiates the sideband amplitude modulated by `cos(ωt - phase)`
+    ///        at 30 Hz, so opposite elements in antiphase form a figure-eight pattern.
+    float32 modulation_phase_rad = 0.0F;
+
+    auto operator==( SidebandElement const& ) const -> bool = default;
+};
+
+/// \brief The four-element layout `AntennaApp` draws when `VOR` is defined: the corners of
+///        a square, with each diagonal pair fed in antiphase and the two pairs in quadrature.
+/// \param half_side_m Distance from the carrier antenna to each element along x and y.
+auto square_layout( float32 half_side_m ) -> std::vector< SidebandElement >;
+
+struct StationParams
+{
+    float64 carrier_frequency_hz = 113.0e6;
+
+    /// \brief Height of the carrier and sideband antennas above the ground (z = 0).
+    float32 antenna_height_m = 5.0F;
+
+    /// \brief The sideband array. The station is aligned so that a distant receiver on the
+    ///        north radial reads a bearing of 0, as it would be during commissioning.
+    std::vector< SidebandElement > sideband_elements = square_layout( 0.25F );
+
+    /// \brief Sideband amplitude relative to the carrier, per element. Together with the
+    ///        array size it sets the 30 Hz AM depth.
+    float32 sideband_amplitude = 0.15F;
+
+    /// \brief Planar reflectors, each adding one image of every antenna in front of it.
+    std::vector< ils::Reflector > reflectors = { };
+
+    auto operator==( StationParams const& ) const -> bool = default;
+};
+
+/// \brief Receiver positions on a polar grid around the station.
+struct SweepGrid
+{
+    /// \brief Radials clockwise from north.
+    std::vector< float32 > radials_rad = { };
+    /// \brief Horizontal distances from the station.
+    std::vector< float32 > ranges_m = { };
+    /// \brief Receiver heights above the ground.
+    std::vector< float32 > altitudes_m = { };
+};
+
+/// \brief The bearing error at every grid point, altitude-major, then radial, then range,
+///        so each altitude is a row-major radials × ranges plane.
+struct BearingErrorTable
+{
+    SweepGrid grid = { };
+
+    /// \brief Measured minus true radial, wrapped to [-π, π).
+    std::vector< float32 > error_rad = { };
+
+    [[nodiscard( "Const getter" )]]
+    auto at( std::size_t altitude, std::size_t radial, std::size_t range ) const -> float32;
+
+    /// \brief The radials × ranges plane of one altitude.
+    [[nodiscard( "Const getter" )]]
+    auto altitude_plane( std::size_t altitude ) const -> std::span< float32 const >;
+};
+
+/// \brief Error statistics over one altitude of a sweep.
+struct ErrorSummary
+{
+    float32 max_abs_error_rad = 0.0F;
+    float32 rms_error_rad     = 0.0F;
+    float32 worst_radial_rad  = 0.0F;
+    float32 worst_range_m     = 0.0F;
+};
+
+/// \brief Computes the bearing a VOR receiver reads anywhere around a station.
+///
+/// The carrier and every sideband element reach the receiver along the direct path and
+/// through each reflector, with the exact near-field path lengths and a 1/r falloff. The
+/// received envelope is sampled over one 30 Hz period and its 30 Hz component gives the
+/// variable phase, as an envelope detector followed by `BearingReceiver`'s correlators
+/// would measure it. The reference phase is radiated omnidirectionally on the subcarrier,
+/// so it does not depend on the receiver position.
+class BearingSweep
+{
+public:
+    explicit BearingSweep( StationParams params );
+
+    [[nodiscard( "Const getter" )]]
+    auto params( ) const -> StationParams const&;
+
+    /// \brief The bearing (radial) read at \p position_m, in [0, 2π).
+    ///        Positions are meters from the foot of the carrier antenna, z up.
+    [[nodiscard( "Const getter" )]]
+    auto bearing( glm::dvec3 position_m ) const -> float64;
+
+    /// \brief Evaluate the bearing error at every point of \p grid, in parallel.
+    auto sweep( SweepGrid grid ) const -> utils::Result< BearingErrorTable >;
+
+private:
+    StationParams params_;
+
+    float64                                  wavenumber_         = 0.0;
+    std::vector< PathSource >                carrier_sources_    = { };
+    std::vector< std::vector< PathSource > > element_sources_    = { };
+    std::vector< std::vector< float64 > >    element_modulation_ = { };
+    float64                                  north_offset_rad_   = 0.0;
+
+    auto raw_bearing( glm::dvec3 position_m, bool direct_only ) const -> float64;
+};
+
+/// \brief Statistics of the error plane at \p altitude.
+auto summarize( BearingErrorTable const& table, std::size_t altitude ) -> ErrorSummary;
+
+} // namespace ltb::vor
@@ -0,0 +1,28 @@
+#pragma once
+
+namespace ltb::vor
+{
+
+/// \brief The conventional VOR modulation (ICAO Annex 10).
+template < typename T >
+class Constants
+{
+public:
+    static constexpr auto speed_of_light_m_s( ) { return T( 299'792'458.0 ); }
+
+    /// \brief Both the variable AM signal and the reference FM signal are 30 Hz.
+    static constexpr auto navigation_frequency_hz( ) { return T( 30.0 ); }
+
+    static constexpr auto subcarrier_frequency_hz( ) { return T( 9'960.0 ); }
+
+    /// \brief Peak deviation of the subcarrier, a modulation index of 16.
+    static constexpr auto subcarrier_deviation_hz( ) { return T( 480.0 ); }
+
+    /// \brief AM depth of the 30 Hz variable signal on the carrier.
+    static constexpr auto variable_depth( ) { return T( 0.3 ); }
+
+    /// \brief AM depth of the subcarrier on the carrier.
+    static constexpr auto subcarrier_depth( ) { return T( 0.3 ); }
+};
+
+} // namespace ltb::vor
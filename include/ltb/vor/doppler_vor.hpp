@@ -0,0 +1,126 @@
+#pragma once
+
+// project
+#include "ltb/dsp/baseband.hpp"
+#include "ltb/ils/multipath.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/types.hpp"
+#include "ltb/vor/constants.hpp"
+#include "ltb/vor/propagation.hpp"
+
+// external
+#include <glm/glm.hpp>
+
+// standard
+#include <span>
+#include <vector>
+
+namespace ltb::vor
+{
+
+/// \brief The ring radius that makes the sideband Doppler shift swing by the standard
+///        480 Hz: the commutated source moves at `2π r 30 Hz`, which is 480 wavelengths
+///        per second.
+auto doppler_ring_radius_m( float64 carrier_frequency_hz ) -> float64;
+
+struct DopplerParams
+{
+    float64 carrier_frequency_hz = 113.0e6;
+
+    /// \brief Rate of the detected composite each receiver produces.
+    float64 sample_rate_hz = 48'000.0;
+
+    /// \brief The time of the first sample.
+    float64 start_time_s = 0.0;
+
+    /// \brief Elements evenly spaced clockwise from north around the ring. Must be even so
+    ///        the two sidebands can be fed to opposite elements.
+    std::size_t element_count = 48;
+
+    float64 ring_radius_m = doppler_ring_radius_m( carrier_frequency_hz );
+
+    /// \brief Height of the carrier antenna and the ring above the ground (z = 0).
+    float32 antenna_height_m = 5.0F;
+
+    /// \brief Whether the sidebands are crossfaded between neighbouring elements, as real
+    ///        DVORs do, instead of switched abruptly.
+    bool blend = true;
+
+    /// \brief AM depth of the 30 Hz reference on the carrier.
+    float32 reference_depth = Constants< float32 >::variable_depth( );
+
+    /// \brief Amplitude of each sideband relative to the carrier, half the subcarrier depth.
+    float32 sideband_amplitude = Constants< float32 >::subcarrier_depth( ) * 0.5F;
+
+    /// \brief Planar reflectors, each adding one image of every antenna in front of it.
+    std::vector< ils::Reflector > reflectors = { };
+
+    auto operator==( DopplerParams const& ) const -> bool = default;
+};
+
+/// \brief A Doppler VOR: a central carrier antenna surrounded by a ring of sideband
+///        elements, heard by a batch of receivers.
+///
+/// The carrier is amplitude modulated by the 30 Hz reference. The upper and lower 9960 Hz
+/// sidebands are commutated around the ring in opposite elements, once every 30 Hz period,
+/// so the path length to each receiver, and with it the phase of the subcarrier, swings by
+/// `k r cos(...)`. That Doppler shift is the 30 Hz FM, with a phase that depends on the
+/// receiver's radial, so a conventional receiver such as `BearingReceiver` reads the
+/// bearing from the detected composite as it would from a `Modulator`.
+///
+/// The paths from every antenna to every receiver are computed once in `set_receivers()`.
+/// Each sample then only crossfades the few active elements, in float32 loops over
+/// contiguous receivers that the compiler vectorizes. State carries over between calls
+/// to `process()`.
+class DopplerVor
+{
+public:
+    explicit DopplerVor( DopplerParams params );
+
+    [[nodiscard( "Const getter" )]]
+    auto params( ) const -> DopplerParams const&;
+
+    /// \brief The number of samples processed so far.
+    [[nodiscard( "Const getter" )]]
+    auto sample_count( ) const -> std::size_t;
+
+    /// \brief Ring element positions relative to the carrier antenna (meters, x east and
+    ///        y north), clockwise from north.
+    [[nodiscard( "Const getter" )]]
+    auto element_positions( ) const -> std::vector< glm::vec2 >;
+
+    /// \brief Place the receivers, in meters from the foot of the carrier antenna, z up.
+    auto set_receivers( std::span< glm::vec3 const > positions_m ) -> void;
+
+    [[nodiscard( "Const getter" )]]
+    auto receiver_count( ) const -> std::size_t;
+
+    /// \brief Generate the next `composite.size() / receiver_count()` detected composite
+    ///        samples of every receiver, time-major: sample `n` of receiver `r` is
+    ///        `composite[ n * receiver_count() + r ]`.
+    auto process( std::span< float32 > composite ) -> utils::Result< void >;
+
+    /// \brief Like `process()`, but the complex baseband field at every receiver relative to
+    ///        the carrier phase, before envelope detection.
+    auto process_iq( std::span< dsp::Iq > iq ) -> utils::Result< void >;
+
+private:
+    DopplerParams params_;
+    std::size_t   sample_count_ = 0;
+
+    float64                                  wavenumber_      = 0.0;
+    std::vector< PathSource >                carrier_sources_ = { };
+    std::vector< std::vector< PathSource > > element_sources_ = { };
+    std::size_t                              receiver_count_  = 0;
+
+    // Structure-of-arrays paths, one row of `receiver_count_` values per antenna: the
+    // carrier first, then every ring element.
+    std::vector< float32 > path_re_ = { };
+    std::vector< float32 > path_im_ = { };
+
+    /// \brief The shared implementation of `process()` and `process_iq()`.
+    template < typename Sample >
+    auto synthesize( std::span< Sample > samples ) -> utils::Result< void >;
+};
+
+} // namespace ltb::vor
@@ -0,0 +1,78 @@
+#pragma once
+
+// project
+#include "ltb/dsp/baseband.hpp"
+#include "ltb/dsp/oscillator.hpp"
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/glm.hpp>
+
+// standard
+#include <span>
+
+namespace ltb::vor
+{
+
+struct ModulatorParams
+{
+    float64 sample_rate_hz = 48'000.0;
+
+    /// \brief The time of the first sample.
+    float64 start_time_s = 0.0;
+
+    /// \brief Bearing of the receiver from the station, clockwise from north.
+    float32 bearing_rad = 0.0F;
+
+    float32 variable_depth   = 0.3F;
+    float32 subcarrier_depth = 0.3F;
+
+    /// \brief How far the carrier is from the frequency `process_iq()` takes the complex
+    ///        baseband relative to, e.g. a receiver's tuning error.
+    float64 carrier_offset_hz = 0.0;
+
+    auto operator==( ModulatorParams const& ) const -> bool = default;
+};
+
+/// \brief Generates the AM envelope of a conventional VOR carrier, one block at a time:
+///
+///     1 + m_v cos(ω t - θ) + m_s cos(Ω t + β sin(ω t))
+///
+/// where ω is 30 Hz, θ the bearing, Ω the 9960 Hz subcarrier and β = 480 Hz / 30 Hz the
+/// FM index. The variable signal lags the reference signal, whose frequency deviation is
+/// `480 cos(ω t)`, by exactly the bearing.
+///
+/// The tones come from rotating phasors, so only the FM phase needs trigonometry.
+/// State carries over between calls to `process()`.
+class Modulator
+{
+public:
+    explicit Modulator( ModulatorParams params );
+
+    [[nodiscard( "Const getter" )]]
+    auto params( ) const -> ModulatorParams const&;
+
+    /// \brief Change the bearing from the next sample on, e.g. for a moving receiver.
+    auto set_bearing( float32 bearing_rad ) -> void;
+
+    /// \brief The number of samples produced so far.
+    [[nodiscard( "Const getter" )]]
+    auto sample_count( ) const -> std::size_t;
+
+    /// \brief Produce the next `composite.size()` samples.
+    auto process( std::span< float32 > composite ) -> void;
+
+    /// \brief Produce the next `iq.size()` samples as complex baseband: the composite
+    ///        turning at the carrier offset.
+    auto process_iq( std::span< dsp::Iq > iq ) -> void;
+
+private:
+    ModulatorParams params_;
+    std::size_t     sample_count_ = 0;
+
+    dsp::Oscillator navigation_ = { };
+    dsp::Oscillator subcarrier_ = { };
+    glm::dvec2      bearing_    = { 1.0, 0.0 };
+};
+
+} // namespace ltb::vor
@@ -0,0 +1,49 @@
+#pragma once
+
+// project
+#include "ltb/ils/multipath.hpp"
+#include "ltb/utils/types.hpp"
+
+// external
+#include <glm/glm.hpp>
+
+// standard
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace ltb::vor
+{
+
+/// \brief An antenna, or its image in a reflector, as seen by a receiver.
+struct PathSource
+{
+    glm::dvec3 position_m  = { 0.0, 0.0, 0.0 };
+    glm::dvec2 coefficient = { 1.0, 0.0 };
+
+    /// \brief Set for images, which only reach receivers whose specular point lies on
+    ///        the reflector.
+    std::optional< ils::Reflector > reflector = std::nullopt;
+};
+
+/// \brief 2π / λ at \p frequency_hz (radians per meter).
+auto wavenumber( float64 frequency_hz ) -> float64;
+
+/// \brief \p antenna followed by its image in every reflector it faces.
+auto path_sources( glm::vec3 antenna_m, std::span< ils::Reflector const > reflectors )
+    -> std::vector< PathSource >;
+
+/// \brief The complex field \p sources produce at \p position_m.
+///
+/// Phases are taken relative to a path of \p reference_m meters, which keeps them precise
+/// at long range, and amplitudes fall off as `reference_m / distance`, so a source
+/// \p reference_m away arrives with unit amplitude and zero phase.
+auto receive(
+    std::span< PathSource const > sources,
+    glm::dvec3                    position_m,
+    float64                       reference_m,
+    float64                       wavenumber,
+    bool                          direct_only = false
+) -> glm::dvec2;
+
+} // namespace ltb::vor
@@ -0,0 +1,74 @@
+#pragma once
+
+// project
+#include "ltb/utils/result.hpp"
+#include "ltb/utils/ring_buffer.hpp"
+#include "ltb/vor/modulator.hpp"
+
+// standard
+#include <vector>
+
+namespace ltb::vor
+{
+
+struct ScopeParams
+{
+    ModulatorParams modulator = { };
+
+    /// \brief The most recent stretch of signal that is kept.
+    float64 window_s = 2.0;
+
+    /// \brief Samples the modulator produces per block while catching up.
+    std::size_t block_size = 1'024;
+
+    auto operator==( ScopeParams const& ) const -> bool = default;
+};
+
+/// \brief A live view of the VOR composite that advances with the wall clock.
+///
+/// Each call to `advance()` only generates the samples that have elapsed since the last
+/// one, in blocks, into a ring buffer holding the newest `window_s` seconds. Memory and
+/// the work per call are bounded by the window, however long the scope runs: after a
+/// stall longer than the window the signal simply resumes where it left off.
+class Scope
+{
+public:
+    explicit Scope( ScopeParams params );
+
+    [[nodiscard( "Const getter" )]]
+    auto params( ) const -> ScopeParams const&;
+
+    /// \brief Change the bearing from the next sample on.
+    auto set_bearing( float32 bearing_rad ) -> void;
+
+    /// \brief Generate the samples covering the next \p elapsed_s seconds.
+    /// \return The number of samples generated.
+    auto advance( float64 elapsed_s ) -> utils::Result< std::size_t >;
+
+    /// \brief The newest samples, oldest first.
+    [[nodiscard( "Const getter" )]]
+    auto samples( ) const -> utils::RingBuffer< float32 > const&;
+
+    /// \brief The time of the oldest sample still held.
+    [[nodiscard( "Const getter" )]]
+    auto start_time_s( ) const -> float64;
+
+    /// \brief The time just after the newest sample.
+    [[nodiscard( "Const getter" )]]
+    auto end_time_s( ) const -> float64;
+
+    [[nodiscard( "Const getter" )]]
+    auto sample_period_s( ) const -> float64;
+
+private:
+    ScopeParams params_;
+    Modulator   modulator_;
+
+    utils::RingBuffer< float32 > samples_ = { };
+    std::vector< float32 >       block_   = { };
+
+    /// \brief Elapsed time not yet covered by a whole sample.
+    float64 pending_s_ = 0.0;
+};
+
+} // namespace ltb::vor
@@ -0,0 +1,50 @@
+#pragma once
+
+// project
+#include "ltb/dsp/impairments.hpp"
+#include "ltb/utils/result.hpp"
+#include "ltb/vor/bearing_receiver.hpp"
+#include "ltb/vor/modulator.hpp"
+
+// standard
+#include <functional>
+
+namespace ltb::vor
+{
+
+struct ChainParams
+{
+    /// \brief Samples the modulator produces per block.
+    std::size_t modulator_block_size = 1'000;
+    /// \brief Samples the receiver consumes per block.
+    std::size_t receiver_block_size = 4'096;
+
+    /// \brief Noise and interference added to each modulator block.
+    dsp::ImpairmentParams impairments = { };
+
+    auto operator==( ChainParams const& ) const -> bool = default;
+};
+
+/// \brief Time spent in each stage of `run_signal_chain`.
+struct ChainThroughput
+{
+    std::size_t sample_count             = 0;
+    float64     modulator_samples_per_s  = 0.0;
+    float64     impairment_samples_per_s = 0.0;
+    float64     receiver_samples_per_s   = 0.0;
+};
+
+/// \brief Stream \p sample_count samples from \p modulator through a ring buffer into
+///        \p receiver, handing each receiver block to \p on_block as it is demodulated.
+///
+/// The stages use their own fixed block sizes; the ring buffer holds one block of each,
+/// so memory use doesn't depend on the number of samples.
+auto run_signal_chain(
+    Modulator&                                                                  modulator,
+    BearingReceiver&                                                            receiver,
+    std::size_t                                                                 sample_count,
+    ChainParams const&                                                          params,
+    std::function< void( std::span< float32 const >, BearingOutput const& ) > on_block
+) -> utils::Result< ChainThroughput >;
+
+} // namespace ltb::vor
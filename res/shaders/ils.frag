@@ -11,21 +11,53 @@ const float loc_freq = 110.1F;// MHz
 
 const float pi = 3.14159265359F;
 
+// Keep in sync with ltb::ils::max_antenna_count
+const int max_antennas = 24;
+
+// Keep in sync with ltb::ils::Summation
+const int summation_pairwise = 0;
+const int summation_phasor   = 1;
+
 uniform float pixel_size_m = 1.0F;// m
 uniform int   antenna_pairs = 1;
 uniform float antenna_spacing_m = 5.0F;//m
+uniform float antenna_height_m = 0.0F;// m above the ground
+uniform float receiver_height_m = 0.0F;// m above the ground
 
 uniform vec3 output_scale = vec3(0.1F, 0.0F, 0.0F);
 
+uniform int summation = summation_pairwise;
+// Complex CSB (xy) and SBO (zw) feed of each element, used by phasor summation.
+uniform vec4 element_excitations[max_antennas];
+
 //uniform float time_s;
 uniform vec2 field_size_pixels;
+// Field pixels covered by each rendered pixel. Greater than 1 for coarse previews.
+uniform float frag_coord_scale = 1.0F;
 
 out vec4 frag_color;
 
-vec2 value(in vec2 position, in vec2 antenna, in float frequency) {
+// Distance from the array center (x) and the fraction of a carrier cycle left over along it (y).
+vec2 reference_phase(in vec3 position, in vec3 center, in float frequency) {
+    float reference_m  = length(position - center);
+    float microseconds = reference_m / c;
+    float cycles       = frequency * microseconds;
+    return vec2(reference_m, fract(cycles));
+}
+
+// The phase is the reference cycles shared by every antenna plus this antenna's path
+// difference from the array center. The path difference has no cancellation, so it stays
+// accurate at any range, and rounding in the shared part rotates every antenna equally.
+vec2 value(in vec3 position, in vec3 antenna, in vec3 center, in vec2 reference,
+           in float frequency) {
     float dist_meters = length(position - antenna);
-    float microseconds = dist_meters / c;
-    float phase_angle = frequency * microseconds;
+
+    // |p - a| - |p - c| == (a - c).(a + c - 2p) / (|p - a| + |p - c|)
+    float path_difference_m = dot(antenna - center, antenna + center - 2.0F * position)
+        / (dist_meters + reference.x);
+
+    float microseconds = path_difference_m / c;
+    float phase_angle = reference.y + frequency * microseconds;
     float radians    = phase_angle * 2.0F * pi;
 
     #if defined(POWER)
@@ -37,29 +69,29 @@ vec2 value(in vec2 position, in vec2 antenna, in float frequency) {
     return vec2(cos(radians), sin(radians)) * intensity;
 }
 
-void main()
-{
-    float half_frame_height = field_size_pixels.y * 0.5F;
-    vec2  pixel_pos = vec2(gl_FragCoord.x, half_frame_height - gl_FragCoord.y);
-    vec2  position  = pixel_pos * pixel_size_m;
-
-    vec3 signal = vec3(1.0F, 0.0F, 0.0F);
+vec3 antenna_position(in int index, in float min_antenna_pos) {
+    return vec3(0.0F, -min_antenna_pos + antenna_spacing_m * float(index), antenna_height_m);
+}
 
-    vec2 carrier_c = vec2(0.0F);
-    vec2 carrier_s = vec2(0.0F);
+vec2 cmul(in vec2 a, in vec2 b) {
+    return vec2(a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x);
+}
 
-    float min_antenna_pos = (float(antenna_pairs) - 0.5F) * antenna_spacing_m;
+// Sums every antenna pair, O(N^2). signal.x is unused.
+vec3 pairwise_signal(in vec3 position, in vec3 center, in float min_antenna_pos) {
+    vec3 signal = vec3(1.0F, 0.0F, 0.0F);
+    vec2 reference = reference_phase(position, center, loc_freq);
 
     for (int i = 0; i < antenna_pairs * 2; ++i) {
-        vec2  antenna_i_pos = vec2(0.0F, -min_antenna_pos + antenna_spacing_m * float(i));
+        vec3  antenna_i_pos = antenna_position(i, min_antenna_pos);
 
-        vec2 i_value_carrier_c = value(position, antenna_i_pos, loc_freq);
+        vec2 i_value_carrier_c = value(position, antenna_i_pos, center, reference, loc_freq);
 
         for (int j = i; j < antenna_pairs * 2; ++j) {
             if (i != j) {
-                vec2  antenna_j_pos = vec2(0.0F, -min_antenna_pos + antenna_spacing_m * float(j));
+                vec3  antenna_j_pos = antenna_position(j, min_antenna_pos);
 
-                vec2 j_value_carrier_c = value(position, antenna_j_pos, loc_freq);
+                vec2 j_value_carrier_c = value(position, antenna_j_pos, center, reference, loc_freq);
 
                 signal.y += length(i_value_carrier_c + j_value_carrier_c);
                 signal.z += length(i_value_carrier_c - j_value_carrier_c);
@@ -67,6 +99,43 @@ void main()
         }
     }
 
+    return signal;
+}
+
+// Sums each element's CSB and SBO phasor once, O(N). signal.x is the DDM.
+vec3 phasor_signal(in vec3 position, in vec3 center, in float min_antenna_pos) {
+    vec2 csb       = vec2(0.0F);
+    vec2 sbo       = vec2(0.0F);
+    vec2 reference = reference_phase(position, center, loc_freq);
+
+    for (int i = 0; i < antenna_pairs * 2; ++i) {
+        vec3 antenna_i_pos = antenna_position(i, min_antenna_pos);
+        vec2 i_value       = value(position, antenna_i_pos, center, reference, loc_freq);
+
+        csb += cmul(i_value, element_excitations[i].xy);
+        sbo += cmul(i_value, element_excitations[i].zw);
+    }
+
+    float csb_power = dot(csb, csb);
+    float ddm       = (csb_power > 0.0F) ? (2.0F * dot(sbo, csb) / csb_power) : 0.0F;
+
+    return vec3(ddm, length(csb), length(sbo));
+}
+
+void main()
+{
+    float half_frame_height = field_size_pixels.y * 0.5F;
+    vec2  frag_coord = gl_FragCoord.xy * frag_coord_scale;
+    vec2  pixel_pos = vec2(frag_coord.x, half_frame_height - frag_coord.y);
+    vec3  position  = vec3(pixel_pos * pixel_size_m, receiver_height_m);
+    vec3  center    = vec3(0.0F, 0.0F, antenna_height_m);
+
+    float min_antenna_pos = (float(antenna_pairs) - 0.5F) * antenna_spacing_m;
+
+    vec3 signal = (summation == summation_phasor)
+        ? phasor_signal(position, center, min_antenna_pos)
+        : pairwise_signal(position, center, min_antenna_pos);
+
     vec3 output_color = (signal * output_scale) + output_scale;
 
     frag_color = vec4(output_color, 1.0F);
@@ -1,15 +1,28 @@
 #include "ltb/app/ils_app.hpp"
 
 // project
+#include "ltb/gui/dsp.hpp"
+#include "ltb/gui/plot_lines.hpp"
 #include "ltb/utils/error_callback.hpp"
+#include "ltb/utils/size_utils.hpp"
 
 // generated
 #include "ltb/ltb_config.hpp"
 
 // external
+#include <glm/gtc/type_ptr.hpp>
 #include <magic_enum.hpp>
 #include <spdlog/spdlog.h>
 
+// standard
+#include <algorithm>
+#include <bit>
+#include <cfloat>
+#include <filesystem>
+#include <numeric>
+#include <tuple>
+#include <utility>
+
 // ILS Interference Graphics
 // https://www.desmos.com/calculator/l0sj535wrs
 
@@ -26,6 +39,43 @@ constexpr auto orange = ImColor( ImVec4( 1.0F, 0.5F, 0.1F, 1.0F ) );
 
 constexpr auto radio_frequency_mhz = 110.1;
 
+constexpr auto max_antenna_pairs = static_cast< int32 >( ils::max_antenna_count / 2_UZ );
+
+// Where "Export field" writes the tiled field, relative to the working directory.
+auto const export_path = std::filesystem::path{ "ils_field.ltbtiled" };
+
+// Field pixels per pixel of the progressive rendering preview.
+constexpr auto coarse_pixel_factor = 8;
+
+// Glide path angle of the simulated approach.
+constexpr auto flight_glide_path_rad = glm::radians( 3.0F );
+
+// Standard deviation of the noise added to the approach's envelope, in its units.
+constexpr auto flight_noise_range = std::array{ 0.0F, 1.0F };
+
+// The volume meshes are built in meters and displayed in kilometers.
+constexpr auto volume_display_scale = 1.0e-3F;
+
+// Angles sampled on each side of the approach course when measuring the course.
+constexpr auto course_arc_half_angle_rad = 0.6F;
+constexpr auto course_arc_samples        = 4'801_UZ;
+
+/// \brief Every transmitted wave with its plot label, in display order.
+auto labeled_waves( ils::TransmittedWaves const& waves )
+{
+    return std::array{
+        std::pair{ "Radio Carrier", &waves.carrier },
+        std::pair{ "90Hz Audio", &waves.ninety_hz },
+        std::pair{ "150Hz Audio", &waves.one_fifty_hz },
+        std::pair{ "CSB Audio (90Hz + 150Hz)", &waves.csb_audio },
+        std::pair{ "CSB Modulated", &waves.csb_modulated },
+        std::pair{ "CSB Signal", &waves.csb_signal },
+        std::pair{ "SBO Audio (90Hz - 150Hz)", &waves.sbo_audio },
+        std::pair{ "SBO Modulated", &waves.sbo_modulated },
+        std::pair{ "SBO Shifted", &waves.sbo_shifted },
+    };
+}
+
 auto draw_phase_circle( glm::dvec2 const wave )
 {
     auto* const draw_list = ImGui::GetWindowDrawList( );
@@ -96,9 +146,35 @@ auto IlsApp::initialize( glm::ivec2 const framebuffer_size ) -> utils::Result< v
             output_scale_uniform_,
             // time_s_uniform_,
             field_size_pixels_uniform_,
-            vertex_array_
+            summation_uniform_,
+            excitations_uniform_,
+            frag_coord_scale_uniform_,
+            antenna_height_m_uniform_,
+            receiver_height_m_uniform_,
+            vertex_array_,
+            mesh_pipeline_
         )
     );
+    camera_.set_viewport_size( glm::vec2( framebuffer_size_ ) );
+
+    // The field is only ever displayed, so it is stored the same way as the screen.
+    LTB_CHECK( field_chain_.initialize(
+        framebuffer_size_,
+        {
+            .texture_filter  = GL_NEAREST,
+            .internal_format = GL_RGBA8,
+            .format          = GL_RGBA,
+            .type            = GL_UNSIGNED_BYTE,
+        }
+    ) );
+
+    // Only the spectrum is drawn with ImPlot.
+    if ( implot_context_
+         = std::shared_ptr< ImPlotContext >( ImPlot::CreateContext( ), ImPlot::DestroyContext );
+         nullptr == implot_context_ )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR( "Failed to create ImPlot context" );
+    }
 
     glClearColor( 0.0F, 1.0F, 0.0F, 1.0F );
     glDisable( GL_DEPTH_TEST );
@@ -111,26 +187,45 @@ auto IlsApp::initialize( glm::ivec2 const framebuffer_size ) -> utils::Result< v
 auto IlsApp::render( ) -> void
 {
     glViewport( 0, 0, framebuffer_size_.x, framebuffer_size_.y );
-    glClear( GL_COLOR_BUFFER_BIT );
 
-    auto const current_time     = std::chrono::steady_clock::now( );
-    auto const elapsed_duration = current_time - start_time_;
-    auto const elapsed_time_s
-        = std::chrono::duration_cast< std::chrono::duration< float32 > >( elapsed_duration )
-              .count( );
+    if ( show_volume_ )
+    {
+        glClearColor( 0.2F, 0.2F, 0.2F, 1.0F );
+        glEnable( GL_DEPTH_TEST );
+        glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+        mesh_pipeline_.draw( camera_.render_params( ) );
+        glDisable( GL_DEPTH_TEST );
+        glClearColor( 0.0F, 1.0F, 0.0F, 1.0F );
+        return;
+    }
 
-    set( pixel_size_m_uniform_, pixel_size_m_ );
-    set( antenna_pairs_uniform_, antenna_pairs_ );
-    set( antenna_spacing_m_uniform_, antenna_spacing_m_ );
-    set( output_scale_uniform_, output_channels_ * output_scale_ );
-    set( time_s_uniform_, elapsed_time_s * time_scale_s_ );
-    set( field_size_pixels_uniform_, glm::vec2{ framebuffer_size_ } );
+    glClear( GL_COLOR_BUFFER_BIT );
 
-    ogl::draw( ogl::bind( program_ ), ogl::bind( vertex_array_ ), GL_TRIANGLE_STRIP, 0, 4 );
+    if ( progressive_rendering_ || cpu_rendering( ) )
+    {
+        render_progressive( );
+    }
+    else
+    {
+        accumulated_params_ = std::nullopt;
+        draw_field( 1.0F );
+    }
+
+    // The shader output can only be compared once the full resolution field is displayed.
+    if ( validate_cpu_field_ && field_complete( ) )
+    {
+        validate_cpu_field_ = false;
+        LTB_CHECK_OR( validate_cpu_field( ), utils::log_error );
+    }
 }
 
 auto IlsApp::configure_gui( ) -> void
 {
+    if ( show_volume_ )
+    {
+        camera_.handle_inputs( camera_input_settings_ );
+    }
+
     constexpr auto dock_node_flags = ImGuiDockNodeFlags_PassthruCentralNode;
     utils::ignore( ImGui::DockSpaceOverViewport( 0, nullptr, dock_node_flags ) );
 
@@ -138,13 +233,30 @@ auto IlsApp::configure_gui( ) -> void
     {
         auto const unused_return_values = std::array{
             ImGui::SliderFloat( "Pixel size (m)", &pixel_size_m_, 0.1F, 10.0F ),
-            ImGui::SliderInt( "Antenna pairs", &antenna_pairs_, 1, 10 ),
+            ImGui::SliderInt( "Antenna pairs", &antenna_pairs_, 1, max_antenna_pairs ),
             ImGui::SliderFloat( "Antenna spacing (m)", &antenna_spacing_m_, 0.1F, 10.0F ),
         };
         utils::ignore( unused_return_values );
 
         output_scale_ = 0.1F / static_cast< float32 >( antenna_pairs_ );
 
+        if ( excitations_.size( ) != static_cast< std::size_t >( antenna_pairs_ ) * 2_UZ )
+        {
+            excitations_ = ils::default_excitations( antenna_pairs_ );
+        }
+
+        if ( ImGui::BeginCombo( "Summation", magic_enum::enum_name( summation_ ).data( ) ) )
+        {
+            for ( auto const summation : magic_enum::enum_values< ils::Summation >( ) )
+            {
+                if ( ImGui::Selectable( magic_enum::enum_name( summation ).data( ) ) )
+                {
+                    summation_ = summation;
+                }
+            }
+            ImGui::EndCombo( );
+        }
+
         auto const* str = "Both";
         switch ( display_ )
         {
@@ -157,6 +269,9 @@ auto IlsApp::configure_gui( ) -> void
                 break;
             case Both:
                 break;
+            case DDM:
+                str = "DDM";
+                break;
         }
 
         if ( ImGui::BeginCombo( "Pattern", str ) )
@@ -177,8 +292,40 @@ auto IlsApp::configure_gui( ) -> void
                 output_channels_ = { 0.0F, 1.0F, 1.0F };
                 display_         = Both;
             }
+            // Only phasor summation produces a DDM.
+            if ( ImGui::Selectable( "DDM" ) )
+            {
+                output_channels_ = { 1.0F, 0.0F, 0.0F };
+                display_         = DDM;
+            }
             ImGui::EndCombo( );
         }
+
+        if ( ils::Summation::Phasor == summation_ )
+        {
+            configure_excitations_gui( );
+            configure_course_gui( );
+        }
+
+        configure_multipath_gui( );
+        configure_flight_gui( );
+        configure_volume_gui( );
+        configure_export_gui( );
+
+        utils::ignore( ImGui::Checkbox( "Progressive rendering", &progressive_rendering_ ) );
+        if ( progressive_rendering_ )
+        {
+            utils::ignore( ImGui::SliderInt( "Refine frames", &refine_frames_, 1, 16 ) );
+        }
+
+        if ( ImGui::Button( "Validate CPU field" ) )
+        {
+            validate_cpu_field_ = true;
+        }
+        if ( cpu_field_max_difference_.has_value( ) )
+        {
+            ImGui::Text( "Max CPU/GPU difference: %.4f", cpu_field_max_difference_.value( ) );
+        }
     }
     ImGui::End( );
 
@@ -232,172 +379,893 @@ auto IlsApp::configure_gui( ) -> void
     }
     ImGui::End( );
 
-    constexpr auto radio_frequency        = 30.0;
-    constexpr auto ninety_hz_frequency    = 0.9;
-    constexpr auto one_fifty_hz_frequency = 1.5;
-
-    constexpr auto sample_points_i = 8192;
-    constexpr auto sample_points   = static_cast< uint64 >( sample_points_i );
-    constexpr auto window_range_us = math::Range{ .min = 0.0, .max = 2.0 };
-    constexpr auto window_size_us  = dimensions( window_range_us );
-
-    auto carrier_wave = std::vector( sample_points, 0.0F );
-    assert( carrier_wave.size( ) == sample_points );
-    auto ninety_hz_wave = std::vector( sample_points, 0.0F );
-    assert( ninety_hz_wave.size( ) == sample_points );
-    auto one_fifty_hz_wave = std::vector( sample_points, 0.0F );
-    assert( one_fifty_hz_wave.size( ) == sample_points );
-    auto csb_audio_wave = std::vector( sample_points, 0.0F );
-    assert( csb_audio_wave.size( ) == sample_points );
-    auto csb_modulated_wave = std::vector( sample_points, 0.0F );
-    assert( csb_modulated_wave.size( ) == sample_points );
-    auto csb_signal_wave = std::vector( sample_points, 0.0F );
-    assert( csb_signal_wave.size( ) == sample_points );
-    auto sbo_audio_wave = std::vector( sample_points, 0.0F );
-    assert( sbo_audio_wave.size( ) == sample_points );
-    auto sbo_modulated_wave = std::vector( sample_points, 0.0F );
-    assert( sbo_modulated_wave.size( ) == sample_points );
-    auto sbo_shifted_wave = std::vector( sample_points, 0.0F );
-    assert( sbo_shifted_wave.size( ) == sample_points );
-
-    for ( auto i = 0UZ; i < sample_points; ++i )
-    {
-        auto const t = static_cast< float64 >( i ) / static_cast< float64 >( sample_points );
-
-        auto const us = window_range_us.min + ( t * window_size_us );
-
-        carrier_wave[ i ] = static_cast< float32 >(
-            std::sin( glm::two_pi< float64 >( ) * radio_frequency * us )
-        );
-        ninety_hz_wave[ i ] = static_cast< float32 >(
-            std::sin( glm::two_pi< float64 >( ) * ninety_hz_frequency * us )
-        );
-        one_fifty_hz_wave[ i ] = static_cast< float32 >(
-            std::sin( glm::two_pi< float64 >( ) * one_fifty_hz_frequency * us )
-        );
+    auto const plots = labeled_waves( transmitted_waves_.waves( ) );
+    static_assert( plots.size( ) == std::tuple_size_v< decltype( transmitted_wave_lods_ ) > );
 
-        csb_audio_wave[ i ]     = ninety_hz_wave[ i ] + one_fifty_hz_wave[ i ];
-        csb_modulated_wave[ i ] = carrier_wave[ i ] * csb_audio_wave[ i ] * 0.2F;
-        csb_signal_wave[ i ]    = csb_modulated_wave[ i ] + carrier_wave[ i ];
+    // Only resynthesized, and the plots and spectrum rebuilt, when the parameters change.
+    if ( transmitted_waves_.update( transmitted_wave_params_ ) )
+    {
+        for ( auto i = 0_UZ; i < plots.size( ); ++i )
+        {
+            transmitted_wave_lods_[ i ].set_values( *plots[ i ].second );
+        }
+        LTB_CHECK_OR( update_wave_spectrum( ), utils::log_error );
+    }
 
-        auto const shifted_carrier_wave = static_cast< float32 >( std::sin(
-            glm::half_pi< float64 >( ) + ( glm::two_pi< float64 >( ) * radio_frequency * us )
-        ) );
+    if ( ImGui::Begin( "Transmitted Waves" ) )
+    {
+        for ( auto i = 0_UZ; i < plots.size( ); ++i )
+        {
+            gui::plot_lines(
+                plots[ i ].first,
+                transmitted_wave_lods_[ i ],
+                -2.0F,
+                2.0F,
+                ImVec2( 0.0F, 100.0F )
+            );
+        }
+    }
+    ImGui::End( );
 
-        sbo_audio_wave[ i ]     = ninety_hz_wave[ i ] - one_fifty_hz_wave[ i ];
-        sbo_modulated_wave[ i ] = carrier_wave[ i ] * sbo_audio_wave[ i ] * 0.2F;
-        sbo_shifted_wave[ i ]   = shifted_carrier_wave * sbo_audio_wave[ i ] * 0.2F;
+    if ( ImGui::Begin( "Spectrum" ) )
+    {
+        configure_spectrum_gui( );
     }
+    ImGui::End( );
 
-    if ( ImGui::Begin( "Transmitted Waves" ) )
+    // auto const radians = phase_angle * glm::two_pi< float64 >( );
+
+    // auto const wave = glm::dvec2{ std::cos( radians ), std::sin( radians ) } * scale;
+}
+
+auto IlsApp::destroy( ) -> void
+{
+    mesh_pipeline_.clear( );
+    volume_mesh_ids_.clear( );
+
+    vertex_array_ = { };
+    field_chain_  = { };
+
+    program_ = { fullscreen_vertex_shader_, ils_fragment_shader_ };
+
+    implot_context_ = nullptr;
+
+    framebuffer_size_ = { };
+}
+
+auto IlsApp::resize( glm::ivec2 const framebuffer_size ) -> void
+{
+    framebuffer_size_ = framebuffer_size;
+    LTB_CHECK_OR( field_chain_.resize( framebuffer_size_ ), utils::log_error );
+    camera_.set_viewport_size( glm::vec2( framebuffer_size_ ) );
+
+    // The accumulated field no longer matches the screen.
+    accumulated_params_ = std::nullopt;
+}
+
+auto IlsApp::field_params( ) const -> ils::FieldParams
+{
+    auto output_scale = output_channels_ * output_scale_;
+    if ( ils::Summation::Phasor == summation_ )
     {
-        ImGui::PlotLines(
-            "Radio Carrier",
-            carrier_wave.data( ),
-            sample_points_i,
-            0,
-            nullptr,
-            -2.0F,
-            2.0F,
-            ImVec2( 0.0F, 100.0F )
-        );
-        ImGui::PlotLines(
-            "90Hz Audio",
-            ninety_hz_wave.data( ),
-            sample_points_i,
-            0,
-            nullptr,
-            -2.0F,
-            2.0F,
-            ImVec2( 0.0F, 100.0F )
+        // Map a DDM of [-1, 1] to the full red channel.
+        output_scale.x = output_channels_.x * 0.5F;
+    }
+
+    auto reflectors = std::vector< ils::Reflector >{ };
+    if ( ground_reflection_ )
+    {
+        reflectors.push_back( ils::ground_plane( ground_coefficient_ ) );
+    }
+    for ( auto const& wall : walls_ )
+    {
+        reflectors.push_back(
+            ils::vertical_wall( wall.start_m, wall.end_m, wall.height_m, wall.coefficient )
         );
-        ImGui::PlotLines(
-            "150Hz Audio",
-            one_fifty_hz_wave.data( ),
-            sample_points_i,
-            0,
-            nullptr,
-            -2.0F,
-            2.0F,
-            ImVec2( 0.0F, 100.0F )
+    }
+
+    return {
+        .pixel_size_m      = pixel_size_m_,
+        .antenna_pairs     = antenna_pairs_,
+        .antenna_spacing_m = antenna_spacing_m_,
+        .output_scale      = output_scale,
+        .summation         = summation_,
+        .excitations       = excitations_,
+        .antenna_height_m  = antenna_height_m_,
+        .receiver_height_m = receiver_height_m_,
+        .reflectors        = reflectors,
+    };
+}
+
+auto IlsApp::draw_field( float32 const frag_coord_scale ) -> void
+{
+    auto const current_time     = std::chrono::steady_clock::now( );
+    auto const elapsed_duration = current_time - start_time_;
+    auto const elapsed_time_s
+        = std::chrono::duration_cast< std::chrono::duration< float32 > >( elapsed_duration )
+              .count( );
+
+    set( pixel_size_m_uniform_, pixel_size_m_ );
+    set( antenna_pairs_uniform_, antenna_pairs_ );
+    set( antenna_spacing_m_uniform_, antenna_spacing_m_ );
+    set( output_scale_uniform_, field_params( ).output_scale );
+    set( time_s_uniform_, elapsed_time_s * time_scale_s_ );
+    set( field_size_pixels_uniform_, glm::vec2{ framebuffer_size_ } );
+    set( summation_uniform_, static_cast< int32 >( summation_ ) );
+    set( frag_coord_scale_uniform_, frag_coord_scale );
+    set( antenna_height_m_uniform_, antenna_height_m_ );
+    set( receiver_height_m_uniform_, receiver_height_m_ );
+
+    auto element_phasors = std::array< glm::vec4, ils::max_antenna_count >{ };
+    for ( auto i = 0_UZ; i < std::min( excitations_.size( ), element_phasors.size( ) ); ++i )
+    {
+        element_phasors[ i ] = ils::excitation_phasors( excitations_[ i ] );
+    }
+    set( excitations_uniform_, std::span< glm::vec4 const >( element_phasors ) );
+
+    ogl::draw( ogl::bind( program_ ), ogl::bind( vertex_array_ ), GL_TRIANGLE_STRIP, 0, 4 );
+}
+
+auto IlsApp::render_progressive( ) -> void
+{
+    auto const full_viewport   = math::Range2Di{ .min = glm::ivec2{ 0 }, .max = framebuffer_size_ };
+    auto const coarse_viewport = math::Range2Di{
+        .min = glm::ivec2{ 0 },
+        .max = ( framebuffer_size_ + ( coarse_pixel_factor - 1 ) ) / coarse_pixel_factor,
+    };
+
+    if ( auto const params = field_params( ); accumulated_params_ != params )
+    {
+        // Restart the accumulation from a cheap preview.
+        accumulated_params_ = params;
+        refined_rows_       = 0;
+
+        auto const coarse_size = dimensions( coarse_viewport );
+
+        if ( cpu_rendering( ) )
+        {
+            LTB_CHECK_OR(
+                draw_cpu_field(
+                    field_chain_.get_texture< coarse_index_ >( ),
+                    coarse_size,
+                    coarse_viewport,
+                    static_cast< float32 >( coarse_pixel_factor )
+                ),
+                utils::log_error
+            );
+        }
+        else
+        {
+            auto const bound_framebuffer
+                = ogl::bind< GL_FRAMEBUFFER >( field_chain_.get_framebuffer< coarse_index_ >( ) );
+
+            glViewport( 0, 0, coarse_size.x, coarse_size.y );
+            draw_field( static_cast< float32 >( coarse_pixel_factor ) );
+        }
+    }
+    else if ( refined_rows_ < framebuffer_size_.y )
+    {
+        auto const frames         = std::max( refine_frames_, 1 );
+        auto const rows_per_frame = ( framebuffer_size_.y + ( frames - 1 ) ) / frames;
+        auto const band_end = std::min( refined_rows_ + rows_per_frame, framebuffer_size_.y );
+
+        if ( cpu_rendering( ) )
+        {
+            auto const band = math::Range2Di{
+                .min = glm::ivec2{ 0, refined_rows_ },
+                .max = glm::ivec2{ framebuffer_size_.x, band_end },
+            };
+            LTB_CHECK_OR(
+                draw_cpu_field(
+                    field_chain_.get_texture< accumulation_index_ >( ),
+                    framebuffer_size_,
+                    band,
+                    1.0F
+                ),
+                utils::log_error
+            );
+        }
+        else
+        {
+            auto const bound_framebuffer = ogl::bind< GL_FRAMEBUFFER >(
+                field_chain_.get_framebuffer< accumulation_index_ >( )
+            );
+
+            glViewport( 0, 0, framebuffer_size_.x, framebuffer_size_.y );
+            glEnable( GL_SCISSOR_TEST );
+            glScissor( 0, refined_rows_, framebuffer_size_.x, band_end - refined_rows_ );
+            draw_field( 1.0F );
+            glDisable( GL_SCISSOR_TEST );
+        }
+
+        refined_rows_ = band_end;
+    }
+
+    glViewport( 0, 0, framebuffer_size_.x, framebuffer_size_.y );
+
+    auto const bound_draw_framebuffer = ogl::bind< GL_DRAW_FRAMEBUFFER >( default_framebuffer_ );
+    auto const attachments            = std::vector< ogl::FramebufferAttachmentPair >{
+        { .read = GL_COLOR_ATTACHMENT0, .write = GL_BACK },
+    };
+
+    // Stretch the preview over the rows that have not been refined yet.
+    if ( refined_rows_ < framebuffer_size_.y )
+    {
+        auto const& coarse = field_chain_.get_framebuffer< coarse_index_ >( );
+        ogl::Framebuffer::blit(
+            ogl::bind< GL_READ_FRAMEBUFFER >( coarse ),
+            bound_draw_framebuffer,
+            coarse_viewport,
+            full_viewport,
+            attachments,
+            GL_COLOR_BUFFER_BIT,
+            GL_NEAREST
         );
-        ImGui::PlotLines(
-            "CSB Audio (90Hz + 150Hz)",
-            csb_audio_wave.data( ),
-            sample_points_i,
-            0,
-            nullptr,
-            -2.0F,
-            2.0F,
-            ImVec2( 0.0F, 100.0F )
+    }
+
+    if ( refined_rows_ > 0 )
+    {
+        auto const refined_viewport = math::Range2Di{
+            .min = glm::ivec2{ 0 },
+            .max = glm::ivec2{ framebuffer_size_.x, refined_rows_ },
+        };
+        auto const& accumulation = field_chain_.get_framebuffer< accumulation_index_ >( );
+        ogl::Framebuffer::blit(
+            ogl::bind< GL_READ_FRAMEBUFFER >( accumulation ),
+            bound_draw_framebuffer,
+            refined_viewport,
+            attachments,
+            GL_COLOR_BUFFER_BIT,
+            GL_NEAREST
         );
-        ImGui::PlotLines(
-            "CSB Modulated",
-            csb_modulated_wave.data( ),
-            sample_points_i,
-            0,
-            nullptr,
-            -2.0F,
-            2.0F,
-            ImVec2( 0.0F, 100.0F )
+    }
+}
+
+auto IlsApp::draw_cpu_field(
+    ogl::Texture const&   texture,
+    glm::ivec2 const      field_size,
+    math::Range2Di const& region,
+    float32 const         pixel_scale
+) -> utils::Result< void >
+{
+    auto params = field_params( );
+    params.pixel_size_m *= pixel_scale;
+
+    auto const region_size = dimensions( region );
+
+    auto colors = std::vector< glm::vec3 >( utils::total_size( region_size.x, region_size.y ) );
+    auto const evaluator = ils::FieldEvaluator{ std::move( params ) };
+    LTB_CHECK( evaluator.evaluate_colors( field_size, region, colors ) );
+
+    // Float colors are clamped to [0, 1] when stored in the RGBA8 texture, like the shader output.
+    constexpr auto mipmap_level = GLint{ 0 };
+    ogl::tex_sub_image_2d(
+        ogl::bind< GL_TEXTURE_2D >( texture ),
+        region,
+        colors.data( ),
+        GL_RGB,
+        GL_FLOAT,
+        mipmap_level
+    );
+
+    return utils::success( );
+}
+
+auto IlsApp::cpu_rendering( ) const -> bool
+{
+    return ground_reflection_ || !walls_.empty( );
+}
+
+auto IlsApp::field_complete( ) const -> bool
+{
+    return !( progressive_rendering_ || cpu_rendering( ) )
+        || ( refined_rows_ >= framebuffer_size_.y );
+}
+
+auto IlsApp::configure_excitations_gui( ) -> void
+{
+    if ( ImGui::TreeNode( "Element excitations" ) )
+    {
+        if ( ImGui::Button( "Reset" ) )
+        {
+            excitations_ = ils::default_excitations( antenna_pairs_ );
+        }
+
+        for ( auto i = 0_UZ; i < excitations_.size( ); ++i )
+        {
+            auto& excitation = excitations_[ i ];
+
+            ImGui::PushID( static_cast< int32 >( i ) );
+            ImGui::SeparatorText( fmt::format( "Element {}", i ).c_str( ) );
+
+            auto const unused_return_values = std::array{
+                ImGui::SliderFloat( "CSB amplitude", &excitation.csb_amplitude, 0.0F, 2.0F ),
+                ImGui::SliderAngle( "CSB phase", &excitation.csb_phase_rad ),
+                ImGui::SliderFloat( "SBO amplitude", &excitation.sbo_amplitude, 0.0F, 2.0F ),
+                ImGui::SliderAngle( "SBO phase", &excitation.sbo_phase_rad ),
+            };
+            utils::ignore( unused_return_values );
+
+            ImGui::PopID( );
+        }
+
+        ImGui::TreePop( );
+    }
+}
+
+auto IlsApp::configure_course_gui( ) -> void
+{
+    if ( ImGui::TreeNode( "Course" ) )
+    {
+        utils::ignore( ImGui::SliderFloat( "Range (m)", &course_range_m_, 10.0F, 20'000.0F ) );
+
+        if ( ImGui::Button( "Analyze course" ) )
+        {
+            auto const ranges = std::array{ course_range_m_ };
+            auto const angles = ils::linspace(
+                { .min = -course_arc_half_angle_rad, .max = course_arc_half_angle_rad },
+                course_arc_samples
+            );
+
+            course_report_   = std::nullopt;
+            course_analyzed_ = true;
+
+            if ( auto reports = ils::analyze_arcs( field_params( ), ranges, angles ) )
+            {
+                course_report_ = reports->front( );
+            }
+            else
+            {
+                utils::log_error( reports.error( ) );
+            }
+        }
+
+        if ( course_report_.has_value( ) )
+        {
+            auto const& report = course_report_.value( );
+            ImGui::Text( "Course line: %.3f°", glm::degrees( report.course_line_rad ) );
+            ImGui::Text( "Course width: %.3f°", glm::degrees( report.course_width_rad ) );
+            ImGui::Text(
+                "Half widths: %.3f° / %.3f°",
+                glm::degrees( report.negative_half_width_rad ),
+                glm::degrees( report.positive_half_width_rad )
+            );
+            ImGui::Text( "Linearity error: %.1f%%", report.linearity_error * 100.0F );
+        }
+        else if ( course_analyzed_ )
+        {
+            ImGui::Text(
+                "No full-scale course sector within ±%.0f°",
+                glm::degrees( course_arc_half_angle_rad )
+            );
+        }
+
+        ImGui::TreePop( );
+    }
+}
+
+auto IlsApp::configure_multipath_gui( ) -> void
+{
+    if ( ImGui::TreeNode( "Multipath" ) )
+    {
+        auto const unused_return_values = std::array{
+            ImGui::SliderFloat( "Antenna height (m)", &antenna_height_m_, 0.0F, 20.0F ),
+            ImGui::SliderFloat( "Receiver height (m)", &receiver_height_m_, 0.0F, 500.0F ),
+            ImGui::Checkbox( "Ground reflection", &ground_reflection_ ),
+        };
+        utils::ignore( unused_return_values );
+
+        if ( ground_reflection_ )
+        {
+            utils::ignore( ImGui::SliderFloat2(
+                "Ground coefficient",
+                glm::value_ptr( ground_coefficient_ ),
+                -1.0F,
+                1.0F
+            ) );
+        }
+
+        ImGui::SeparatorText( "Walls" );
+
+        if ( ImGui::Button( "Add wall" ) )
+        {
+            walls_.emplace_back( );
+        }
+
+        auto removed = std::optional< std::size_t >{ };
+        for ( auto i = 0_UZ; i < walls_.size( ); ++i )
+        {
+            auto& wall = walls_[ i ];
+
+            ImGui::PushID( static_cast< int32 >( i ) );
+            ImGui::SeparatorText( fmt::format( "Wall {}", i ).c_str( ) );
+
+            auto const wall_return_values = std::array{
+                ImGui::DragFloat2( "Start (m)", glm::value_ptr( wall.start_m ) ),
+                ImGui::DragFloat2( "End (m)", glm::value_ptr( wall.end_m ) ),
+                ImGui::SliderFloat( "Height (m)", &wall.height_m, 1.0F, 100.0F ),
+                ImGui::SliderFloat2(
+                    "Coefficient",
+                    glm::value_ptr( wall.coefficient ),
+                    -1.0F,
+                    1.0F
+                ),
+            };
+            utils::ignore( wall_return_values );
+
+            if ( ImGui::Button( "Remove" ) )
+            {
+                removed = i;
+            }
+
+            ImGui::PopID( );
+        }
+
+        if ( removed.has_value( ) )
+        {
+            walls_.erase( walls_.begin( ) + static_cast< std::ptrdiff_t >( removed.value( ) ) );
+        }
+
+        if ( cpu_rendering( ) )
+        {
+            ImGui::TextWrapped(
+                "Reflections are evaluated on the CPU and always rendered progressively."
+            );
+        }
+
+        ImGui::TreePop( );
+    }
+}
+
+auto IlsApp::configure_flight_gui( ) -> void
+{
+    if ( ImGui::TreeNode( "Flight" ) )
+    {
+        auto const unused_return_values = std::array{
+            ImGui::SliderFloat( "Start range (m)", &flight_start_range_m_, 1'000.0F, 40'000.0F ),
+            ImGui::SliderFloat( "Start offset (m)", &flight_start_offset_m_, -1'000.0F, 1'000.0F ),
+            ImGui::SliderFloat( "Ground speed (m/s)", &flight_ground_speed_m_s_, 30.0F, 150.0F ),
+            ImGui::SliderFloat(
+                "Envelope noise",
+                &flight_noise_sigma_,
+                flight_noise_range.front( ),
+                flight_noise_range.back( ),
+                "%.4f",
+                ImGuiSliderFlags_Logarithmic
+            ),
+        };
+        utils::ignore( unused_return_values );
+
+        if ( ImGui::Button( "Fly approach" ) )
+        {
+            // Straight to the array on a 3° glide path, converging on the course line.
+            auto const duration_s = flight_start_range_m_ / flight_ground_speed_m_s_;
+
+            auto const time_s = std::array{ 0.0, static_cast< float64 >( duration_s ) };
+            auto const x_m    = std::array{ flight_start_range_m_, 0.0F };
+            auto const y_m    = std::array{ flight_start_offset_m_, 0.0F };
+            auto const z_m    = std::array{
+                ( flight_start_range_m_ * std::tan( flight_glide_path_rad ) ) + receiver_height_m_,
+                receiver_height_m_,
+            };
+
+            flight_ddm_.clear( );
+            flight_envelope_.clear( );
+
+            // One plotted point per block keeps the plot small however long the flight is.
+            auto const on_block = [ this ]( ils::ReceiverOutput const& output )
+            {
+                auto const count = static_cast< float32 >( output.ddm.size( ) );
+                flight_ddm_.push_back(
+                    std::accumulate( output.ddm.begin( ), output.ddm.end( ), 0.0F ) / count
+                );
+                flight_envelope_.push_back(
+                    std::accumulate( output.envelope.begin( ), output.envelope.end( ), 0.0F )
+                    / count
+                );
+            };
+
+            auto const params = ils::ReceiverParams{
+                .impairments = { .noise_sigma = flight_noise_sigma_ },
+            };
+            auto const start  = std::chrono::steady_clock::now( );
+
+            if ( auto const result = ils::simulate_flight(
+                     field_params( ),
+                     params,
+                     { .time_s = time_s, .x_m = x_m, .y_m = y_m, .z_m = z_m },
+                     on_block
+                 ) )
+            {
+                auto const elapsed = std::chrono::steady_clock::now( ) - start;
+                auto const elapsed_s
+                    = std::chrono::duration_cast< std::chrono::duration< float64 > >( elapsed )
+                          .count( );
+                flight_samples_per_s_ = ( time_s.back( ) * params.sample_rate_hz ) / elapsed_s;
+            }
+            else
+            {
+                flight_samples_per_s_ = std::nullopt;
+                utils::log_error( result.error( ) );
+            }
+
+            flight_ddm_lod_.set_values( flight_ddm_ );
+            flight_envelope_lod_.set_values( flight_envelope_ );
+        }
+
+        if ( flight_samples_per_s_.has_value( ) )
+        {
+            ImGui::Text( "Receiver: %.1f M samples/s", flight_samples_per_s_.value( ) * 1.0e-6 );
+        }
+
+        if ( !flight_ddm_.empty( ) )
+        {
+            gui::plot_lines( "DDM", flight_ddm_lod_, -0.4F, 0.4F, ImVec2( 0.0F, 100.0F ) );
+            gui::plot_lines(
+                "RF envelope",
+                flight_envelope_lod_,
+                FLT_MAX,
+                FLT_MAX,
+                ImVec2( 0.0F, 100.0F )
+            );
+        }
+
+        ImGui::TreePop( );
+    }
+}
+
+auto IlsApp::configure_spectrum_gui( ) -> void
+{
+    auto const waves = labeled_waves( transmitted_waves_.waves( ) );
+
+    if ( ImGui::BeginCombo( "Wave", waves[ spectrum_wave_ ].first ) )
+    {
+        for ( auto i = 0_UZ; i < waves.size( ); ++i )
+        {
+            if ( ImGui::Selectable( waves[ i ].first, i == spectrum_wave_ ) )
+            {
+                spectrum_wave_ = i;
+                LTB_CHECK_OR( update_wave_spectrum( ), utils::log_error );
+            }
+        }
+        ImGui::EndCombo( );
+    }
+
+    gui::configure_fft_benchmark( fft_throughput_ );
+    gui::configure_am_detector_benchmark( am_detector_throughput_ );
+
+    if ( ImPlot::BeginPlot( "Wave Spectrum", ImVec2( -1.0F, -1.0F ) ) )
+    {
+        auto const& params = spectrum_analyzer_.params( );
+        ImPlot::SetupAxes( "Frequency (Hz)", "Level (dB)" );
+        ImPlot::SetupAxesLimits( 0.0, params.sample_rate_hz * 0.5, -140.0, 10.0 );
+
+        gui::plot_spectrum(
+            waves[ spectrum_wave_ ].first,
+            wave_spectrum_db_,
+            0.0,
+            spectrum_analyzer_.bin_hz( )
         );
-        ImGui::PlotLines(
-            "CSB Signal",
-            csb_signal_wave.data( ),
-            sample_points_i,
-            0,
-            nullptr,
-            -2.0F,
-            2.0F,
-            ImVec2( 0.0F, 100.0F )
+        ImPlot::EndPlot( );
+    }
+}
+
+auto IlsApp::update_wave_spectrum( ) -> utils::Result< void >
+{
+    auto const& wave   = *labeled_waves( transmitted_waves_.waves( ) )[ spectrum_wave_ ].second;
+    auto const& window = transmitted_wave_params_.window;
+
+    // Only a power of two of the samples is transformed; any past it are left out.
+    auto const params = dsp::SpectrumParams{
+        .size           = std::bit_floor( wave.size( ) ),
+        .sample_rate_hz = static_cast< float64 >( wave.size( ) ) / ( window.max - window.min ),
+    };
+    if ( spectrum_analyzer_.params( ) != params )
+    {
+        spectrum_analyzer_ = dsp::SpectrumAnalyzer{ params };
+    }
+
+    wave_spectrum_db_.resize( ( params.size / 2_UZ ) + 1_UZ );
+    return spectrum_analyzer_.real_spectrum(
+        std::span( wave ).first( params.size ),
+        wave_spectrum_db_
+    );
+}
+
+auto IlsApp::configure_volume_gui( ) -> void
+{
+    if ( ImGui::TreeNode( "Volume" ) )
+    {
+        auto glide_path_deg = glm::degrees( glide_slope_params_.glide_path_rad );
+
+        auto const unused_return_values = std::array{
+            ImGui::Checkbox( "Show volume", &show_volume_ ),
+            ImGui::SliderFloat( "Glide path (deg)", &glide_path_deg, 2.0F, 4.0F ),
+            ImGui::DragFloat2(
+                "Mast position (m)",
+                glm::value_ptr( glide_slope_params_.mast_position_m )
+            ),
+            ImGui::SliderFloat2(
+                "Mast ground coefficient",
+                glm::value_ptr( glide_slope_params_.ground_coefficient ),
+                -1.0F,
+                1.0F
+            ),
+            ImGui::DragFloat3( "Volume min (m)", glm::value_ptr( volume_grid_.bounds_m.min ) ),
+            ImGui::DragFloat3( "Volume max (m)", glm::value_ptr( volume_grid_.bounds_m.max ) ),
+            ImGui::SliderInt3( "Voxels", glm::value_ptr( volume_grid_.size ), 1, 400 ),
+            ImGui::SliderFloat( "Horizontal slice (m)", &horizontal_slice_m_, 0.0F, 1'000.0F ),
+            ImGui::DragFloat(
+                "Localizer min CSB",
+                &coverage_requirements_.localizer_min_csb,
+                1.0e-5F,
+                0.0F,
+                1.0F,
+                "%.2e"
+            ),
+            ImGui::DragFloat(
+                "Glide slope min CSB",
+                &coverage_requirements_.glide_slope_min_csb,
+                1.0e-5F,
+                0.0F,
+                1.0F,
+                "%.2e"
+            ),
+        };
+        utils::ignore( unused_return_values );
+
+        glide_slope_params_.glide_path_rad = glm::radians( glide_path_deg );
+
+        ImGui::Text(
+            "CSB antenna: %.2f m, SBO antenna: %.2f m",
+            ils::csb_antenna_height_m( glide_slope_params_ ),
+            2.0F * ils::csb_antenna_height_m( glide_slope_params_ )
         );
-        ImGui::PlotLines(
-            "SBO Audio (90Hz - 150Hz)",
-            sbo_audio_wave.data( ),
-            sample_points_i,
-            0,
-            nullptr,
-            -2.0F,
-            2.0F,
-            ImVec2( 0.0F, 100.0F )
+
+        if ( ImGui::Button( "Evaluate volume" ) )
+        {
+            LTB_CHECK_OR( build_volume_meshes( ), utils::log_error );
+        }
+
+        if ( volume_seconds_.has_value( ) )
+        {
+            ImGui::Text(
+                "%zu voxels in %.2f s",
+                ils::voxel_count( volume_grid_ ),
+                volume_seconds_.value( )
+            );
+        }
+
+        if ( coverage_report_.has_value( ) )
+        {
+            auto const& report  = coverage_report_.value( );
+            auto const  percent = [ &report ]( std::size_t const count )
+            {
+                return 100.0 * static_cast< float64 >( count )
+                     / static_cast< float64 >( report.voxel_count );
+            };
+
+            ImGui::Text( "Localizer coverage: %.1f%%", percent( report.localizer_covered ) );
+            ImGui::Text( "Glide slope coverage: %.1f%%", percent( report.glide_slope_covered ) );
+            ImGui::Text( "Both: %.1f%%", percent( report.both_covered ) );
+            ImGui::Text(
+                "Weakest CSB: %.2e (localizer), %.2e (glide slope)",
+                static_cast< float64 >( report.localizer_min_csb ),
+                static_cast< float64 >( report.glide_slope_min_csb )
+            );
+        }
+
+        ImGui::TreePop( );
+    }
+}
+
+auto IlsApp::configure_export_gui( ) -> void
+{
+    if ( ImGui::TreeNode( "Export" ) )
+    {
+        utils::ignore( ImGui::DragInt2(
+            "Export size (pixels)",
+            glm::value_ptr( export_size_pixels_ ),
+            256.0F,
+            256,
+            65'536
+        ) );
+
+        auto const layout = ils::field_export_layout( field_params( ), export_size_pixels_ );
+        ImGui::Text(
+            "%.1f MiB",
+            static_cast< float64 >( utils::tiled_field_file_size( layout ) ) / ( 1024.0 * 1024.0 )
         );
-        ImGui::PlotLines(
-            "SBO Modulated",
-            sbo_modulated_wave.data( ),
-            sample_points_i,
-            0,
-            nullptr,
-            -2.0F,
-            2.0F,
-            ImVec2( 0.0F, 100.0F )
+
+        if ( ImGui::Button( "Export field" ) )
+        {
+            LTB_CHECK_OR( export_field( ), utils::log_error );
+        }
+
+        if ( export_seconds_.has_value( ) )
+        {
+            ImGui::Text(
+                "Wrote '%s' in %.2f s",
+                export_path.string( ).c_str( ),
+                export_seconds_.value( )
+            );
+        }
+
+        ImGui::TreePop( );
+    }
+}
+
+auto IlsApp::build_volume_meshes( ) -> utils::Result< void >
+{
+    for ( auto const id : volume_mesh_ids_ )
+    {
+        mesh_pipeline_.remove( id );
+    }
+    volume_mesh_ids_.clear( );
+
+    auto const start     = std::chrono::steady_clock::now( );
+    auto const evaluator = ils::VolumeEvaluator{ {
+        .localizer   = field_params( ),
+        .glide_slope = glide_slope_params_,
+    } };
+
+    auto const add_mesh = [ this ]( math::Mesh3 const& mesh ) -> utils::Result< void >
+    {
+        auto id = gui::MeshId::nil( );
+        LTB_CHECK( id, mesh_pipeline_.initialize_mesh( mesh ) );
+        mesh_pipeline_.update_settings(
+            id,
+            gui::MeshDisplaySettings{
+                .visible      = true,
+                .color_mode   = gui::ColorMode::VertexColor,
+                .shading_mode = gui::ShadingMode::Flat,
+                .transforms   = { math::Scale3d{ .scale = glm::vec3( volume_display_scale ) } },
+            }
         );
-        ImGui::PlotLines(
-            "SBO Shifted",
-            sbo_shifted_wave.data( ),
-            sample_points_i,
-            0,
-            nullptr,
-            -2.0F,
-            2.0F,
-            ImVec2( 0.0F, 100.0F )
+        volume_mesh_ids_.push_back( id );
+        return utils::success( );
+    };
+
+    using Consts = ils::Constants< float32 >;
+
+    // The approach funnel: every voxel inside both the course and glide path sectors,
+    // colored by the glide slope DDM.
+    {
+        auto const count           = ils::voxel_count( volume_grid_ );
+        auto       localizer_ddm   = std::vector< float32 >( count );
+        auto       glide_slope_ddm = std::vector< float32 >( count );
+        LTB_CHECK( evaluator.evaluate(
+            volume_grid_,
+            { .localizer_ddm = localizer_ddm, .glide_slope_ddm = glide_slope_ddm }
+        ) );
+
+        auto const voxels = ils::layer_points( volume_grid_, 0, volume_grid_.size.z );
+
+        auto funnel = ils::Points{ };
+        auto colors = std::vector< glm::vec3 >{ };
+        for ( auto i = 0_UZ; i < count; ++i )
+        {
+            if ( ( std::abs( localizer_ddm[ i ] ) <= Consts::course_sector_ddm( ) )
+                 && ( std::abs( glide_slope_ddm[ i ] ) <= Consts::glide_path_sector_ddm( ) ) )
+            {
+                funnel.x_m.push_back( voxels.x_m[ i ] );
+                funnel.y_m.push_back( voxels.y_m[ i ] );
+                funnel.z_m.push_back( voxels.z_m[ i ] );
+                colors.push_back(
+                    ils::ddm_color( glide_slope_ddm[ i ], Consts::glide_path_sector_ddm( ) )
+                );
+            }
+        }
+
+        auto cloud = math::Mesh3{ };
+        LTB_CHECK( cloud, ils::point_cloud( funnel.view( ), colors ) );
+        LTB_CHECK( add_mesh( cloud ) );
+    }
+
+    auto const& bounds = volume_grid_.bounds_m;
+    auto const  size   = math::dimensions( bounds );
+
+    // The vertical plane through the mast along the approach shows the glide path, and
+    // a horizontal plane shows the localizer course.
+    auto const glide_slope_slice = ils::Slice{
+        .corner_m   = { bounds.min.x, glide_slope_params_.mast_position_m.y, bounds.min.z },
+        .u_extent_m = { size.x, 0.0F, 0.0F },
+        .v_extent_m = { 0.0F, 0.0F, size.z },
+        .size       = { 512, 256 },
+    };
+    auto const localizer_slice = ils::Slice{
+        .corner_m   = { bounds.min.x, bounds.min.y, horizontal_slice_m_ },
+        .u_extent_m = { size.x, 0.0F, 0.0F },
+        .v_extent_m = { 0.0F, size.y, 0.0F },
+        .size       = { 512, 256 },
+    };
+
+    for ( auto const& [ slice, glide_slope ] :
+          { std::pair{ glide_slope_slice, true }, std::pair{ localizer_slice, false } } )
+    {
+        auto ddm
+            = std::vector< float32 >( static_cast< std::size_t >( slice.size.x * slice.size.y ) );
+        LTB_CHECK( evaluator.evaluate(
+            slice,
+            glide_slope ? ils::VolumeOutput{ .glide_slope_ddm = ddm }
+                        : ils::VolumeOutput{ .localizer_ddm = ddm }
+        ) );
+
+        auto const full_scale
+            = glide_slope ? Consts::glide_path_sector_ddm( ) : Consts::course_sector_ddm( );
+
+        auto colors = std::vector< glm::vec3 >( ddm.size( ) );
+        std::ranges::transform(
+            ddm,
+            colors.begin( ),
+            [ full_scale ]( float32 const value ) { return ils::ddm_color( value, full_scale ); }
         );
+
+        auto mesh = math::Mesh3{ };
+        LTB_CHECK( mesh, ils::slice_mesh( slice, colors ) );
+        LTB_CHECK( add_mesh( mesh ) );
     }
-    ImGui::End( );
 
-    // auto const radians = phase_angle * glm::two_pi< float64 >( );
+    LTB_CHECK(
+        coverage_report_,
+        ils::check_coverage( evaluator, volume_grid_, coverage_requirements_ )
+    );
 
-    // auto const wave = glm::dvec2{ std::cos( radians ), std::sin( radians ) } * scale;
+    auto const elapsed = std::chrono::steady_clock::now( ) - start;
+    volume_seconds_
+        = std::chrono::duration_cast< std::chrono::duration< float64 > >( elapsed ).count( );
+
+    return utils::success( );
 }
 
-auto IlsApp::destroy( ) -> void
+auto IlsApp::export_field( ) -> utils::Result< void >
 {
-    vertex_array_ = { };
+    auto const start     = std::chrono::steady_clock::now( );
+    auto const evaluator = ils::FieldEvaluator{ field_params( ) };
 
-    program_ = { fullscreen_vertex_shader_, ils_fragment_shader_ };
+    // Pixels keep the on-screen size, so larger exports cover more of the approach.
+    LTB_CHECK( ils::export_field( evaluator, export_size_pixels_, export_path ) );
 
-    framebuffer_size_ = { };
+    auto const elapsed = std::chrono::steady_clock::now( ) - start;
+    export_seconds_
+        = std::chrono::duration_cast< std::chrono::duration< float64 > >( elapsed ).count( );
+    return utils::success( );
 }
 
-auto IlsApp::resize( glm::ivec2 const framebuffer_size ) -> void
-{ framebuffer_size_ = framebuffer_size; }
+auto IlsApp::validate_cpu_field( ) -> utils::Result< void >
+{
+    auto const total_size = utils::total_size( framebuffer_size_.x, framebuffer_size_.y );
+
+    // Read back what the shader just wrote before ImGui draws over it.
+    auto gpu_colors = std::vector< glm::vec3 >( total_size );
+    ogl::Framebuffer::read_pixels(
+        GL_BACK,
+        math::Range2Di{ .min = glm::ivec2{ 0, 0 }, .max = framebuffer_size_ },
+        GL_RGB,
+        GL_FLOAT,
+        gpu_colors.data( )
+    );
+
+    cpu_field_evaluator_.set_params( field_params( ) );
+
+    auto cpu_colors = std::vector< glm::vec3 >( total_size );
+    LTB_CHECK( cpu_field_evaluator_.evaluate_colors( framebuffer_size_, cpu_colors ) );
+
+    auto max_difference = 0.0F;
+    for ( auto i = 0_UZ; i < total_size; ++i )
+    {
+        // The default framebuffer clamps colors to [0, 1].
+        auto const cpu_color
+            = glm::clamp( cpu_colors[ i ], glm::vec3( 0.0F ), glm::vec3( 1.0F ) );
+        auto const difference = glm::abs( cpu_color - gpu_colors[ i ] );
+
+        max_difference
+            = std::max( { max_difference, difference.x, difference.y, difference.z } );
+    }
+
+    spdlog::info( "CPU/GPU ILS field max difference: {}", max_difference );
+    cpu_field_max_difference_ = max_difference;
+
+    return utils::success( );
+}
 } // namespace ltb::app
@@ -1,105 +1,75 @@
 #include "ltb/app/vor_app.hpp"
 
+// project
+#include "ltb/dsp/baseband.hpp"
+#include "ltb/dsp/impairments.hpp"
+#include "ltb/gui/dsp.hpp"
+#include "ltb/gui/plot_lines.hpp"
+#include "ltb/ils/course_analysis.hpp"
+#include "ltb/utils/error_callback.hpp"
+#include "ltb/utils/ignore.hpp"
+#include "ltb/utils/size_utils.hpp"
+
 // external
 #include <glm/gtc/constants.hpp>
 
 // standard
 #include <algorithm>
-#include <ranges>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <utility>
 
 namespace ltb::app
 {
 namespace
 {
 
-auto constexpr ms_from_s = 1.0e6F;
+// The modulation is generated as complex baseband at an audio rate; only the plot of the
+// passband is upconverted, to a display carrier slow enough to see.
+constexpr auto baseband_sample_rate_hz   = 48'000.0;
+constexpr auto carrier_offset_range_hz   = std::array{ -2'000.0, 2'000.0 };
+constexpr auto display_carrier_range_khz = std::array{ 12.0, 200.0 };
 
-auto constexpr vor_frequency_range_mhz = math::Range< float64 >{
-    .min = 108.0F,
-    .max = 117.95F,
-};
-auto constexpr vor_period_ms = math::Range< float64 >{
-    .min = 1.0F / ( vor_frequency_range_mhz.max ),
-    .max = 1.0F / ( vor_frequency_range_mhz.min )
-};
+constexpr auto point_count_range = std::array{ 1'000, 1'000'000 };
 
-constexpr auto reference_audio_frequency_hz = 9960.0F;
-constexpr auto variable_audio_frequency_hz  = 480.0F;
+auto constexpr x_axis_time_ms = 100.0F;
+
+constexpr auto receiver_duration_range_s = std::array{ 0.1F, 10.0F };
+constexpr auto receiver_cnr_range_db      = std::array{ 0.0F, 60.0F };
 
-constexpr auto audio_frequency_range_hz = math::Range< float64 >{
-    .min = reference_audio_frequency_hz - variable_audio_frequency_hz,
-    .max = reference_audio_frequency_hz + variable_audio_frequency_hz
+// Interferers on the composite: a CW tone just below the 9960 Hz subcarrier and an FM
+// broadcast's audio swinging across the top of it.
+constexpr auto receiver_cw_interferer = dsp::InterfererParams{
+    .offset_hz = 9'500.0,
+    .amplitude = 0.05F,
 };
-constexpr auto audio_period_range_ms = math::Range< float64 >{
-    .min = ms_from_s / audio_frequency_range_hz.max,
-    .max = ms_from_s / audio_frequency_range_hz.min
+constexpr auto receiver_fm_interferer = dsp::InterfererParams{
+    .offset_hz     = 12'000.0,
+    .amplitude     = 0.1F,
+    .deviation_hz  = 3'000.0,
+    .modulation_hz = 1'000.0,
 };
 
-[[maybe_unused]] auto constexpr vor_period_max = vor_period_ms.max;
-[[maybe_unused]] auto constexpr vor_period_min = vor_period_ms.min;
-
-[[maybe_unused]] auto constexpr audio_period_max = audio_period_range_ms.max;
-[[maybe_unused]] auto constexpr audio_period_min = audio_period_range_ms.min;
+constexpr auto scope_window_range_s = std::array{ 0.05F, 30.0F };
 
-constexpr auto num_points = 50'000_UZ;
+constexpr auto siting_altitudes_m    = std::array{ 300.0F, 1'500.0F, 6'000.0F };
+constexpr auto siting_min_range_m    = 500.0F;
+constexpr auto siting_ground_reflect = glm::vec2{ -1.0F, 0.0F };
+constexpr auto siting_wall_reflect   = glm::vec2{ -0.5F, 0.0F };
 
-auto constexpr x_axis_time_ms = 100.0F;
-auto const step               = x_axis_time_ms / static_cast< float64 >( num_points );
-
-template < typename F >
-auto update_frequency_values(
-    std::vector< float64 > const& x_values,
-    F const&                      f,
-    std::vector< float64 >&       y_values
-) -> void
+/// \brief A wall centered \p range_m along \p radial_rad, facing the station.
+auto facing_wall( float32 const radial_rad, float32 const range_m, glm::vec2 const size_m )
+    -> ils::Reflector
 {
-    y_values.resize( x_values.size( ) );
+    auto const center = glm::vec2( std::sin( radial_rad ), std::cos( radial_rad ) ) * range_m;
 
-    auto const size = x_values.size( );
-    for ( auto i = 0U; i < size; ++i )
-    {
-        auto const x  = x_values[ i ];
-        y_values[ i ] = f( x );
-    }
+    // `vertical_wall` reflects to the left of its direction, back toward the station.
+    auto const along = glm::vec2( std::cos( radial_rad ), -std::sin( radial_rad ) );
+    auto const half  = along * ( size_m.x * 0.5F );
+    return ils::vertical_wall( center - half, center + half, size_m.y, siting_wall_reflect );
 }
 
-struct StandardFrequencyFunctor
-{
-    float64 const& base_frequency_period_s_;
-
-    auto operator( )( float64 const x ) const -> float64
-    {
-        auto const angle = ( x / base_frequency_period_s_ ) * glm::two_pi< float64 >( );
-        return std::sin( angle );
-    }
-};
-
-struct AudioFrequencyFunctor
-{
-    math::Range< float64 > const& audio_wavelength_range_m_;
-    float64 const                 audio_range_size_ = math::dimensions( audio_wavelength_range_m_ );
-
-    auto operator( )( float64 const x ) const -> float64
-    {
-        constexpr auto thirty_hz_period_s = 1.0F / 30.0;
-
-        auto const variable_angle = ( x / thirty_hz_period_s ) * glm::two_pi< float64 >( );
-        auto const period_scale   = ( std::sin( variable_angle ) * 0.5 ) + 0.5;
-        auto const period_s = audio_wavelength_range_m_.min + ( period_scale * audio_range_size_ );
-
-        auto const base_angle = ( x / period_s ) * glm::two_pi< float64 >( );
-        return std::sin( base_angle );
-    }
-};
-
-struct AmplitudeModulation
-{
-    auto operator( )( float64 const carrier, float64 const amplitude ) const -> float64
-    {
-        return carrier * ( ( amplitude * 0.5 ) + 0.5 );
-    }
-};
-
 } // namespace
 
 VorApp::VorApp( window::Window& window, gui::ImguiSetup& imgui_setup )
@@ -129,12 +99,6 @@ auto VorApp::initialize( ) -> utils::Result< VorApp* >
 
     glClearColor( 0.5F, 0.5F, 0.5F, 1.0F );
 
-    time_ms_x_values_.resize( num_points );
-    for ( auto i = 0U; i < num_points; ++i )
-    {
-        time_ms_x_values_[ i ] = static_cast< float64 >( i ) * step;
-    }
-
     update_frequencies( );
     return this;
 }
@@ -172,12 +136,36 @@ auto VorApp::render_gui( ) -> void
     if ( ImGui::Begin( "Frequencies" ) )
     {
         if ( ImGui::SliderScalar(
-                 "##carrier_frequency",
+                 "Carrier offset (Hz)",
+                 ImGuiDataType_Double,
+                 &carrier_offset_hz_,
+                 &carrier_offset_range_hz.front( ),
+                 &carrier_offset_range_hz.back( ),
+                 "%.0f"
+             ) )
+        {
+            update_frequencies( );
+        }
+
+        if ( ImGui::SliderScalar(
+                 "Display carrier (kHz)",
                  ImGuiDataType_Double,
-                 &carrier_frequency_mhz_,
-                 &vor_frequency_range_mhz.min,
-                 &vor_frequency_range_mhz.max,
-                 "%.2f"
+                 &display_carrier_khz_,
+                 &display_carrier_range_khz.front( ),
+                 &display_carrier_range_khz.back( ),
+                 "%.1f"
+             ) )
+        {
+            update_frequencies( );
+        }
+
+        if ( ImGui::SliderInt(
+                 "Points",
+                 &point_count_,
+                 point_count_range.front( ),
+                 point_count_range.back( ),
+                 "%d",
+                 ImGuiSliderFlags_Logarithmic
              ) )
         {
             update_frequencies( );
@@ -193,46 +181,22 @@ auto VorApp::render_gui( ) -> void
                  ImPlotSubplotFlags_LinkCols
              ) )
         {
-
-            if ( ImPlot::BeginPlot( "Carrier Frequency (108.0-117.95 MHz)" ) )
+            if ( ImPlot::BeginPlot( "Complex Baseband (48 kHz)" ) )
             {
                 ImPlot::SetupAxes( "Time (ms)", "Amplitude" );
-                ImPlot::SetupAxesLimits( 0.0F, x_axis_time_ms, -1.0F, +1.0F );
-                // ImPlot::SetupAxesLimits( ImAxis_X1, 0.0F, x_axis_time_ms, ImPlotCond_Once );
-                // ImPlot::SetupAxisLimits( ImAxis_Y1, -1.0F, +1.0F, ImPlotCond_Always );
-
-                // ImPlot::SetupAxisLimitsConstraints( ImAxis_Y1, -1.0F, +1.0F );
-                // ImPlot::SetupAxisZoomConstraints( ImAxis_Y1, -1.0F, +1.0F );
-
-                ImPlot::PlotLine(
-                    "f(x)",
-                    time_ms_x_values_.data( ),
-                    carrier_wave_y_values_.data( ),
-                    static_cast< int32 >( num_points )
-                );
-
-                ImPlot::PlotLine(
-                    "f(x)",
-                    time_ms_x_values_.data( ),
-                    reference_audio_wave_y_values_.data( ),
-                    static_cast< int32 >( num_points )
-                );
+                ImPlot::SetupAxesLimits( 0.0F, x_axis_time_ms, -2.0F, +2.0F );
+
+                gui::plot_line( "I", baseband_i_lod_ );
+                gui::plot_line( "Q", baseband_q_lod_ );
                 ImPlot::EndPlot( );
             }
 
-            if ( ImPlot::BeginPlot( "Amplitude Modulation" ) )
+            if ( ImPlot::BeginPlot( "Passband (display only)" ) )
             {
                 ImPlot::SetupAxes( "Time (ms)", "Amplitude" );
-                // ImPlot::SetupAxesLimits( ImAxis_X1, 0.0F, x_axis_time_ms, ImPlotCond_Once );
-                // ImPlot::SetupAxisLimits( ImAxis_Y1, -1.0F, +1.0F, ImPlotCond_Always );
-                ImPlot::SetupAxesLimits( 0.0F, x_axis_time_ms, -1.0F, +1.0F );
-
-                ImPlot::PlotLine(
-                    "f(x)",
-                    time_ms_x_values_.data( ),
-                    composite_radio_wave_y_values_.data( ),
-                    static_cast< int32 >( num_points )
-                );
+                ImPlot::SetupAxesLimits( 0.0F, x_axis_time_ms, -2.0F, +2.0F );
+
+                gui::plot_line( "passband", passband_lod_ );
                 ImPlot::EndPlot( );
             }
 
@@ -241,39 +205,480 @@ auto VorApp::render_gui( ) -> void
     }
     ImGui::End( );
 
+    if ( ImGui::Begin( "Spectrum" ) )
+    {
+        configure_spectrum_gui( );
+    }
+    ImGui::End( );
+
+    if ( ImGui::Begin( "Receiver" ) )
+    {
+        configure_receiver_gui( );
+    }
+    ImGui::End( );
+
+    if ( ImGui::Begin( "Siting" ) )
+    {
+        configure_siting_gui( );
+    }
+    ImGui::End( );
+
+    LTB_CHECK_OR( advance_scope( ), utils::log_error );
+    if ( ImGui::Begin( "Scope" ) )
+    {
+        configure_scope_gui( );
+    }
+    ImGui::End( );
+
     ImPlot::ShowDemoWindow( );
 
     imgui_setup_.render( );
 }
 
+auto VorApp::configure_receiver_gui( ) -> void
+{
+    utils::ignore( ImGui::SliderFloat( "Bearing (deg)", &receiver_bearing_deg_, 0.0F, 360.0F ) );
+    utils::ignore( ImGui::SliderFloat(
+        "Duration (s)",
+        &receiver_duration_s_,
+        receiver_duration_range_s.front( ),
+        receiver_duration_range_s.back( ),
+        "%.1f",
+        ImGuiSliderFlags_Logarithmic
+    ) );
+
+    utils::ignore( ImGui::Checkbox( "Noise", &receiver_noise_enabled_ ) );
+    if ( receiver_noise_enabled_ )
+    {
+        ImGui::SameLine( );
+        utils::ignore( ImGui::SliderFloat(
+            "Carrier to noise (dB)",
+            &receiver_cnr_db_,
+            receiver_cnr_range_db.front( ),
+            receiver_cnr_range_db.back( ),
+            "%.1f"
+        ) );
+    }
+    utils::ignore( ImGui::Checkbox( "CW interferer", &receiver_cw_enabled_ ) );
+    ImGui::SameLine( );
+    utils::ignore( ImGui::Checkbox( "FM interferer", &receiver_fm_enabled_ ) );
+
+    if ( ImGui::Button( "Run receiver" ) )
+    {
+        LTB_CHECK_OR( run_receiver( ), utils::log_error );
+    }
+
+    if ( !receiver_throughput_.has_value( ) )
+    {
+        return;
+    }
+
+    auto const& throughput = receiver_throughput_.value( );
+    ImGui::Text(
+        "Modulator: %.1f Msamples/s, Impairments: %.1f Msamples/s, Receiver: %.1f Msamples/s",
+        throughput.modulator_samples_per_s * 1.0e-6,
+        throughput.impairment_samples_per_s * 1.0e-6,
+        throughput.receiver_samples_per_s * 1.0e-6
+    );
+    ImGui::Text(
+        "Measured bearing: %.3f deg (error %.3f deg)",
+        static_cast< float64 >( measured_bearing_deg_ ),
+        static_cast< float64 >( measured_bearing_deg_ - receiver_bearing_deg_ )
+    );
+
+    constexpr auto rows = 2;
+    constexpr auto cols = 1;
+    if ( ImPlot::BeginSubplots( "##receiver", rows, cols, ImVec2( -1.0F, -1.0F ) ) )
+    {
+        if ( ImPlot::BeginPlot( "VOR Composite" ) )
+        {
+            ImPlot::SetupAxes( "Time (ms)", "Amplitude" );
+            ImPlot::SetupAxesLimits( 0.0F, x_axis_time_ms, 0.0F, 2.0F );
+            gui::plot_line( "composite", receiver_composite_lod_ );
+            ImPlot::EndPlot( );
+        }
+
+        if ( ImPlot::BeginPlot( "Recovered Bearing" ) )
+        {
+            ImPlot::SetupAxes( "Time (s)", "Bearing (deg)" );
+            ImPlot::SetupAxesLimits( 0.0F, receiver_duration_s_, 0.0F, 360.0F );
+            gui::plot_line( "bearing", receiver_bearing_lod_ );
+            ImPlot::EndPlot( );
+        }
+
+        ImPlot::EndSubplots( );
+    }
+}
+
+auto VorApp::configure_siting_gui( ) -> void
+{
+    auto const unused_return_values = std::array{
+        ImGui::SliderFloat( "Array half side (m)", &siting_half_side_m_, 0.05F, 1.5F ),
+        ImGui::Checkbox( "Ground reflection", &siting_ground_enabled_ ),
+        ImGui::Checkbox( "Wall", &siting_wall_enabled_ ),
+        ImGui::SliderAngle( "Wall radial", &siting_wall_radial_rad_, 0.0F, 360.0F ),
+        ImGui::SliderFloat( "Wall range (m)", &siting_wall_range_m_, 20.0F, 2'000.0F ),
+        ImGui::SliderFloat2( "Wall size (m)", &siting_wall_size_m_.x, 1.0F, 200.0F ),
+        ImGui::SliderInt( "Radials", &siting_radial_count_, 8, 720 ),
+        ImGui::SliderInt( "Ranges", &siting_range_count_, 2, 400 ),
+        ImGui::SliderFloat( "Max range (m)", &siting_max_range_m_, 1'000.0F, 200'000.0F ),
+    };
+    utils::ignore( unused_return_values );
+
+    if ( ImGui::Button( "Run sweep" ) )
+    {
+        LTB_CHECK_OR( run_sweep( ), utils::log_error );
+    }
+
+    if ( !siting_table_.has_value( ) )
+    {
+        return;
+    }
+
+    auto const& grid = siting_table_->grid;
+    ImGui::Text( "%zu points in %.3f s", siting_table_->error_rad.size( ), siting_seconds_ );
+
+    if ( ImGui::BeginTable( "##errors", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg ) )
+    {
+        ImGui::TableSetupColumn( "Altitude (m)" );
+        ImGui::TableSetupColumn( "Max error (deg)" );
+        ImGui::TableSetupColumn( "RMS error (deg)" );
+        ImGui::TableSetupColumn( "Worst radial (deg)" );
+        ImGui::TableSetupColumn( "Worst range (m)" );
+        ImGui::TableHeadersRow( );
+
+        for ( auto a = 0_UZ; a < siting_summaries_.size( ); ++a )
+        {
+            auto const& summary = siting_summaries_[ a ];
+
+            ImGui::TableNextRow( );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%.0f", static_cast< float64 >( grid.altitudes_m[ a ] ) );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%.3f", glm::degrees( summary.max_abs_error_rad ) );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%.3f", glm::degrees( summary.rms_error_rad ) );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%.1f", glm::degrees( summary.worst_radial_rad ) );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%.0f", static_cast< float64 >( summary.worst_range_m ) );
+        }
+        ImGui::EndTable( );
+    }
+
+    if ( ImGui::SliderInt(
+             "Altitude",
+             &siting_altitude_index_,
+             0,
+             static_cast< int32 >( grid.altitudes_m.size( ) ) - 1
+         ) )
+    {
+        update_heat_map( );
+    }
+
+    auto const& summary = siting_summaries_[ static_cast< std::size_t >( siting_altitude_index_ ) ];
+    auto const  scale_deg   = static_cast< float64 >( glm::degrees( summary.max_abs_error_rad ) );
+    auto const  scale_width = 80.0F;
+
+    ImPlot::PushColormap( ImPlotColormap_Jet );
+    if ( ImPlot::BeginPlot( "Bearing Error", ImVec2( -scale_width, -1.0F ) ) )
+    {
+        ImPlot::SetupAxes( "Range (m)", "Radial (deg)" );
+        ImPlot::PlotHeatmap(
+            "error",
+            siting_heat_map_deg_.data( ),
+            static_cast< int32 >( grid.radials_rad.size( ) ),
+            static_cast< int32 >( grid.ranges_m.size( ) ),
+            -scale_deg,
+            +scale_deg,
+            nullptr,
+            ImPlotPoint( grid.ranges_m.front( ), 0.0 ),
+            ImPlotPoint( grid.ranges_m.back( ), 360.0 )
+        );
+        ImPlot::EndPlot( );
+    }
+    ImGui::SameLine( );
+    ImPlot::ColormapScale( "Error (deg)", -scale_deg, +scale_deg, ImVec2( scale_width, -1.0F ) );
+    ImPlot::PopColormap( );
+}
+
+auto VorApp::configure_scope_gui( ) -> void
+{
+    utils::ignore( ImGui::Checkbox( "Running", &scope_running_ ) );
+
+    if ( ImGui::SliderFloat(
+             "Window (s)",
+             &scope_window_s_,
+             scope_window_range_s.front( ),
+             scope_window_range_s.back( ),
+             "%.2f",
+             ImGuiSliderFlags_Logarithmic
+         ) )
+    {
+        // The ring is sized for the window, so a new one starts over empty.
+        scope_ = vor::Scope{ {
+            .modulator = { .bearing_rad = glm::radians( scope_bearing_deg_ ) },
+            .window_s  = static_cast< float64 >( scope_window_s_ ),
+        } };
+    }
+
+    if ( ImGui::SliderFloat( "Bearing (deg)", &scope_bearing_deg_, 0.0F, 360.0F ) )
+    {
+        scope_.set_bearing( glm::radians( scope_bearing_deg_ ) );
+    }
+
+    auto const& samples = scope_.samples( );
+    ImGui::Text( "%zu of %zu samples", samples.size( ), samples.capacity( ) );
+
+    if ( ImPlot::BeginPlot( "Composite", ImVec2( -1.0F, -1.0F ) ) )
+    {
+        // While running, the newest window scrolls past; paused, it can be zoomed freely.
+        auto const end_s = scope_.end_time_s( );
+        ImPlot::SetupAxes( "Time (s)", "Amplitude" );
+        ImPlot::SetupAxisLimits(
+            ImAxis_X1,
+            end_s - static_cast< float64 >( scope_window_s_ ),
+            end_s,
+            scope_running_ ? ImPlotCond_Always : ImPlotCond_Once
+        );
+        ImPlot::SetupAxisLimits( ImAxis_Y1, 0.0, 2.0, ImPlotCond_Once );
+
+        gui::plot_line( "composite", samples, scope_.start_time_s( ), scope_.sample_period_s( ) );
+        ImPlot::EndPlot( );
+    }
+}
+
+auto VorApp::configure_spectrum_gui( ) -> void
+{
+    gui::configure_fft_benchmark( fft_throughput_ );
+    gui::configure_decimation_benchmark( decimation_throughput_ );
+    gui::configure_noise_benchmark( noise_throughput_ );
+
+    if ( ImPlot::BeginPlot( "Baseband Spectrum", ImVec2( -1.0F, -1.0F ) ) )
+    {
+        auto const half_rate_hz = baseband_sample_rate_hz * 0.5;
+        ImPlot::SetupAxes( "Offset from carrier (Hz)", "Level (dB)" );
+        ImPlot::SetupAxesLimits( -half_rate_hz, half_rate_hz, -140.0, 10.0 );
+
+        gui::plot_spectrum(
+            "baseband",
+            baseband_spectrum_,
+            -half_rate_hz,
+            spectrum_analyzer_.bin_hz( )
+        );
+        ImPlot::EndPlot( );
+    }
+}
+
 auto VorApp::update_frequencies( ) -> void
 {
-    carrier_frequency_period_ms_ = 1.0F / carrier_frequency_mhz_;
+    constexpr auto ms_per_s = 1.0e3;
 
-    update_frequency_values(
-        time_ms_x_values_,
-        StandardFrequencyFunctor{ carrier_frequency_period_ms_ },
-        carrier_wave_y_values_
+    auto const baseband_count = static_cast< std::size_t >(
+        static_cast< float64 >( x_axis_time_ms ) * baseband_sample_rate_hz / ms_per_s
+    );
+    auto const step_ms = ms_per_s / baseband_sample_rate_hz;
+
+    // Everything up to the plot runs at the baseband rate, however high the carrier.
+    auto modulator = vor::Modulator{ {
+        .sample_rate_hz    = baseband_sample_rate_hz,
+        .bearing_rad       = glm::radians( receiver_bearing_deg_ ),
+        .carrier_offset_hz = carrier_offset_hz_,
+    } };
+    baseband_values_.resize( baseband_count );
+    modulator.process_iq( baseband_values_ );
+
+    auto const spectrum_size = spectrum_analyzer_.params( ).size;
+    if ( baseband_count >= spectrum_size )
+    {
+        baseband_spectrum_.resize( spectrum_size );
+        LTB_CHECK_OR(
+            spectrum_analyzer_.iq_spectrum(
+                std::span( baseband_values_ ).first( spectrum_size ),
+                baseband_spectrum_
+            ),
+            utils::log_error
+        );
+    }
+
+    baseband_i_values_.resize( baseband_count );
+    baseband_q_values_.resize( baseband_count );
+    std::ranges::transform(
+        baseband_values_,
+        baseband_i_values_.begin( ),
+        []( dsp::Iq const sample ) { return sample.x; }
+    );
+    std::ranges::transform(
+        baseband_values_,
+        baseband_q_values_.begin( ),
+        []( dsp::Iq const sample ) { return sample.y; }
+    );
+
+    // The points slider only sets how finely the upconverted passband is drawn.
+    auto const factor = std::max(
+        1_UZ,
+        static_cast< std::size_t >( point_count_ ) / std::max( 1_UZ, baseband_count )
+    );
+    passband_values_.resize( baseband_count * factor );
+    LTB_CHECK_OR(
+        dsp::upconvert(
+            baseband_values_,
+            baseband_sample_rate_hz,
+            display_carrier_khz_ * 1.0e3,
+            passband_values_
+        ),
+        utils::log_error
+    );
+
+    baseband_i_lod_.set_values( baseband_i_values_, 0.0, step_ms );
+    baseband_q_lod_.set_values( baseband_q_values_, 0.0, step_ms );
+    passband_lod_.set_values( passband_values_, 0.0, step_ms / static_cast< float64 >( factor ) );
+}
+
+auto VorApp::run_receiver( ) -> utils::Result< void >
+{
+    auto modulator = vor::Modulator{ {
+        .bearing_rad = glm::radians( receiver_bearing_deg_ ),
+    } };
+    auto receiver = vor::BearingReceiver{ { } };
+
+    auto const sample_rate_hz = modulator.params( ).sample_rate_hz;
+    auto const sample_count   = static_cast< std::size_t >(
+        static_cast< float64 >( receiver_duration_s_ ) * sample_rate_hz
     );
 
-    auto const variable_audio_period_ms = ms_from_s / reference_audio_frequency_hz;
+    // The carrier is the composite's unit mean, so has a power of 1.
+    auto chain = vor::ChainParams{ };
+    if ( receiver_noise_enabled_ )
+    {
+        chain.impairments.noise_sigma
+            = dsp::noise_sigma( 1.0, static_cast< float64 >( receiver_cnr_db_ ) );
+    }
+    if ( receiver_cw_enabled_ )
+    {
+        chain.impairments.interferers.push_back( receiver_cw_interferer );
+    }
+    if ( receiver_fm_enabled_ )
+    {
+        chain.impairments.interferers.push_back( receiver_fm_interferer );
+    }
+
+    receiver_composite_values_.clear( );
+    receiver_bearing_values_.clear( );
+    receiver_composite_values_.reserve( sample_count );
+    receiver_bearing_values_.reserve( sample_count );
+
+    auto const collect
+        = [ this ]( std::span< float32 const > const composite, vor::BearingOutput const& output )
+    {
+        receiver_composite_values_.insert(
+            receiver_composite_values_.end( ),
+            composite.begin( ),
+            composite.end( )
+        );
+        for ( auto const bearing_rad : output.bearing_rad )
+        {
+            receiver_bearing_values_.push_back( glm::degrees( bearing_rad ) );
+        }
+    };
 
-    update_frequency_values(
-        time_ms_x_values_,
-        StandardFrequencyFunctor{ variable_audio_period_ms },
-        reference_audio_wave_y_values_
+    LTB_CHECK(
+        auto const throughput,
+        vor::run_signal_chain( modulator, receiver, sample_count, chain, collect )
     );
 
-    composite_radio_wave_y_values_.resize( time_ms_x_values_.size( ) );
-    utils::ignore(
-        // Ignore the returned iterator
-        std::ranges::transform(
-            carrier_wave_y_values_,
-            reference_audio_wave_y_values_,
-            composite_radio_wave_y_values_.begin( ),
-            AmplitudeModulation{ }
-        )
+    receiver_throughput_  = throughput;
+    measured_bearing_deg_ = static_cast< float32 >( receiver_bearing_values_.back( ) );
+
+    auto const step_s = 1.0 / sample_rate_hz;
+    receiver_composite_lod_.set_values( receiver_composite_values_, 0.0, step_s * 1.0e3 );
+    receiver_bearing_lod_.set_values( receiver_bearing_values_, 0.0, step_s );
+    return utils::success( );
+}
+
+auto VorApp::run_sweep( ) -> utils::Result< void >
+{
+    auto params = vor::StationParams{
+        .sideband_elements = vor::square_layout( siting_half_side_m_ ),
+    };
+    if ( siting_ground_enabled_ )
+    {
+        params.reflectors.push_back( ils::ground_plane( siting_ground_reflect ) );
+    }
+    if ( siting_wall_enabled_ )
+    {
+        params.reflectors.push_back(
+            facing_wall( siting_wall_radial_rad_, siting_wall_range_m_, siting_wall_size_m_ )
+        );
+    }
+
+    auto radials = std::vector< float32 >( static_cast< std::size_t >( siting_radial_count_ ) );
+    for ( auto i = 0_UZ; i < radials.size( ); ++i )
+    {
+        radials[ i ] = glm::two_pi< float32 >( ) * static_cast< float32 >( i )
+                     / static_cast< float32 >( radials.size( ) );
+    }
+
+    auto const start = std::chrono::steady_clock::now( );
+    LTB_CHECK(
+        auto table,
+        vor::BearingSweep{ std::move( params ) }.sweep( {
+            .radials_rad = std::move( radials ),
+            .ranges_m    = ils::linspace(
+                { .min = siting_min_range_m, .max = siting_max_range_m_ },
+                static_cast< std::size_t >( siting_range_count_ )
+            ),
+            .altitudes_m = { siting_altitudes_m.begin( ), siting_altitudes_m.end( ) },
+        } )
     );
+    auto const elapsed = std::chrono::steady_clock::now( ) - start;
+    siting_seconds_
+        = std::chrono::duration_cast< std::chrono::duration< float64 > >( elapsed ).count( );
+
+    siting_summaries_.clear( );
+    for ( auto a = 0_UZ; a < table.grid.altitudes_m.size( ); ++a )
+    {
+        siting_summaries_.push_back( vor::summarize( table, a ) );
+    }
+
+    siting_table_ = std::move( table );
+    update_heat_map( );
+    return utils::success( );
+}
+
+auto VorApp::update_heat_map( ) -> void
+{
+    auto const& table    = siting_table_.value( );
+    auto const  altitude = static_cast< std::size_t >( siting_altitude_index_ );
+    auto const  plane    = table.altitude_plane( altitude );
+
+    auto const radial_count = table.grid.radials_rad.size( );
+    auto const range_count  = table.grid.ranges_m.size( );
+
+    siting_heat_map_deg_.resize( plane.size( ) );
+    for ( auto radial = 0_UZ; radial < radial_count; ++radial )
+    {
+        auto const row = radial_count - 1_UZ - radial;
+        for ( auto range = 0_UZ; range < range_count; ++range )
+        {
+            siting_heat_map_deg_[ utils::array_index( range, row, range_count ) ]
+                = glm::degrees( plane[ utils::array_index( range, radial, range_count ) ] );
+        }
+    }
+}
+
+auto VorApp::advance_scope( ) -> utils::Result< void >
+{
+    auto const now  = std::chrono::steady_clock::now( );
+    auto const last = std::exchange( scope_last_frame_, now );
+
+    if ( scope_running_ && last.has_value( ) )
+    {
+        auto const elapsed_s
+            = std::chrono::duration_cast< std::chrono::duration< float64 > >( now - *last );
+        LTB_CHECK( scope_.advance( elapsed_s.count( ) ) );
+    }
+    return utils::success( );
 }
 
 } // namespace ltb::app
@@ -0,0 +1,257 @@
+#include "ltb/dsp/am_detector.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace ltb::dsp
+{
+namespace
+{
+
+constexpr auto smoothing_order = 4_UZ;
+
+/// \brief The mean of `|cos|` is 2/π, so this keeps a rectified carrier at its amplitude.
+constexpr auto rectified_gain = glm::half_pi< float32 >( );
+
+auto valid( AmDetectorParams const& params ) -> bool
+{
+    return ( params.sample_rate_hz > 0.0 ) && ( params.envelope_bandwidth_hz > 0.0 )
+        && ( params.envelope_bandwidth_hz < ( 0.5 * params.sample_rate_hz ) )
+        && ( params.agc_window_hz > 0.0 ) && ( params.agc_window_hz <= params.sample_rate_hz )
+        && ( std::fmod( params.sample_rate_hz, params.agc_window_hz ) == 0.0 )
+        && ( params.target_level > 0.0F ) && ( params.max_gain > 0.0F )
+        && ( params.channel_count > 0_UZ );
+}
+
+/// \brief The mean time in seconds \p detector takes to detect \p input, repeated for at
+///        least \p seconds.
+template < typename Input >
+auto time_detection(
+    AmDetector&                    detector,
+    std::span< Input const > const input,
+    std::span< float32 > const     output,
+    float64 const                  seconds
+) -> utils::Result< float64 >
+{
+    using Clock = std::chrono::steady_clock;
+
+    auto       blocks  = 0_UZ;
+    auto const start   = Clock::now( );
+    auto       elapsed = 0.0;
+    do
+    {
+        LTB_CHECK( detector.process( input, output ) );
+        ++blocks;
+        elapsed = std::chrono::duration< float64 >( Clock::now( ) - start ).count( );
+    } while ( elapsed < seconds );
+
+    return elapsed / static_cast< float64 >( blocks );
+}
+
+} // namespace
+
+AmDetector::AmDetector( AmDetectorParams params )
+    : params_( std::move( params ) )
+{
+    if ( !valid( params_ ) )
+    {
+        return;
+    }
+
+    window_size_ = static_cast< std::size_t >( params_.sample_rate_hz / params_.agc_window_hz );
+
+    smoothing_ = BiquadCascade{
+        butterworth_low_pass< smoothing_order >(
+            params_.envelope_bandwidth_hz,
+            params_.sample_rate_hz
+        ),
+        params_.channel_count,
+    };
+
+    sums_.resize( params_.channel_count, 0.0 );
+    gains_.resize( params_.channel_count, 1.0 );
+    steps_.resize( params_.channel_count, 0.0 );
+}
+
+auto AmDetector::params( ) const -> AmDetectorParams const&
+{
+    return params_;
+}
+
+auto AmDetector::window_size( ) const -> std::size_t
+{
+    return window_size_;
+}
+
+auto AmDetector::sample_count( ) const -> std::size_t
+{
+    return sample_count_;
+}
+
+auto AmDetector::gains( ) const -> std::vector< float64 > const&
+{
+    return gains_;
+}
+
+auto AmDetector::passband_delay_samples( ) const -> float64
+{
+    return group_delay_at_dc( smoothing_.sections( ) );
+}
+
+auto AmDetector::process(
+    std::span< float32 const > const passband,
+    std::span< float32 > const       envelope
+) -> utils::Result< void >
+{
+    LTB_CHECK( check( passband.size( ), envelope.size( ) ) );
+
+    std::ranges::transform(
+        passband,
+        envelope.begin( ),
+        []( float32 const sample ) { return std::abs( sample ) * rectified_gain; }
+    );
+    LTB_CHECK( smoothing_.process( envelope, envelope ) );
+
+    control( envelope );
+    return utils::success( );
+}
+
+auto AmDetector::process( std::span< Iq const > const iq, std::span< float32 > const envelope )
+    -> utils::Result< void >
+{
+    LTB_CHECK( check( iq.size( ), envelope.size( ) ) );
+    LTB_CHECK( dsp::envelope( iq, envelope ) );
+
+    control( envelope );
+    return utils::success( );
+}
+
+auto AmDetector::check( std::size_t const inputs, std::size_t const outputs ) const
+    -> utils::Result< void >
+{
+    LTB_CHECK_VALID( window_size_ > 0_UZ, "Invalid AM detector parameters" );
+    LTB_CHECK_VALID(
+        0_UZ == ( inputs % params_.channel_count ),
+        "Every sample needs every channel"
+    );
+    LTB_CHECK_VALID( outputs == inputs, "One envelope sample per input sample" );
+    return utils::success( );
+}
+
+auto AmDetector::control( std::span< float32 > const envelope ) -> void
+{
+    auto const channels = params_.channel_count;
+    auto const window   = static_cast< float64 >( window_size_ );
+    auto const target   = static_cast< float64 >( params_.target_level );
+    auto const floor    = target / static_cast< float64 >( params_.max_gain );
+
+    auto* const sums  = sums_.data( );
+    auto* const gains = gains_.data( );
+    auto* const steps = steps_.data( );
+
+    for ( auto start = 0_UZ; start < envelope.size( ); start += channels )
+    {
+        auto* const frame = envelope.data( ) + start;
+
+        if ( sample_count_ < window_size_ )
+        {
+            auto const count = static_cast< float64 >( sample_count_ + 1_UZ );
+            for ( auto c = 0_UZ; c < channels; ++c )
+            {
+                auto const sample = static_cast< float64 >( frame[ c ] );
+                sums[ c ] += sample;
+                gains[ c ] = target / std::max( sums[ c ] / count, floor );
+                frame[ c ] = static_cast< float32 >( sample * gains[ c ] );
+            }
+        }
+        else
+        {
+            for ( auto c = 0_UZ; c < channels; ++c )
+            {
+                auto const sample = static_cast< float64 >( frame[ c ] );
+                sums[ c ] += sample;
+                frame[ c ] = static_cast< float32 >( sample * gains[ c ] );
+                gains[ c ] += steps[ c ];
+            }
+        }
+
+        ++sample_count_;
+        if ( 0_UZ == ( sample_count_ % window_size_ ) )
+        {
+            for ( auto c = 0_UZ; c < channels; ++c )
+            {
+                auto const next = target / std::max( sums[ c ] / window, floor );
+                steps[ c ]      = ( next - gains[ c ] ) / window;
+                sums[ c ]       = 0.0;
+            }
+        }
+    }
+}
+
+auto measure_am_detector_throughput(
+    std::span< std::size_t const > const channel_counts,
+    std::size_t const                    block_size,
+    float64 const                        seconds_per_count
+) -> utils::Result< std::vector< AmDetectorThroughput > >
+{
+    LTB_CHECK_VALID( block_size > 0_UZ );
+    LTB_CHECK_VALID(
+        std::ranges::all_of( channel_counts, []( auto const c ) { return c > 0_UZ; } )
+    );
+
+    auto const params = AmDetectorParams{ };
+
+    auto results = std::vector< AmDetectorThroughput >{ };
+    for ( auto const channels : channel_counts )
+    {
+        // A 16 kHz carrier with a 30 Hz tone, the same in every channel.
+        auto passband = std::vector< float32 >( block_size * channels );
+        auto iq       = std::vector< Iq >( block_size * channels );
+        for ( auto n = 0_UZ; n < block_size; ++n )
+        {
+            auto const time_s   = static_cast< float64 >( n ) / params.sample_rate_hz;
+            auto const turns    = glm::two_pi< float64 >( ) * time_s;
+            auto const envelope = 1.0 + ( 0.3 * std::cos( 30.0 * turns ) );
+            auto const angle    = 16'000.0 * turns;
+            auto const carrier  = glm::dvec2( std::cos( angle ), std::sin( angle ) );
+            for ( auto c = 0_UZ; c < channels; ++c )
+            {
+                auto const index  = utils::array_index( c, n, channels );
+                passband[ index ] = static_cast< float32 >( envelope * carrier.x );
+                iq[ index ]       = Iq( carrier * envelope );
+            }
+        }
+        auto output = std::vector< float32 >( block_size * channels );
+
+        auto detector = AmDetector{ { .channel_count = channels } };
+        LTB_CHECK(
+            auto const passband_s,
+            time_detection< float32 >( detector, passband, output, seconds_per_count )
+        );
+        LTB_CHECK(
+            auto const iq_s,
+            time_detection< Iq >( detector, iq, output, seconds_per_count )
+        );
+
+        auto const samples = static_cast< float64 >( block_size * channels );
+        results.push_back( {
+            .channel_count               = channels,
+            .block_size                  = block_size,
+            .passband_block_us           = passband_s * 1.0e6,
+            .iq_block_us                 = iq_s * 1.0e6,
+            .passband_mega_samples_per_s = samples * 1.0e-6 / passband_s,
+            .iq_mega_samples_per_s       = samples * 1.0e-6 / iq_s,
+        } );
+    }
+    return results;
+}
+
+} // namespace ltb::dsp
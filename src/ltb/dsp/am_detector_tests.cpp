@@ -0,0 +1,193 @@
+// project
+#include "ltb/dsp/am_detector.hpp"
+#include "ltb/dsp/tone_bank.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+#include <gtest/gtest.h>
+
+// standard
+#include <array>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+constexpr auto sample_rate_hz = 48'000.0;
+
+/// \brief `level (1 + depth cos(2π 30 t))`, the AM of a VOR's variable signal.
+auto am_envelope( float64 const level, float64 const depth, float64 const time_s ) -> float64
+{
+    return level * ( 1.0 + ( depth * std::cos( glm::two_pi< float64 >( ) * 30.0 * time_s ) ) );
+}
+
+TEST( AmDetectorTests, HoldsEveryChannelAtTheTargetLevel )
+{
+    // Receivers from very weak to strong, each off tune by a different amount.
+    constexpr auto channels = 4_UZ;
+    constexpr auto levels   = std::array{ 1.0e-4, 0.02, 1.0, 30.0 };
+    constexpr auto offsets  = std::array{ 0.0, 310.0, -1'250.0, 4'000.0 };
+    constexpr auto depth    = 0.3;
+    constexpr auto samples  = 9'600_UZ;
+
+    auto iq = std::vector< dsp::Iq >( samples * channels );
+    for ( auto n = 0_UZ; n < samples; ++n )
+    {
+        auto const time_s = static_cast< float64 >( n ) / sample_rate_hz;
+        for ( auto c = 0_UZ; c < channels; ++c )
+        {
+            auto const angle = glm::two_pi< float64 >( ) * offsets[ c ] * time_s;
+            iq[ utils::array_index( c, n, channels ) ] = dsp::Iq(
+                glm::dvec2( std::cos( angle ), std::sin( angle ) )
+                * am_envelope( levels[ c ], depth, time_s )
+            );
+        }
+    }
+
+    auto detector = dsp::AmDetector{ { .channel_count = channels } };
+    ASSERT_EQ( detector.window_size( ), 1'600_UZ );
+
+    // In uneven blocks.
+    auto envelope = std::vector< float32 >( iq.size( ) );
+    auto start    = 0_UZ;
+    for ( auto const count : { 1_UZ, 999_UZ, 1'600_UZ, 7'000_UZ } )
+    {
+        ASSERT_TRUE( detector.process(
+            std::span( iq ).subspan( start * channels, count * channels ),
+            std::span( envelope ).subspan( start * channels, count * channels )
+        ) );
+        start += count;
+    }
+    EXPECT_EQ( detector.sample_count( ), samples );
+
+    // A steady carrier is settled after one window, with a constant gain that leaves the
+    // depth of the 30 Hz tone as it was.
+    for ( auto c = 0_UZ; c < channels; ++c )
+    {
+        EXPECT_NEAR( detector.gains( )[ c ] * levels[ c ], 1.0, 1.0e-6 ) << c;
+    }
+
+    auto bank   = dsp::ToneBank{ { .tones_hz = { 0.0, 30.0 }, .channel_count = channels } };
+    auto latest = std::span( envelope ).last( bank.window_size( ) * channels );
+    ASSERT_TRUE( bank.process( latest ) );
+    for ( auto c = 0_UZ; c < channels; ++c )
+    {
+        EXPECT_NEAR( bank.value( 0, c ).x, 1.0, 1.0e-5 ) << c;
+        EXPECT_NEAR( glm::length( bank.value( 1, c ) ), depth, 1.0e-5 ) << c;
+    }
+}
+
+TEST( AmDetectorTests, FollowsAFade )
+{
+    // The carrier drops 20 dB, as when an aircraft flies into a null.
+    constexpr auto samples = 12'000_UZ;
+    constexpr auto fade_at = 4'000_UZ;
+
+    auto iq = std::vector< dsp::Iq >( samples );
+    for ( auto n = 0_UZ; n < samples; ++n )
+    {
+        auto const time_s = static_cast< float64 >( n ) / sample_rate_hz;
+        auto const level  = ( n < fade_at ) ? 1.0 : 0.1;
+        iq[ n ]           = dsp::Iq( glm::dvec2( am_envelope( level, 0.3, time_s ), 0.0 ) );
+    }
+
+    auto detector = dsp::AmDetector{ { } };
+    auto envelope = std::vector< float32 >( samples );
+    ASSERT_TRUE( detector.process( iq, envelope ) );
+
+    // Back at the target within two windows of the fade.
+    EXPECT_NEAR( detector.gains( ).front( ), 10.0, 1.0e-6 );
+
+    auto bank = dsp::ToneBank{ { .tones_hz = { 0.0, 30.0 } } };
+    ASSERT_TRUE( bank.process( std::span( envelope ).last( bank.window_size( ) ) ) );
+    EXPECT_NEAR( bank.value( 0, 0 ).x, 1.0, 1.0e-5 );
+    EXPECT_NEAR( glm::length( bank.value( 1, 0 ) ), 0.3, 1.0e-5 );
+}
+
+TEST( AmDetectorTests, DetectsRealPassband )
+{
+    // A weak 100 kHz IF carrying the ILS tones.
+    constexpr auto if_rate_hz = 480'000.0;
+    constexpr auto carrier_hz = 100'000.0;
+    constexpr auto samples    = 64'000_UZ;
+
+    auto passband = std::vector< float32 >( samples );
+    for ( auto n = 0_UZ; n < samples; ++n )
+    {
+        auto const turns    = glm::two_pi< float64 >( ) * static_cast< float64 >( n ) / if_rate_hz;
+        auto const envelope = 1.0 + ( 0.2 * std::sin( 90.0 * turns ) )
+                            + ( 0.2 * std::sin( 150.0 * turns ) );
+        passband[ n ] = static_cast< float32 >( 0.01 * envelope * std::cos( carrier_hz * turns ) );
+    }
+
+    auto detector = dsp::AmDetector{ { .sample_rate_hz = if_rate_hz } };
+    auto envelope = std::vector< float32 >( samples );
+    ASSERT_TRUE( detector.process( passband, envelope ) );
+
+    auto bank = dsp::ToneBank{ {
+        .sample_rate_hz = if_rate_hz,
+        .tones_hz       = { 0.0, 90.0, 150.0 },
+    } };
+    ASSERT_TRUE( bank.process( std::span( envelope ).last( bank.window_size( ) ) ) );
+    EXPECT_NEAR( bank.value( 0, 0 ).x, 1.0, 1.0e-4 );
+    EXPECT_NEAR( glm::length( bank.value( 1, 0 ) ), 0.2, 1.0e-4 );
+    EXPECT_NEAR( glm::length( bank.value( 2, 0 ) ), 0.2, 1.0e-4 );
+
+    // Each tone lags by the smoothing filter's delay: `sin` is `cos` 90° behind, and the
+    // window ends on a whole number of cycles.
+    auto const delay_s = detector.passband_delay_samples( ) / if_rate_hz;
+    EXPECT_GT( delay_s, 0.0 );
+    for ( auto const& [ tone, tone_hz ] : { std::pair{ 1_UZ, 90.0 }, std::pair{ 2_UZ, 150.0 } } )
+    {
+        auto const value = bank.value( tone, 0 );
+        auto const lag   = -glm::half_pi< float64 >( ) - std::atan2( value.y, value.x );
+        EXPECT_NEAR( lag, glm::two_pi< float64 >( ) * tone_hz * delay_s, 1.0e-4 ) << tone_hz;
+    }
+}
+
+TEST( AmDetectorTests, RejectsInvalidInput )
+{
+    auto iq       = std::vector< dsp::Iq >( 10 );
+    auto passband = std::vector< float32 >( 10 );
+    auto envelope = std::vector< float32 >( 10 );
+
+    EXPECT_TRUE( dsp::AmDetector{ { } }.process( iq, envelope ) );
+    EXPECT_TRUE( dsp::AmDetector{ { } }.process( passband, envelope ) );
+    EXPECT_FALSE( dsp::AmDetector{ { } }.process( iq, std::span( envelope ).first( 9 ) ) );
+
+    auto three = dsp::AmDetector{ { .channel_count = 3 } };
+    EXPECT_FALSE( three.process( passband, envelope ) );
+
+    auto wide = dsp::AmDetector{ { .envelope_bandwidth_hz = 24'000.0 } };
+    EXPECT_FALSE( wide.process( passband, envelope ) );
+
+    auto uneven = dsp::AmDetector{ { .sample_rate_hz = 44'100.0, .agc_window_hz = 40.0 } };
+    EXPECT_FALSE( uneven.process( iq, envelope ) );
+
+    EXPECT_FALSE( dsp::measure_am_detector_throughput( std::array{ 0_UZ }, 256, 0.0 ) );
+    EXPECT_FALSE( dsp::measure_am_detector_throughput( std::array{ 1_UZ }, 0, 0.0 ) );
+}
+
+TEST( AmDetectorTests, MeasuresEveryChannelCount )
+{
+    auto const counts     = std::array{ 1_UZ, 64_UZ };
+    auto const throughput = dsp::measure_am_detector_throughput( counts, 256, 0.0 );
+    ASSERT_TRUE( throughput );
+    ASSERT_EQ( throughput->size( ), counts.size( ) );
+    for ( auto i = 0_UZ; i < counts.size( ); ++i )
+    {
+        auto const& row = ( *throughput )[ i ];
+        EXPECT_EQ( row.channel_count, counts[ i ] );
+        EXPECT_EQ( row.block_size, 256_UZ );
+        EXPECT_GT( row.passband_block_us, 0.0 );
+        EXPECT_GT( row.iq_mega_samples_per_s, 0.0 );
+    }
+}
+
+} // namespace
+} // namespace ltb
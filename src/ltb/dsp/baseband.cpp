@@ -0,0 +1,133 @@
+#include "ltb/dsp/baseband.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <algorithm>
+#include <cmath>
+
+namespace ltb::dsp
+{
+
+Mixer::Mixer( float64 const frequency_hz, float64 const sample_rate_hz, float64 const start_time_s )
+    : oscillator_( frequency_hz, start_time_s, 1.0 / sample_rate_hz )
+{
+}
+
+auto Mixer::sample_count( ) const -> std::size_t
+{
+    return sample_count_;
+}
+
+auto Mixer::process( std::span< Iq > const iq ) -> void
+{
+    for ( auto& sample : iq )
+    {
+        if ( 0_UZ == ( sample_count_ % Oscillator::reseed_interval ) )
+        {
+            oscillator_.reseed( sample_count_ );
+        }
+
+        auto const phasor = glm::vec2( oscillator_.phasor( ) );
+        sample            = {
+            ( sample.x * phasor.x ) - ( sample.y * phasor.y ),
+            ( sample.x * phasor.y ) + ( sample.y * phasor.x ),
+        };
+
+        oscillator_.advance( );
+        ++sample_count_;
+    }
+}
+
+auto upconvert(
+    std::span< Iq const > const iq,
+    float64 const               sample_rate_hz,
+    float64 const               carrier_hz,
+    std::span< float32 > const  passband
+) -> utils::Result< void >
+{
+    LTB_CHECK_VALID( sample_rate_hz > 0.0 );
+    LTB_CHECK_VALID(
+        iq.empty( ) ? passband.empty( ) : ( 0_UZ == passband.size( ) % iq.size( ) ),
+        "The passband must hold a whole number of samples per baseband sample"
+    );
+    if ( iq.empty( ) )
+    {
+        return utils::success( );
+    }
+
+    auto const factor        = passband.size( ) / iq.size( );
+    auto const step          = 1.0F / static_cast< float32 >( factor );
+    auto const passband_rate = sample_rate_hz * static_cast< float64 >( factor );
+
+    auto carrier = Oscillator{ carrier_hz, 0.0, 1.0 / passband_rate };
+
+    for ( auto i = 0_UZ; i < passband.size( ); ++i )
+    {
+        if ( 0_UZ == ( i % Oscillator::reseed_interval ) )
+        {
+            carrier.reseed( i );
+        }
+
+        // The last baseband sample is held.
+        auto const sample   = i / factor;
+        auto const next     = std::min( sample + 1_UZ, iq.size( ) - 1_UZ );
+        auto const fraction = static_cast< float32 >( i % factor ) * step;
+        auto const value    = iq[ sample ] + ( ( iq[ next ] - iq[ sample ] ) * fraction );
+
+        auto const phasor = glm::vec2( carrier.phasor( ) );
+        passband[ i ]     = ( value.x * phasor.x ) - ( value.y * phasor.y );
+
+        carrier.advance( );
+    }
+
+    return utils::success( );
+}
+
+auto envelope( std::span< Iq const > const iq, std::span< float32 > const magnitude )
+    -> utils::Result< void >
+{
+    LTB_CHECK_VALID( iq.size( ) == magnitude.size( ) );
+
+    std::ranges::transform(
+        iq,
+        magnitude.begin( ),
+        []( Iq const sample ) { return glm::length( sample ); }
+    );
+    return utils::success( );
+}
+
+auto instantaneous_frequency(
+    std::span< Iq const > const iq,
+    float64 const               sample_rate_hz,
+    Iq&                         previous,
+    std::span< float32 > const  frequency_hz
+) -> utils::Result< void >
+{
+    LTB_CHECK_VALID( sample_rate_hz > 0.0 );
+    LTB_CHECK_VALID( iq.size( ) == frequency_hz.size( ) );
+
+    auto const hz_per_rad = sample_rate_hz / glm::two_pi< float64 >( );
+
+    for ( auto i = 0_UZ; i < iq.size( ); ++i )
+    {
+        // The angle of `iq[ i ] * conj( previous )`.
+        auto const sample = glm::dvec2( iq[ i ] );
+        auto const last   = glm::dvec2( previous );
+        auto const angle  = std::atan2(
+            ( sample.y * last.x ) - ( sample.x * last.y ),
+            ( sample.x * last.x ) + ( sample.y * last.y )
+        );
+
+        frequency_hz[ i ] = static_cast< float32 >( angle * hz_per_rad );
+        previous          = iq[ i ];
+    }
+
+    return utils::success( );
+}
+
+} // namespace ltb::dsp
@@ -0,0 +1,105 @@
+// project
+#include "ltb/dsp/baseband.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+#include <gtest/gtest.h>
+
+// standard
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+TEST( BasebandTests, CarrierOffsetOnlyTurnsThePhase )
+{
+    constexpr auto sample_rate_hz = 8'000.0;
+    constexpr auto offset_hz      = 137.0;
+
+    auto iq = std::vector< dsp::Iq >( 3'000 );
+    for ( auto i = 0_UZ; i < iq.size( ); ++i )
+    {
+        iq[ i ] = { 1.0F + ( 0.5F * std::sin( 0.01F * static_cast< float32 >( i ) ) ), 0.0F };
+    }
+    auto const original = iq;
+
+    // Shifted in uneven blocks, as a stream would be.
+    auto mixer = dsp::Mixer{ offset_hz, sample_rate_hz };
+    mixer.process( std::span( iq ).first( 1'111 ) );
+    mixer.process( std::span( iq ).subspan( 1'111 ) );
+    EXPECT_EQ( mixer.sample_count( ), iq.size( ) );
+
+    auto magnitude = std::vector< float32 >( iq.size( ) );
+    ASSERT_TRUE( dsp::envelope( iq, magnitude ) );
+
+    auto previous  = iq.front( );
+    auto frequency = std::vector< float32 >( iq.size( ) - 1_UZ );
+    ASSERT_TRUE( dsp::instantaneous_frequency(
+        std::span( iq ).subspan( 1 ),
+        sample_rate_hz,
+        previous,
+        frequency
+    ) );
+    EXPECT_EQ( previous, iq.back( ) );
+
+    for ( auto i = 0_UZ; i < iq.size( ); ++i )
+    {
+        EXPECT_NEAR( magnitude[ i ], original[ i ].x, 1.0e-5F ) << i;
+
+        auto const angle = glm::two_pi< float64 >( ) * offset_hz * static_cast< float64 >( i )
+                         / sample_rate_hz;
+        EXPECT_NEAR( iq[ i ].x, original[ i ].x * std::cos( angle ), 1.0e-4 ) << i;
+        EXPECT_NEAR( iq[ i ].y, original[ i ].x * std::sin( angle ), 1.0e-4 ) << i;
+    }
+    for ( auto const hz : frequency )
+    {
+        EXPECT_NEAR( hz, offset_hz, 0.01 );
+    }
+}
+
+TEST( BasebandTests, UpconvertInterpolatesToTheDisplayRate )
+{
+    constexpr auto sample_rate_hz = 1'000.0;
+    constexpr auto carrier_hz     = 450.0;
+    constexpr auto factor         = 8_UZ;
+
+    auto const iq = std::vector< dsp::Iq >{ { 1.0F, 0.0F }, { 0.0F, 2.0F }, { -1.0F, 1.0F } };
+
+    auto passband = std::vector< float32 >( iq.size( ) * factor );
+    ASSERT_TRUE( dsp::upconvert( iq, sample_rate_hz, carrier_hz, passband ) );
+
+    for ( auto i = 0_UZ; i < passband.size( ); ++i )
+    {
+        auto const sample   = std::min( i / factor, iq.size( ) - 2_UZ );
+        auto const fraction = ( static_cast< float32 >( i ) / static_cast< float32 >( factor ) )
+                            - static_cast< float32 >( sample );
+        auto const weight   = std::min( fraction, 1.0F );
+        auto const value
+            = ( iq[ sample ] * ( 1.0F - weight ) ) + ( iq[ sample + 1_UZ ] * weight );
+
+        auto const time_s
+            = static_cast< float64 >( i ) / ( sample_rate_hz * static_cast< float64 >( factor ) );
+        auto const angle    = glm::two_pi< float64 >( ) * carrier_hz * time_s;
+        auto const expected = ( value.x * std::cos( angle ) ) - ( value.y * std::sin( angle ) );
+        EXPECT_NEAR( passband[ i ], expected, 1.0e-5 ) << i;
+    }
+}
+
+TEST( BasebandTests, RejectsMismatchedSizes )
+{
+    auto const iq       = std::vector< dsp::Iq >( 4 );
+    auto       passband = std::vector< float32 >( 6 );
+    auto       previous = dsp::Iq{ 1.0F, 0.0F };
+
+    EXPECT_FALSE( dsp::upconvert( iq, 1'000.0, 100.0, passband ) );
+    EXPECT_FALSE( dsp::envelope( iq, passband ) );
+    EXPECT_FALSE( dsp::instantaneous_frequency( iq, 1'000.0, previous, passband ) );
+}
+
+} // namespace
+} // namespace ltb
@@ -0,0 +1,39 @@
+#pragma once
+
+// project
+#include "ltb/utils/size_utils.hpp"
+#include "ltb/utils/types.hpp"
+
+// standard
+#include <array>
+#include <numeric>
+
+namespace ltb::dsp::details
+{
+
+/// \brief Independent partial sums per dot product, enough to fill a packed register.
+constexpr auto lane_count = 8_UZ;
+
+/// \brief \p value rounded up to a whole number of lanes.
+constexpr auto lane_multiple( std::size_t const value ) -> std::size_t
+{
+    return ( ( value + lane_count - 1_UZ ) / lane_count ) * lane_count;
+}
+
+/// \brief `Σ a[i] b[i]` over a multiple of `lane_count` values, summed in lanes so the
+///        compiler doesn't have to keep the additions in order and can pack them.
+inline auto dot( float32 const* const a, float32 const* const b, std::size_t const size )
+    -> float32
+{
+    auto sums = std::array< float32, lane_count >{ };
+    for ( auto i = 0_UZ; i < size; i += lane_count )
+    {
+        for ( auto lane = 0_UZ; lane < lane_count; ++lane )
+        {
+            sums[ lane ] += a[ i + lane ] * b[ i + lane ];
+        }
+    }
+    return std::accumulate( sums.begin( ), sums.end( ), 0.0F );
+}
+
+} // namespace ltb::dsp::details
@@ -0,0 +1,419 @@
+#include "ltb/dsp/fft.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+namespace ltb::dsp
+{
+namespace
+{
+
+/// \brief Runs of at least this many contiguous values are worth vectorizing.
+constexpr auto vector_run = 4_UZ;
+
+/// \brief Magnitudes are floored here so silent bins stay finite in dB.
+constexpr auto min_magnitude = 1.0e-10F;
+
+/// \brief `e^(-j 2π cycles)`.
+auto unit_phasor( float64 const cycles ) -> glm::dvec2
+{
+    auto const angle = glm::two_pi< float64 >( ) * cycles;
+    return { std::cos( angle ), -std::sin( angle ) };
+}
+
+/// \brief Call \p butterfly for every butterfly `p` in `[0, count)` at every offset `q` in
+///        `[0, stride)`, with the longer of the two loops innermost so it vectorizes.
+template < typename Butterfly >
+auto for_each_butterfly( std::size_t const count, std::size_t const stride, Butterfly&& butterfly )
+    -> void
+{
+    if ( stride >= vector_run )
+    {
+        for ( auto p = 0_UZ; p < count; ++p )
+        {
+            for ( auto q = 0_UZ; q < stride; ++q )
+            {
+                butterfly( p, q );
+            }
+        }
+    }
+    else
+    {
+        for ( auto q = 0_UZ; q < stride; ++q )
+        {
+            for ( auto p = 0_UZ; p < count; ++p )
+            {
+                butterfly( p, q );
+            }
+        }
+    }
+}
+
+auto to_db( float32 const magnitude ) -> float32
+{
+    return 20.0F * std::log10( std::max( magnitude, min_magnitude ) );
+}
+
+auto valid_size( std::size_t const size, std::size_t const min_size ) -> bool
+{
+    return ( size >= min_size ) && std::has_single_bit( size );
+}
+
+} // namespace
+
+auto window_coefficients( Window const window, std::size_t const size ) -> std::vector< float32 >
+{
+    auto coefficients = std::vector< float32 >( size, 1.0F );
+    for ( auto n = 0_UZ; n < size; ++n )
+    {
+        auto const angle = glm::two_pi< float64 >( ) * static_cast< float64 >( n )
+                         / static_cast< float64 >( size );
+        switch ( window )
+        {
+            using enum Window;
+            case Rectangular:
+                break;
+            case Hann:
+                coefficients[ n ] = static_cast< float32 >( 0.5 - ( 0.5 * std::cos( angle ) ) );
+                break;
+            case BlackmanHarris:
+                coefficients[ n ] = static_cast< float32 >(
+                    0.35875 - ( 0.48829 * std::cos( angle ) )
+                    + ( 0.14128 * std::cos( 2.0 * angle ) ) - ( 0.01168 * std::cos( 3.0 * angle ) )
+                );
+                break;
+        }
+    }
+    return coefficients;
+}
+
+Fft::Fft( std::size_t const size )
+    : size_( size )
+{
+    if ( !valid_size( size_, 2_UZ ) )
+    {
+        return;
+    }
+
+    auto length = size_;
+    auto stride = 1_UZ;
+    while ( length >= 4_UZ )
+    {
+        auto const quarter = length / 4_UZ;
+        stages_.push_back( {
+            .radix    = 4,
+            .length   = length,
+            .stride   = stride,
+            .twiddles = twiddle_re_.size( ),
+        } );
+
+        // w^p, w^2p and w^3p for every butterfly p, one run of each.
+        for ( auto k = 1_UZ; k <= 3_UZ; ++k )
+        {
+            for ( auto p = 0_UZ; p < quarter; ++p )
+            {
+                auto const twiddle = unit_phasor(
+                    static_cast< float64 >( k * p ) / static_cast< float64 >( length )
+                );
+                twiddle_re_.push_back( static_cast< float32 >( twiddle.x ) );
+                twiddle_im_.push_back( static_cast< float32 >( twiddle.y ) );
+            }
+        }
+
+        length = quarter;
+        stride *= 4_UZ;
+    }
+    if ( 2_UZ == length )
+    {
+        // Its only twiddle factor is 1.
+        stages_.push_back( { .radix = 2, .length = 2, .stride = stride, .twiddles = 0 } );
+    }
+
+    for ( auto i = 0_UZ; i < 2_UZ; ++i )
+    {
+        re_[ i ].resize( size_ );
+        im_[ i ].resize( size_ );
+    }
+}
+
+auto Fft::size( ) const -> std::size_t
+{
+    return size_;
+}
+
+auto Fft::forward( std::span< Iq const > const input, std::span< Iq > const output )
+    -> utils::Result< void >
+{
+    LTB_CHECK_VALID( valid_size( size_, 2_UZ ), "The FFT size must be a power of two" );
+    LTB_CHECK_VALID( ( input.size( ) == size_ ) && ( output.size( ) == size_ ) );
+
+    for ( auto n = 0_UZ; n < size_; ++n )
+    {
+        re_[ 0 ][ n ] = input[ n ].x;
+        im_[ 0 ][ n ] = input[ n ].y;
+    }
+
+    auto source = 0_UZ;
+    for ( auto const& stage : stages_ )
+    {
+        auto const* const xr = re_[ source ].data( );
+        auto const* const xi = im_[ source ].data( );
+        auto* const       yr = re_[ 1_UZ - source ].data( );
+        auto* const       yi = im_[ 1_UZ - source ].data( );
+
+        auto const s = stage.stride;
+
+        if ( 2_UZ == stage.radix )
+        {
+            for ( auto q = 0_UZ; q < s; ++q )
+            {
+                yr[ q ]     = xr[ q ] + xr[ q + s ];
+                yi[ q ]     = xi[ q ] + xi[ q + s ];
+                yr[ q + s ] = xr[ q ] - xr[ q + s ];
+                yi[ q + s ] = xi[ q ] - xi[ q + s ];
+            }
+        }
+        else
+        {
+            auto const  m   = stage.length / 4_UZ;
+            auto const* w1r = twiddle_re_.data( ) + stage.twiddles;
+            auto const* w1i = twiddle_im_.data( ) + stage.twiddles;
+            auto const* w2r = w1r + m;
+            auto const* w2i = w1i + m;
+            auto const* w3r = w2r + m;
+            auto const* w3i = w2i + m;
+
+            for_each_butterfly(
+                m,
+                s,
+                [ = ]( std::size_t const p, std::size_t const q )
+                {
+                    auto const a = q + ( s * p );
+                    auto const b = a + ( s * m );
+                    auto const c = b + ( s * m );
+                    auto const d = c + ( s * m );
+
+                    auto const apc_r = xr[ a ] + xr[ c ];
+                    auto const apc_i = xi[ a ] + xi[ c ];
+                    auto const amc_r = xr[ a ] - xr[ c ];
+                    auto const amc_i = xi[ a ] - xi[ c ];
+                    auto const bpd_r = xr[ b ] + xr[ d ];
+                    auto const bpd_i = xi[ b ] + xi[ d ];
+                    auto const bmd_r = xr[ b ] - xr[ d ];
+                    auto const bmd_i = xi[ b ] - xi[ d ];
+
+                    // (a - c) -/+ j (b - d)
+                    auto const t1_r = amc_r + bmd_i;
+                    auto const t1_i = amc_i - bmd_r;
+                    auto const t2_r = apc_r - bpd_r;
+                    auto const t2_i = apc_i - bpd_i;
+                    auto const t3_r = amc_r - bmd_i;
+                    auto const t3_i = amc_i + bmd_r;
+
+                    auto const out = q + ( s * 4_UZ * p );
+                    yr[ out ]      = apc_r + bpd_r;
+                    yi[ out ]      = apc_i + bpd_i;
+
+                    yr[ out + s ] = ( w1r[ p ] * t1_r ) - ( w1i[ p ] * t1_i );
+                    yi[ out + s ] = ( w1r[ p ] * t1_i ) + ( w1i[ p ] * t1_r );
+
+                    yr[ out + ( 2_UZ * s ) ] = ( w2r[ p ] * t2_r ) - ( w2i[ p ] * t2_i );
+                    yi[ out + ( 2_UZ * s ) ] = ( w2r[ p ] * t2_i ) + ( w2i[ p ] * t2_r );
+
+                    yr[ out + ( 3_UZ * s ) ] = ( w3r[ p ] * t3_r ) - ( w3i[ p ] * t3_i );
+                    yi[ out + ( 3_UZ * s ) ] = ( w3r[ p ] * t3_i ) + ( w3i[ p ] * t3_r );
+                }
+            );
+        }
+
+        source = 1_UZ - source;
+    }
+
+    for ( auto n = 0_UZ; n < size_; ++n )
+    {
+        output[ n ] = { re_[ source ][ n ], im_[ source ][ n ] };
+    }
+    return utils::success( );
+}
+
+RealFft::RealFft( std::size_t const size )
+    : size_( size )
+    , half_( size / 2_UZ )
+{
+    if ( !valid_size( size_, 4_UZ ) )
+    {
+        return;
+    }
+
+    packed_.resize( size_ / 2_UZ );
+    twiddles_.resize( size_ / 2_UZ );
+    for ( auto k = 0_UZ; k < twiddles_.size( ); ++k )
+    {
+        twiddles_[ k ] = Iq(
+            unit_phasor( static_cast< float64 >( k ) / static_cast< float64 >( size_ ) )
+        );
+    }
+}
+
+auto RealFft::size( ) const -> std::size_t
+{
+    return size_;
+}
+
+auto RealFft::forward( std::span< float32 const > const input, std::span< Iq > const output )
+    -> utils::Result< void >
+{
+    LTB_CHECK_VALID( valid_size( size_, 4_UZ ), "The FFT size must be a power of two, at least 4" );
+    LTB_CHECK_VALID( ( input.size( ) == size_ ) && ( output.size( ) == ( size_ / 2_UZ ) + 1_UZ ) );
+
+    auto const half = packed_.size( );
+    for ( auto n = 0_UZ; n < half; ++n )
+    {
+        packed_[ n ] = { input[ 2_UZ * n ], input[ ( 2_UZ * n ) + 1_UZ ] };
+    }
+    LTB_CHECK( half_.forward( packed_, packed_ ) );
+
+    // Separate the transforms of the even and odd samples, then combine them.
+    for ( auto k = 0_UZ; k <= half; ++k )
+    {
+        auto const z         = packed_[ k % half ];
+        auto const mirror    = packed_[ ( half - k ) % half ];
+        auto const conjugate = Iq( mirror.x, -mirror.y );
+
+        auto const even = ( z + conjugate ) * 0.5F;
+        auto const diff = ( z - conjugate ) * 0.5F;
+        auto const odd  = Iq( diff.y, -diff.x );
+
+        auto const twiddle = ( k < half ) ? twiddles_[ k ] : Iq( -1.0F, 0.0F );
+        output[ k ]        = even
+                    + Iq( ( twiddle.x * odd.x ) - ( twiddle.y * odd.y ),
+                          ( twiddle.x * odd.y ) + ( twiddle.y * odd.x ) );
+    }
+    return utils::success( );
+}
+
+SpectrumAnalyzer::SpectrumAnalyzer( SpectrumParams params )
+    : params_( params )
+    , window_( window_coefficients( params_.window, params_.size ) )
+    , complex_( params_.size )
+    , real_( params_.size )
+    , windowed_( params_.size )
+    , bins_( params_.size )
+{
+    if ( !window_.empty( ) )
+    {
+        gain_ = std::reduce( window_.begin( ), window_.end( ), 0.0F )
+              / static_cast< float32 >( window_.size( ) );
+    }
+}
+
+auto SpectrumAnalyzer::params( ) const -> SpectrumParams const&
+{
+    return params_;
+}
+
+auto SpectrumAnalyzer::bin_hz( ) const -> float64
+{
+    return params_.sample_rate_hz / static_cast< float64 >( params_.size );
+}
+
+auto SpectrumAnalyzer::real_spectrum(
+    std::span< float32 const > const samples,
+    std::span< float32 > const       db
+) -> utils::Result< void >
+{
+    auto const size = params_.size;
+    LTB_CHECK_VALID( ( samples.size( ) == size ) && ( db.size( ) == ( size / 2_UZ ) + 1_UZ ) );
+
+    std::ranges::transform( samples, window_, windowed_.begin( ), std::multiplies{ } );
+
+    auto const bins = std::span( bins_ ).first( db.size( ) );
+    LTB_CHECK( real_.forward( windowed_, bins ) );
+
+    // A tone's power is split between the positive and negative bins; only DC and the
+    // Nyquist bin are their own mirror images.
+    auto const scale = 2.0F / ( static_cast< float32 >( size ) * gain_ );
+    for ( auto k = 0_UZ; k < bins.size( ); ++k )
+    {
+        auto const edge = ( 0_UZ == k ) || ( bins.size( ) - 1_UZ == k );
+        db[ k ]         = to_db( glm::length( bins[ k ] ) * scale * ( edge ? 0.5F : 1.0F ) );
+    }
+    return utils::success( );
+}
+
+auto SpectrumAnalyzer::iq_spectrum(
+    std::span< Iq const > const samples,
+    std::span< float32 > const  db
+) -> utils::Result< void >
+{
+    auto const size = params_.size;
+    LTB_CHECK_VALID( ( samples.size( ) == size ) && ( db.size( ) == size ) );
+
+    for ( auto n = 0_UZ; n < size; ++n )
+    {
+        bins_[ n ] = samples[ n ] * window_[ n ];
+    }
+    LTB_CHECK( complex_.forward( bins_, bins_ ) );
+
+    auto const scale = 1.0F / ( static_cast< float32 >( size ) * gain_ );
+    for ( auto k = 0_UZ; k < size; ++k )
+    {
+        db[ ( k + ( size / 2_UZ ) ) % size ] = to_db( glm::length( bins_[ k ] ) * scale );
+    }
+    return utils::success( );
+}
+
+auto measure_fft_throughput(
+    std::size_t const min_log2,
+    std::size_t const max_log2,
+    float64 const     seconds_per_size
+) -> utils::Result< std::vector< FftThroughput > >
+{
+    LTB_CHECK_VALID( ( min_log2 >= 1_UZ ) && ( min_log2 <= max_log2 ) && ( max_log2 < 32_UZ ) );
+
+    using Clock = std::chrono::steady_clock;
+
+    auto results = std::vector< FftThroughput >{ };
+    for ( auto log2 = min_log2; log2 <= max_log2; ++log2 )
+    {
+        auto const size = 1_UZ << log2;
+
+        auto fft    = Fft{ size };
+        auto input  = std::vector< Iq >( size );
+        auto output = std::vector< Iq >( size );
+        for ( auto n = 0_UZ; n < size; ++n )
+        {
+            input[ n ] = { std::sin( static_cast< float32 >( n ) ), 0.5F };
+        }
+
+        auto       count   = 0_UZ;
+        auto const start   = Clock::now( );
+        auto       elapsed = 0.0;
+        do
+        {
+            LTB_CHECK( fft.forward( input, output ) );
+            ++count;
+            elapsed = std::chrono::duration< float64 >( Clock::now( ) - start ).count( );
+        } while ( elapsed < seconds_per_size );
+
+        auto const transforms_per_s = static_cast< float64 >( count ) / elapsed;
+        results.push_back( {
+            .size               = size,
+            .transforms_per_s   = transforms_per_s,
+            .mega_samples_per_s = transforms_per_s * static_cast< float64 >( size ) * 1.0e-6,
+        } );
+    }
+    return results;
+}
+
+} // namespace ltb::dsp
@@ -0,0 +1,175 @@
+// project
+#include "ltb/dsp/fft.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+#include <gtest/gtest.h>
+
+// standard
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+/// \brief The DFT by its definition, in float64.
+auto naive_dft( std::vector< dsp::Iq > const& input ) -> std::vector< glm::dvec2 >
+{
+    auto const size   = input.size( );
+    auto       output = std::vector< glm::dvec2 >( size );
+    for ( auto k = 0_UZ; k < size; ++k )
+    {
+        for ( auto n = 0_UZ; n < size; ++n )
+        {
+            auto const turns = static_cast< float64 >( ( k * n ) % size )
+                             / static_cast< float64 >( size );
+            auto const angle = -glm::two_pi< float64 >( ) * turns;
+            auto const x     = glm::dvec2( input[ n ] );
+            output[ k ] += glm::dvec2(
+                ( x.x * std::cos( angle ) ) - ( x.y * std::sin( angle ) ),
+                ( x.x * std::sin( angle ) ) + ( x.y * std::cos( angle ) )
+            );
+        }
+    }
+    return output;
+}
+
+auto test_signal( std::size_t const size ) -> std::vector< dsp::Iq >
+{
+    auto signal = std::vector< dsp::Iq >( size );
+    for ( auto n = 0_UZ; n < size; ++n )
+    {
+        auto const t = static_cast< float32 >( n );
+        signal[ n ]  = {
+            std::sin( 0.37F * t ) + ( 0.25F * std::cos( 1.9F * t ) ),
+            std::cos( 0.11F * t * t ),
+        };
+    }
+    return signal;
+}
+
+TEST( FftTests, MatchesTheDefinitionForEveryRadixMix )
+{
+    // Even powers of two are all radix-4 stages; odd ones end with a radix-2 stage.
+    for ( auto const size : { 2_UZ, 4_UZ, 8_UZ, 32_UZ, 256_UZ, 512_UZ } )
+    {
+        auto const input    = test_signal( size );
+        auto const expected = naive_dft( input );
+
+        auto fft    = dsp::Fft{ size };
+        auto output = std::vector< dsp::Iq >( size );
+        ASSERT_TRUE( fft.forward( input, output ) );
+
+        // In place gives the same answer.
+        auto in_place = input;
+        ASSERT_TRUE( fft.forward( in_place, in_place ) );
+
+        auto const tolerance = 1.0e-5 * static_cast< float64 >( size );
+        for ( auto k = 0_UZ; k < size; ++k )
+        {
+            EXPECT_NEAR( output[ k ].x, expected[ k ].x, tolerance ) << size << ": " << k;
+            EXPECT_NEAR( output[ k ].y, expected[ k ].y, tolerance ) << size << ": " << k;
+            EXPECT_EQ( in_place[ k ], output[ k ] ) << size << ": " << k;
+        }
+    }
+}
+
+TEST( FftTests, RealTransformMatchesTheComplexOne )
+{
+    for ( auto const size : { 4_UZ, 8_UZ, 64_UZ, 2'048_UZ } )
+    {
+        auto const signal  = test_signal( size );
+        auto       real    = std::vector< float32 >( size );
+        auto       complex = std::vector< dsp::Iq >( size );
+        for ( auto n = 0_UZ; n < size; ++n )
+        {
+            real[ n ]    = signal[ n ].x;
+            complex[ n ] = { real[ n ], 0.0F };
+        }
+
+        auto full = std::vector< dsp::Iq >( size );
+        ASSERT_TRUE( dsp::Fft{ size }.forward( complex, full ) );
+
+        auto half = std::vector< dsp::Iq >( ( size / 2_UZ ) + 1_UZ );
+        ASSERT_TRUE( dsp::RealFft{ size }.forward( real, half ) );
+
+        auto const tolerance = 1.0e-5F * static_cast< float32 >( size );
+        for ( auto k = 0_UZ; k < half.size( ); ++k )
+        {
+            EXPECT_NEAR( half[ k ].x, full[ k ].x, tolerance ) << size << ": " << k;
+            EXPECT_NEAR( half[ k ].y, full[ k ].y, tolerance ) << size << ": " << k;
+        }
+    }
+}
+
+TEST( FftTests, FullScaleTonesReadZeroDb )
+{
+    constexpr auto size           = 4'096_UZ;
+    constexpr auto sample_rate_hz = 48'000.0;
+    constexpr auto bin            = 300_UZ;
+
+    auto analyzer = dsp::SpectrumAnalyzer{ {
+        .size           = size,
+        .sample_rate_hz = sample_rate_hz,
+        .window         = dsp::Window::Hann,
+    } };
+    auto const tone_hz = analyzer.bin_hz( ) * static_cast< float64 >( bin );
+
+    auto real = std::vector< float32 >( size );
+    auto iq   = std::vector< dsp::Iq >( size );
+    for ( auto n = 0_UZ; n < size; ++n )
+    {
+        auto const angle = glm::two_pi< float64 >( ) * tone_hz * static_cast< float64 >( n )
+                         / sample_rate_hz;
+        real[ n ]        = static_cast< float32 >( std::cos( angle ) );
+        iq[ n ]          = dsp::Iq( glm::dvec2( std::cos( angle ), -std::sin( angle ) ) );
+    }
+
+    auto real_db = std::vector< float32 >( ( size / 2_UZ ) + 1_UZ );
+    ASSERT_TRUE( analyzer.real_spectrum( real, real_db ) );
+    EXPECT_NEAR( real_db[ bin ], 0.0F, 0.01F );
+    EXPECT_EQ( std::ranges::max_element( real_db ), real_db.begin( ) + bin );
+
+    // A negative frequency lands below the center bin.
+    auto iq_db = std::vector< float32 >( size );
+    ASSERT_TRUE( analyzer.iq_spectrum( iq, iq_db ) );
+    EXPECT_NEAR( iq_db[ ( size / 2_UZ ) - bin ], 0.0F, 0.01F );
+    EXPECT_EQ( std::ranges::max_element( iq_db ), iq_db.begin( ) + ( size / 2_UZ ) - bin );
+
+    // Far from the tone, the window's sidelobes have died away.
+    EXPECT_LT( real_db[ bin + 100_UZ ], -80.0F );
+    EXPECT_LT( iq_db[ size / 2_UZ ], -80.0F );
+}
+
+TEST( FftTests, RejectsInvalidSizes )
+{
+    auto input  = std::vector< dsp::Iq >( 12 );
+    auto output = std::vector< dsp::Iq >( 12 );
+    EXPECT_FALSE( dsp::Fft{ 12 }.forward( input, output ) );
+    EXPECT_FALSE( dsp::Fft{ 16 }.forward( input, output ) );
+
+    auto const real = std::vector< float32 >( 2 );
+    auto       half = std::vector< dsp::Iq >( 2 );
+    EXPECT_FALSE( dsp::RealFft{ 2 }.forward( real, half ) );
+
+    EXPECT_FALSE( dsp::measure_fft_throughput( 5, 4, 0.0 ) );
+}
+
+TEST( FftTests, MeasuresEverySize )
+{
+    auto const throughput = dsp::measure_fft_throughput( 4, 7, 0.0 );
+    ASSERT_TRUE( throughput );
+    ASSERT_EQ( throughput->size( ), 4_UZ );
+    for ( auto i = 0_UZ; i < throughput->size( ); ++i )
+    {
+        EXPECT_EQ( ( *throughput )[ i ].size, 16_UZ << i );
+        EXPECT_GT( ( *throughput )[ i ].transforms_per_s, 0.0 );
+    }
+}
+
+} // namespace
+} // namespace ltb
@@ -0,0 +1,143 @@
+#include "ltb/dsp/filter.hpp"
+
+// project
+#include "ltb/dsp/dot_details.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// standard
+#include <algorithm>
+
+namespace ltb::dsp
+{
+
+FirFilter::FirFilter( std::span< float32 const > const taps, std::size_t const channel_count )
+    : taps_( taps.begin( ), taps.end( ) )
+    , channel_count_( channel_count )
+    , reversed_( details::lane_multiple( taps.size( ) ), 0.0F )
+{
+    auto const padding = static_cast< std::ptrdiff_t >( reversed_.size( ) - taps_.size( ) );
+    std::ranges::reverse_copy( taps_, reversed_.begin( ) + padding );
+
+    auto const history = reversed_.empty( ) ? 0_UZ : ( reversed_.size( ) - 1_UZ );
+    inputs_.resize( channel_count_, std::vector< float32 >( history, 0.0F ) );
+}
+
+auto FirFilter::taps( ) const -> std::vector< float32 > const&
+{
+    return taps_;
+}
+
+auto FirFilter::channel_count( ) const -> std::size_t
+{
+    return channel_count_;
+}
+
+auto FirFilter::process( std::span< float32 const > const input, std::span< float32 > const output )
+    -> utils::Result< void >
+{
+    auto const channels = channel_count_;
+    LTB_CHECK_VALID( !taps_.empty( ) && ( channels > 0_UZ ), "A filter needs taps and channels" );
+    LTB_CHECK_VALID( 0_UZ == ( input.size( ) % channels ), "Every sample needs every channel" );
+    LTB_CHECK_VALID( output.size( ) == input.size( ), "One output per input" );
+
+    auto const samples = input.size( ) / channels;
+    auto const size    = reversed_.size( );
+    auto const history = size - 1_UZ;
+
+    // Each channel's inputs are copied out before any of its outputs are written, so the
+    // output can overwrite the input.
+    for ( auto c = 0_UZ; c < channels; ++c )
+    {
+        auto& inputs = inputs_[ c ];
+        inputs.resize( history + samples );
+        for ( auto n = 0_UZ; n < samples; ++n )
+        {
+            inputs[ history + n ] = input[ utils::array_index( c, n, channels ) ];
+        }
+
+        for ( auto n = 0_UZ; n < samples; ++n )
+        {
+            output[ utils::array_index( c, n, channels ) ]
+                = details::dot( reversed_.data( ), inputs.data( ) + n, size );
+        }
+
+        auto const kept = static_cast< std::ptrdiff_t >( history );
+        std::copy( inputs.end( ) - kept, inputs.end( ), inputs.begin( ) );
+        inputs.resize( history );
+    }
+    return utils::success( );
+}
+
+BiquadCascade::BiquadCascade(
+    std::span< Biquad const > const sections,
+    std::size_t const               channel_count
+)
+    : sections_( sections.begin( ), sections.end( ) )
+    , channel_count_( channel_count )
+    , z1_( sections.size( ) * channel_count, 0.0 )
+    , z2_( sections.size( ) * channel_count, 0.0 )
+    , frame_( channel_count, 0.0 )
+{
+}
+
+auto BiquadCascade::sections( ) const -> std::vector< Biquad > const&
+{
+    return sections_;
+}
+
+auto BiquadCascade::channel_count( ) const -> std::size_t
+{
+    return channel_count_;
+}
+
+auto BiquadCascade::process(
+    std::span< float32 const > const input,
+    std::span< float32 > const       output
+) -> utils::Result< void >
+{
+    auto const channels = channel_count_;
+    LTB_CHECK_VALID( channels > 0_UZ, "A filter needs channels" );
+    LTB_CHECK_VALID( 0_UZ == ( input.size( ) % channels ), "Every sample needs every channel" );
+    LTB_CHECK_VALID( output.size( ) == input.size( ), "One output per input" );
+
+    auto* const frame = frame_.data( );
+
+    for ( auto start = 0_UZ; start < input.size( ); start += channels )
+    {
+        for ( auto c = 0_UZ; c < channels; ++c )
+        {
+            frame[ c ] = static_cast< float64 >( input[ start + c ] );
+        }
+
+        for ( auto s = 0_UZ; s < sections_.size( ); ++s )
+        {
+            auto const [ b0, b1, b2, a1, a2 ] = sections_[ s ];
+
+            auto* const z1 = z1_.data( ) + ( s * channels );
+            auto* const z2 = z2_.data( ) + ( s * channels );
+
+            for ( auto c = 0_UZ; c < channels; ++c )
+            {
+                auto const x = frame[ c ];
+                auto const y = ( b0 * x ) + z1[ c ];
+                z1[ c ]      = ( b1 * x ) - ( a1 * y ) + z2[ c ];
+                z2[ c ]      = ( b2 * x ) - ( a2 * y );
+                frame[ c ]   = y;
+            }
+        }
+
+        for ( auto c = 0_UZ; c < channels; ++c )
+        {
+            output[ start + c ] = static_cast< float32 >( frame[ c ] );
+        }
+    }
+    return utils::success( );
+}
+
+auto BiquadCascade::reset( ) -> void
+{
+    std::ranges::fill( z1_, 0.0 );
+    std::ranges::fill( z2_, 0.0 );
+}
+
+} // namespace ltb::dsp
@@ -0,0 +1,228 @@
+// project
+#include "ltb/dsp/filter.hpp"
+#include "ltb/dsp/tone_bank.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+#include <gtest/gtest.h>
+
+// standard
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+constexpr auto sample_rate_hz = 48'000.0;
+
+// Receiver filters designed entirely at compile time.
+constexpr auto envelope_filter   = dsp::butterworth_low_pass< 4 >( 1'000.0, sample_rate_hz );
+constexpr auto ils_90_filter     = dsp::band_pass< 3 >( 90.0, 20.0, sample_rate_hz );
+constexpr auto ils_150_filter    = dsp::band_pass< 3 >( 150.0, 20.0, sample_rate_hz );
+constexpr auto subcarrier_filter = dsp::band_pass_fir< 129 >( 9'960.0, 1'200.0, sample_rate_hz );
+
+constexpr auto near( float64 const a, float64 const b, float64 const tolerance ) -> bool
+{
+    return ( ( a - b ) < tolerance ) && ( ( b - a ) < tolerance );
+}
+
+static_assert( near( dsp::magnitude_response( envelope_filter, 0.0, sample_rate_hz ), 1.0, 1e-9 ) );
+static_assert( near(
+    dsp::magnitude_response( envelope_filter, 1'000.0, sample_rate_hz ),
+    dsp::butterworth_q,
+    1e-9
+) );
+static_assert( near( dsp::magnitude_response( ils_90_filter, 90.0, sample_rate_hz ), 1.0, 1e-9 ) );
+static_assert( dsp::magnitude_response( ils_90_filter, 150.0, sample_rate_hz ) < 0.06 );
+
+/// \brief `Σ a cos(2π f t + φ)` over \p components `{ f, a, φ }` of each channel,
+///        time-major.
+auto synthesize( std::vector< std::vector< glm::dvec3 > > const& channels, std::size_t const count )
+    -> std::vector< float32 >
+{
+    auto samples = std::vector< float32 >( count * channels.size( ) );
+    for ( auto n = 0_UZ; n < count; ++n )
+    {
+        auto const time_s = static_cast< float64 >( n ) / sample_rate_hz;
+        for ( auto c = 0_UZ; c < channels.size( ); ++c )
+        {
+            auto value = 0.0;
+            for ( auto const& component : channels[ c ] )
+            {
+                auto const angle = glm::two_pi< float64 >( ) * component.x * time_s;
+                value += component.y * std::cos( angle + component.z );
+            }
+            auto const index = utils::array_index( c, n, channels.size( ) );
+            samples[ index ] = static_cast< float32 >( value );
+        }
+    }
+    return samples;
+}
+
+TEST( FilterTests, CompileTimeDesignsMatchRunTimeOnes )
+{
+    // Not constant, so these are designed with the standard library's trigonometry.
+    auto cutoff_hz = 1'000.0;
+    auto center_hz = 90.0;
+
+    auto const envelope = dsp::butterworth_low_pass< 4 >( cutoff_hz, sample_rate_hz );
+    auto const ils_90   = dsp::band_pass< 3 >( center_hz, 20.0, sample_rate_hz );
+
+    for ( auto s = 0_UZ; s < envelope.size( ); ++s )
+    {
+        EXPECT_NEAR( envelope[ s ].b0, envelope_filter[ s ].b0, 1.0e-15 ) << s;
+        EXPECT_NEAR( envelope[ s ].a1, envelope_filter[ s ].a1, 1.0e-14 ) << s;
+        EXPECT_NEAR( envelope[ s ].a2, envelope_filter[ s ].a2, 1.0e-14 ) << s;
+    }
+    for ( auto s = 0_UZ; s < ils_90.size( ); ++s )
+    {
+        EXPECT_NEAR( ils_90[ s ].b0, ils_90_filter[ s ].b0, 1.0e-15 ) << s;
+        EXPECT_NEAR( ils_90[ s ].a1, ils_90_filter[ s ].a1, 1.0e-14 ) << s;
+        EXPECT_NEAR( ils_90[ s ].a2, ils_90_filter[ s ].a2, 1.0e-14 ) << s;
+    }
+
+    center_hz     = 9'960.0;
+    auto const fir = dsp::band_pass_fir< 129 >( center_hz, 1'200.0, sample_rate_hz );
+    for ( auto k = 0_UZ; k < fir.size( ); ++k )
+    {
+        EXPECT_NEAR( fir[ k ], subcarrier_filter[ k ], 1.0e-7F ) << k;
+    }
+}
+
+TEST( FilterTests, BandPassesSeparateTheIlsTonesOfEveryReceiver )
+{
+    // Receivers across the course, each with its own balance of 90 and 150 Hz.
+    constexpr auto receivers = 64_UZ;
+    auto           channels  = std::vector< std::vector< glm::dvec3 > >{ };
+    for ( auto r = 0_UZ; r < receivers; ++r )
+    {
+        auto const balance = static_cast< float64 >( r ) / static_cast< float64 >( receivers );
+        channels.push_back( {
+            { 90.0, 0.4 * balance, 0.1 * static_cast< float64 >( r ) },
+            { 150.0, 0.4 * ( 1.0 - balance ), 0.0 },
+        } );
+    }
+    auto const input = synthesize( channels, 48'000 );
+
+    auto filter_90  = dsp::BiquadCascade{ ils_90_filter, receivers };
+    auto filter_150 = dsp::BiquadCascade{ ils_150_filter, receivers };
+    auto output_90  = std::vector< float32 >( input.size( ) );
+    auto output_150 = std::vector< float32 >( input.size( ) );
+    ASSERT_TRUE( filter_90.process( input, output_90 ) );
+    ASSERT_TRUE( filter_150.process( input, output_150 ) );
+
+    // Once the filters have settled, each holds its own tone and a trace of the other,
+    // exactly as much as their responses predict.
+    auto const leak_90  = dsp::magnitude_response( ils_90_filter, 150.0, sample_rate_hz );
+    auto const leak_150 = dsp::magnitude_response( ils_150_filter, 90.0, sample_rate_hz );
+
+    auto tones = dsp::ToneBankParams{ .tones_hz = { 90.0, 150.0 }, .channel_count = receivers };
+    auto bank_90  = dsp::ToneBank{ tones };
+    auto bank_150 = dsp::ToneBank{ tones };
+    ASSERT_TRUE( bank_90.process( output_90 ) );
+    ASSERT_TRUE( bank_150.process( output_150 ) );
+
+    for ( auto r = 0_UZ; r < receivers; ++r )
+    {
+        auto const level_90  = channels[ r ][ 0 ].y;
+        auto const level_150 = channels[ r ][ 1 ].y;
+
+        EXPECT_NEAR( glm::length( bank_90.value( 0, r ) ), level_90, 1.0e-4 ) << r;
+        EXPECT_NEAR( glm::length( bank_90.value( 1, r ) ), level_150 * leak_90, 1.0e-4 ) << r;
+        EXPECT_NEAR( glm::length( bank_150.value( 1, r ) ), level_150, 1.0e-4 ) << r;
+        EXPECT_NEAR( glm::length( bank_150.value( 0, r ) ), level_90 * leak_150, 1.0e-4 ) << r;
+    }
+}
+
+TEST( FilterTests, FirPicksOutTheSubcarrier )
+{
+    auto const input = synthesize( { { { 9'960.0, 0.3, 1.0 }, { 30.0, 1.0, 0.0 } } }, 4'800 );
+
+    auto filter = dsp::FirFilter{ subcarrier_filter };
+    auto output = input;
+    ASSERT_TRUE( filter.process( output, output ) );
+
+    auto bank = dsp::ToneBank{ { .tones_hz = { 30.0, 9'960.0 } } };
+    ASSERT_TRUE( bank.process( output ) );
+    EXPECT_LT( glm::length( bank.value( 0, 0 ) ), 1.0e-3 );
+    EXPECT_NEAR( glm::length( bank.value( 1, 0 ) ), 0.3, 1.0e-3 );
+}
+
+TEST( FilterTests, ChannelsAndBlocksAreIndependent )
+{
+    auto const channels = std::vector< std::vector< glm::dvec3 > >{
+        { { 440.0, 1.0, 0.0 } },
+        { { 1'500.0, 0.5, 1.0 }, { 60.0, 0.2, 0.0 } },
+        { { 5'000.0, 0.7, -2.0 } },
+    };
+    auto const input = synthesize( channels, 3'000 );
+
+    // Filtered together, in uneven blocks, in place.
+    auto fir    = dsp::FirFilter{ subcarrier_filter, channels.size( ) };
+    auto biquad = dsp::BiquadCascade{ envelope_filter, channels.size( ) };
+
+    auto fir_output    = input;
+    auto biquad_output = input;
+    auto start         = 0_UZ;
+    for ( auto const count : { 1_UZ, 7_UZ, 500_UZ, 1'492_UZ, 1'000_UZ } )
+    {
+        auto const block = std::span( fir_output ).subspan( start * 3_UZ, count * 3_UZ );
+        ASSERT_TRUE( fir.process( block, block ) );
+
+        auto const biquad_block = std::span( biquad_output ).subspan( start * 3_UZ, count * 3_UZ );
+        ASSERT_TRUE( biquad.process( biquad_block, biquad_block ) );
+        start += count;
+    }
+
+    // Filtered alone.
+    for ( auto c = 0_UZ; c < channels.size( ); ++c )
+    {
+        auto const alone = synthesize( { channels[ c ] }, 3'000 );
+
+        auto fir_alone    = std::vector< float32 >( alone.size( ) );
+        auto biquad_alone = std::vector< float32 >( alone.size( ) );
+        ASSERT_TRUE( dsp::FirFilter{ subcarrier_filter }.process( alone, fir_alone ) );
+        ASSERT_TRUE( dsp::BiquadCascade{ envelope_filter }.process( alone, biquad_alone ) );
+
+        for ( auto n = 0_UZ; n < alone.size( ); ++n )
+        {
+            auto const index = utils::array_index( c, n, channels.size( ) );
+            EXPECT_NEAR( fir_output[ index ], fir_alone[ n ], 1.0e-6F ) << c << ", " << n;
+            EXPECT_NEAR( biquad_output[ index ], biquad_alone[ n ], 1.0e-6F ) << c << ", " << n;
+        }
+    }
+
+    // The impulse response is the taps.
+    auto impulse = std::vector< float32 >( subcarrier_filter.size( ) + 10_UZ, 0.0F );
+    impulse.front( ) = 1.0F;
+    ASSERT_TRUE( dsp::FirFilter{ subcarrier_filter }.process( impulse, impulse ) );
+    for ( auto k = 0_UZ; k < subcarrier_filter.size( ); ++k )
+    {
+        EXPECT_EQ( impulse[ k ], subcarrier_filter[ k ] ) << k;
+    }
+    EXPECT_EQ( impulse.back( ), 0.0F );
+}
+
+TEST( FilterTests, RejectsInvalidInput )
+{
+    auto input  = std::vector< float32 >( 10 );
+    auto output = std::vector< float32 >( 10 );
+
+    auto fir       = dsp::FirFilter{ subcarrier_filter };
+    auto fir_three = dsp::FirFilter{ subcarrier_filter, 3 };
+    EXPECT_FALSE( dsp::FirFilter{ }.process( input, output ) );
+    EXPECT_FALSE( fir_three.process( input, output ) );
+    EXPECT_FALSE( fir.process( input, std::span( output ).first( 9 ) ) );
+
+    auto biquad_four = dsp::BiquadCascade{ envelope_filter, 4 };
+    auto biquad_five = dsp::BiquadCascade{ envelope_filter, 5 };
+    EXPECT_FALSE( dsp::BiquadCascade{ }.process( input, output ) );
+    EXPECT_FALSE( biquad_four.process( input, output ) );
+    EXPECT_TRUE( biquad_five.process( input, output ) );
+}
+
+} // namespace
+} // namespace ltb
@@ -0,0 +1,125 @@
+#include "ltb/dsp/impairments.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// standard
+#include <cmath>
+
+namespace ltb::dsp
+{
+
+Interferer::Interferer( InterfererParams params, float64 const sample_rate_hz )
+    : params_( std::move( params ) )
+    , carrier_( params_.offset_hz, 0.0, 1.0 / sample_rate_hz )
+    , modulation_( params_.modulation_hz, 0.0, 1.0 / sample_rate_hz )
+    , index_( ( params_.modulation_hz > 0.0 ) ? ( params_.deviation_hz / params_.modulation_hz )
+                                              : 0.0 )
+{
+}
+
+auto Interferer::params( ) const -> InterfererParams const&
+{
+    return params_;
+}
+
+auto Interferer::add( std::span< float32 > const samples ) -> void
+{
+    for ( auto& sample : samples )
+    {
+        sample += static_cast< float32 >( next( ).x );
+    }
+}
+
+auto Interferer::add( std::span< Iq > const iq ) -> void
+{
+    for ( auto& sample : iq )
+    {
+        sample += Iq( next( ) );
+    }
+}
+
+auto Interferer::next( ) -> glm::dvec2
+{
+    if ( 0_UZ == ( sample_count_ % Oscillator::reseed_interval ) )
+    {
+        carrier_.reseed( sample_count_ );
+        modulation_.reseed( sample_count_ );
+    }
+    ++sample_count_;
+
+    auto phasor = carrier_.phasor( );
+    carrier_.advance( );
+
+    // FM adds `index sin(2π fm t)` to the carrier phase.
+    if ( index_ != 0.0 )
+    {
+        auto const angle = index_ * modulation_.phasor( ).y;
+        modulation_.advance( );
+
+        auto const c = std::cos( angle );
+        auto const s = std::sin( angle );
+        phasor       = { ( phasor.x * c ) - ( phasor.y * s ), ( phasor.x * s ) + ( phasor.y * c ) };
+    }
+    return phasor * static_cast< float64 >( params_.amplitude );
+}
+
+auto noise_sigma( float64 const signal_power, float64 const snr_db ) -> float32
+{
+    return static_cast< float32 >( std::sqrt( signal_power / std::pow( 10.0, snr_db / 10.0 ) ) );
+}
+
+Impairments::Impairments( ImpairmentParams params, float64 const sample_rate_hz )
+    : params_( std::move( params ) )
+    , sample_rate_hz_( sample_rate_hz )
+    , noise_( params_.seed, params_.stream )
+{
+    for ( auto const& interferer : params_.interferers )
+    {
+        interferers_.emplace_back( interferer, sample_rate_hz );
+    }
+}
+
+auto Impairments::params( ) const -> ImpairmentParams const&
+{
+    return params_;
+}
+
+auto Impairments::apply( std::span< float32 > const samples ) -> utils::Result< void >
+{
+    LTB_CHECK( check( ) );
+
+    for ( auto& interferer : interferers_ )
+    {
+        interferer.add( samples );
+    }
+    if ( params_.noise_sigma > 0.0F )
+    {
+        noise_.add_gaussian( samples, params_.noise_sigma );
+    }
+    return utils::success( );
+}
+
+auto Impairments::apply( std::span< Iq > const iq ) -> utils::Result< void >
+{
+    LTB_CHECK( check( ) );
+
+    for ( auto& interferer : interferers_ )
+    {
+        interferer.add( iq );
+    }
+    if ( params_.noise_sigma > 0.0F )
+    {
+        noise_.add_gaussian( iq, params_.noise_sigma );
+    }
+    return utils::success( );
+}
+
+auto Impairments::check( ) const -> utils::Result< void >
+{
+    LTB_CHECK_VALID( sample_rate_hz_ > 0.0, "The sample rate must be positive" );
+    LTB_CHECK_VALID( params_.noise_sigma >= 0.0F, "The noise can't be negative" );
+    return utils::success( );
+}
+
+} // namespace ltb::dsp
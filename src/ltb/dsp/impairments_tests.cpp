@@ -0,0 +1,151 @@
+// project
+#include "ltb/dsp/impairments.hpp"
+#include "ltb/dsp/tone_bank.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+#include <gtest/gtest.h>
+
+// standard
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+constexpr auto sample_rate_hz = 48'000.0;
+
+TEST( ImpairmentsTests, AddsNoiseAtAnSnr )
+{
+    // A full-scale tone has a power of 1/2.
+    constexpr auto count = 96'000_UZ;
+
+    auto signal = std::vector< float32 >( count );
+    for ( auto n = 0_UZ; n < count; ++n )
+    {
+        auto const time_s = static_cast< float64 >( n ) / sample_rate_hz;
+        signal[ n ]       = static_cast< float32 >(
+            std::cos( glm::two_pi< float64 >( ) * 1'020.0 * time_s )
+        );
+    }
+
+    auto impaired    = signal;
+    auto impairments = dsp::Impairments{
+        { .noise_sigma = dsp::noise_sigma( 0.5, 20.0 ), .seed = 9U },
+        sample_rate_hz,
+    };
+    ASSERT_TRUE( impairments.apply( impaired ) );
+
+    auto noise_power = 0.0;
+    for ( auto n = 0_UZ; n < count; ++n )
+    {
+        auto const noise = static_cast< float64 >( impaired[ n ] - signal[ n ] );
+        noise_power += noise * noise;
+    }
+    noise_power /= static_cast< float64 >( count );
+    EXPECT_NEAR( 10.0 * std::log10( 0.5 / noise_power ), 20.0, 0.05 );
+}
+
+TEST( ImpairmentsTests, AddsInterferers )
+{
+    constexpr auto count = 4'800_UZ;
+
+    // A CW tone and an FM broadcast 9 kHz off, swinging ±3 kHz at 600 Hz.
+    auto const params = dsp::ImpairmentParams{
+        .interferers = {
+            { .offset_hz = 1'020.0, .amplitude = 0.1F },
+            {
+                .offset_hz     = 9'000.0,
+                .amplitude     = 0.5F,
+                .deviation_hz  = 3'000.0,
+                .modulation_hz = 600.0,
+            },
+        },
+    };
+
+    // Real: each carrier sits at its frequency. With a modulation index of 5, the FM
+    // carrier's own line is scaled by J0(5) and its sidebands 600 Hz away by J1(5).
+    auto real = std::vector< float32 >( count, 0.0F );
+    ASSERT_TRUE( dsp::Impairments( params, sample_rate_hz ).apply( real ) );
+
+    auto bank = dsp::ToneBank{ { .tones_hz = { 1'020.0, 9'000.0, 9'600.0 } } };
+    ASSERT_TRUE( bank.process( std::span( real ).last( bank.window_size( ) ) ) );
+
+    constexpr auto j0_of_5       = -0.177596771314338;
+    constexpr auto j1_of_5       = -0.327579137591465;
+    auto const     carrier_line  = 0.5 * std::abs( j0_of_5 );
+    auto const     sideband_line = 0.5 * std::abs( j1_of_5 );
+    EXPECT_NEAR( glm::length( bank.value( 0, 0 ) ), 0.1, 1.0e-5 );
+    EXPECT_NEAR( glm::length( bank.value( 1, 0 ) ), carrier_line, 1.0e-5 );
+    EXPECT_NEAR( glm::length( bank.value( 2, 0 ) ), sideband_line, 1.0e-5 );
+
+    // Complex, in uneven blocks: alone, the FM carrier has a constant amplitude and its
+    // frequency swings 3 kHz either side of 9 kHz.
+    auto fm = dsp::Impairments{
+        { .interferers = { params.interferers.back( ) } },
+        sample_rate_hz,
+    };
+    auto iq = std::vector< dsp::Iq >( count, dsp::Iq( 0.0F ) );
+    ASSERT_TRUE( fm.apply( std::span( iq ).first( 1'001 ) ) );
+    ASSERT_TRUE( fm.apply( std::span( iq ).subspan( 1'001 ) ) );
+
+    auto previous  = iq.front( );
+    auto frequency = std::vector< float32 >( count - 1_UZ );
+    ASSERT_TRUE( dsp::instantaneous_frequency(
+        std::span( iq ).subspan( 1 ),
+        sample_rate_hz,
+        previous,
+        frequency
+    ) );
+    for ( auto const sample : iq )
+    {
+        EXPECT_NEAR( glm::length( sample ), 0.5F, 1.0e-5F );
+    }
+    EXPECT_NEAR( *std::ranges::max_element( frequency ), 12'000.0F, 20.0F );
+    EXPECT_NEAR( *std::ranges::min_element( frequency ), 6'000.0F, 20.0F );
+}
+
+TEST( ImpairmentsTests, BlocksAreTheSameAsTheWhole )
+{
+    auto const params = dsp::ImpairmentParams{
+        .noise_sigma = 0.3F,
+        .interferers = { { .offset_hz = -2'000.0, .amplitude = 0.2F, .deviation_hz = 500.0 } },
+        .seed        = 5U,
+        .stream      = 11U,
+    };
+
+    auto whole = std::vector< dsp::Iq >( 3'000, dsp::Iq( 1.0F, 0.0F ) );
+    auto parts = whole;
+    ASSERT_TRUE( dsp::Impairments( params, sample_rate_hz ).apply( whole ) );
+
+    auto impairments = dsp::Impairments{ params, sample_rate_hz };
+    ASSERT_TRUE( impairments.apply( std::span( parts ).first( 7 ) ) );
+    ASSERT_TRUE( impairments.apply( std::span( parts ).subspan( 7, 1'500 ) ) );
+    ASSERT_TRUE( impairments.apply( std::span( parts ).subspan( 1'507 ) ) );
+
+    for ( auto n = 0_UZ; n < whole.size( ); ++n )
+    {
+        EXPECT_NEAR( parts[ n ].x, whole[ n ].x, 1.0e-6F ) << n;
+        EXPECT_NEAR( parts[ n ].y, whole[ n ].y, 1.0e-6F ) << n;
+    }
+}
+
+TEST( ImpairmentsTests, RejectsInvalidInput )
+{
+    auto samples = std::vector< float32 >( 10 );
+    auto iq      = std::vector< dsp::Iq >( 10 );
+
+    EXPECT_FALSE( dsp::Impairments{ }.apply( samples ) );
+    EXPECT_FALSE( dsp::Impairments( { }, 0.0 ).apply( iq ) );
+
+    auto negative = dsp::Impairments{ { .noise_sigma = -1.0F }, sample_rate_hz };
+    EXPECT_FALSE( negative.apply( samples ) );
+    EXPECT_TRUE( dsp::Impairments( { }, sample_rate_hz ).apply( iq ) );
+}
+
+} // namespace
+} // namespace ltb
@@ -0,0 +1,260 @@
+#include "ltb/dsp/iq_recording.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// standard
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+
+namespace ltb::dsp
+{
+namespace
+{
+
+static_assert( std::endian::native == std::endian::little, "IQ recordings are little-endian" );
+
+constexpr auto magic   = std::string_view{ "LTBIQREC" };
+constexpr auto version = uint32{ 1 };
+
+/// \brief Full scale of Cs16 samples.
+constexpr auto cs16_scale = 32'768.0F;
+
+/// \brief Converted Cs16 samples are written this many at a time.
+constexpr auto write_block_size = 4'096_UZ;
+
+/// \brief The header exactly as it is stored at the start of the file.
+struct FileHeader
+{
+    std::array< char, 8 >  magic               = { };
+    uint32                 version             = 0;
+    uint32                 format              = 0;
+    float64                sample_rate_hz      = 0.0;
+    float64                center_frequency_hz = 0.0;
+    std::array< char, 32 > reserved            = { };
+};
+
+constexpr auto header_size = sizeof( FileHeader );
+static_assert( 64 == header_size );
+
+struct Cs16
+{
+    int16 i = 0;
+    int16 q = 0;
+};
+static_assert( 4 == sizeof( Cs16 ) );
+
+auto check_info( IqRecordingInfo const& info ) -> utils::Result< void >
+{
+    LTB_CHECK_VALID(
+        ( IqFormat::Cf32 == info.format ) || ( IqFormat::Cs16 == info.format ),
+        "Unknown IQ sample format"
+    );
+    LTB_CHECK_VALID( info.sample_rate_hz > 0.0, "The sample rate must be positive" );
+    return utils::success( );
+}
+
+auto to_cs16( float32 const value ) -> int16
+{
+    auto const scaled = std::round( value * cs16_scale );
+    return static_cast< int16 >( std::clamp( scaled, -cs16_scale, cs16_scale - 1.0F ) );
+}
+
+} // namespace
+
+auto sample_bytes( IqFormat const format ) -> std::size_t
+{
+    switch ( format )
+    {
+        using enum IqFormat;
+        case Cf32:
+            return sizeof( Iq );
+        case Cs16:
+            return sizeof( Cs16 );
+    }
+    return 0_UZ;
+}
+
+auto write_iq_recording(
+    std::filesystem::path const& path,
+    IqRecordingInfo const&       info,
+    std::span< Iq const > const  iq
+) -> utils::Result< void >
+{
+    LTB_CHECK( check_info( info ) );
+
+    auto file = std::ofstream( path, std::ios::binary | std::ios::out | std::ios::trunc );
+    if ( !file )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR( "Failed to create '{}'", path.string( ) );
+    }
+
+    auto header = FileHeader{
+        .version             = version,
+        .format              = static_cast< uint32 >( info.format ),
+        .sample_rate_hz      = info.sample_rate_hz,
+        .center_frequency_hz = info.center_frequency_hz,
+    };
+    std::ranges::copy( magic, header.magic.begin( ) );
+    file.write( reinterpret_cast< char const* >( &header ), sizeof( header ) );
+
+    if ( IqFormat::Cf32 == info.format )
+    {
+        file.write(
+            reinterpret_cast< char const* >( iq.data( ) ),
+            static_cast< std::streamsize >( iq.size_bytes( ) )
+        );
+    }
+    else
+    {
+        auto block = std::vector< Cs16 >( std::min( write_block_size, iq.size( ) ) );
+        for ( auto start = 0_UZ; start < iq.size( ); start += block.size( ) )
+        {
+            auto const count = std::min( block.size( ), iq.size( ) - start );
+            for ( auto i = 0_UZ; i < count; ++i )
+            {
+                block[ i ] = { to_cs16( iq[ start + i ].x ), to_cs16( iq[ start + i ].y ) };
+            }
+            file.write(
+                reinterpret_cast< char const* >( block.data( ) ),
+                static_cast< std::streamsize >( count * sizeof( Cs16 ) )
+            );
+        }
+    }
+
+    file.close( );
+    if ( !file )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR( "Failed to write '{}'", path.string( ) );
+    }
+    return utils::success( );
+}
+
+auto IqRecording::open( std::filesystem::path const& path ) -> utils::Result< IqRecording >
+{
+    LTB_CHECK( auto file, utils::MappedFile::open( path ) );
+
+    auto const bytes = file.bytes( );
+    if ( bytes.size( ) < header_size )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "'{}' is too small to be an IQ recording",
+            path.string( )
+        );
+    }
+
+    auto header = FileHeader{ };
+    std::memcpy( &header, bytes.data( ), sizeof( header ) );
+
+    if ( ( std::string_view{ header.magic.data( ), header.magic.size( ) } != magic )
+         || ( version != header.version ) )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "'{}' is not a version {} IQ recording",
+            path.string( ),
+            version
+        );
+    }
+
+    return from_mapping(
+        std::move( file ),
+        {
+            .format              = static_cast< IqFormat >( header.format ),
+            .sample_rate_hz      = header.sample_rate_hz,
+            .center_frequency_hz = header.center_frequency_hz,
+        },
+        header_size
+    );
+}
+
+auto IqRecording::open_raw( std::filesystem::path const& path, IqRecordingInfo const& info )
+    -> utils::Result< IqRecording >
+{
+    LTB_CHECK( auto file, utils::MappedFile::open( path ) );
+    return from_mapping( std::move( file ), info, 0_UZ );
+}
+
+auto IqRecording::from_mapping(
+    utils::MappedFile      file,
+    IqRecordingInfo const& info,
+    std::size_t const      data_offset
+) -> utils::Result< IqRecording >
+{
+    LTB_CHECK( check_info( info ) );
+
+    // A partial sample at the end, from a recording cut short, is ignored.
+    auto recording          = IqRecording{ };
+    recording.file_         = std::move( file );
+    recording.info_         = info;
+    recording.data_offset_  = data_offset;
+    recording.sample_count_ = ( recording.file_.bytes( ).size( ) - data_offset )
+                            / sample_bytes( info.format );
+    return recording;
+}
+
+auto IqRecording::info( ) const -> IqRecordingInfo const&
+{
+    return info_;
+}
+
+auto IqRecording::sample_count( ) const -> std::size_t
+{
+    return sample_count_;
+}
+
+auto IqRecording::duration_s( ) const -> float64
+{
+    return static_cast< float64 >( sample_count_ ) / info_.sample_rate_hz;
+}
+
+auto IqRecording::position( ) const -> std::size_t
+{
+    return position_;
+}
+
+auto IqRecording::seek( std::size_t const index ) -> utils::Result< void >
+{
+    LTB_CHECK_VALID( index <= sample_count_, "Seek past the end of the recording" );
+    position_ = index;
+    return utils::success( );
+}
+
+auto IqRecording::seek_time( float64 const time_s ) -> utils::Result< void >
+{
+    LTB_CHECK_VALID( ( time_s >= 0.0 ) && ( time_s <= duration_s( ) ) );
+    return seek( static_cast< std::size_t >( std::ceil( time_s * info_.sample_rate_hz ) ) );
+}
+
+auto IqRecording::next_block( std::size_t const max_samples ) -> std::span< Iq const >
+{
+    auto const count = std::min( max_samples, sample_count_ - position_ );
+    auto const start = file_.bytes( ).subspan(
+        data_offset_ + ( position_ * sample_bytes( info_.format ) ),
+        count * sample_bytes( info_.format )
+    );
+    position_ += count;
+
+    if ( IqFormat::Cf32 == info_.format )
+    {
+        // The mapping is page aligned and the header a multiple of 8 bytes, so the samples
+        // can be used in place.
+        return { reinterpret_cast< Iq const* >( start.data( ) ), count };
+    }
+
+    block_.resize( std::max( block_.size( ), count ) );
+    for ( auto i = 0_UZ; i < count; ++i )
+    {
+        auto sample = Cs16{ };
+        std::memcpy( &sample, start.data( ) + ( i * sizeof( Cs16 ) ), sizeof( Cs16 ) );
+        block_[ i ] = Iq( static_cast< float32 >( sample.i ), static_cast< float32 >( sample.q ) )
+                    / cs16_scale;
+    }
+    return std::span( block_ ).first( count );
+}
+
+} // namespace ltb::dsp
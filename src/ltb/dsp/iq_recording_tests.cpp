@@ -0,0 +1,141 @@
+// project
+#include "ltb/dsp/iq_recording.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <gtest/gtest.h>
+
+// standard
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+auto temp_path( std::string const& name ) -> std::filesystem::path
+{
+    return std::filesystem::temp_directory_path( ) / ( "ltb_iq_recording_" + name + ".bin" );
+}
+
+auto test_samples( std::size_t const count ) -> std::vector< dsp::Iq >
+{
+    auto iq = std::vector< dsp::Iq >( count );
+    for ( auto i = 0_UZ; i < count; ++i )
+    {
+        auto const t = static_cast< float32 >( i );
+        iq[ i ]      = { 0.9F * std::sin( 0.01F * t ), -0.5F * std::cos( 0.003F * t ) };
+    }
+    return iq;
+}
+
+TEST( IqRecordingTests, BlocksRoundTripInEveryFormat )
+{
+    auto const iq = test_samples( 10'000 );
+
+    for ( auto const format : { dsp::IqFormat::Cf32, dsp::IqFormat::Cs16 } )
+    {
+        auto const path = temp_path( "round_trip" );
+        auto const info = dsp::IqRecordingInfo{
+            .format              = format,
+            .sample_rate_hz      = 2'400'000.0,
+            .center_frequency_hz = 110.1e6,
+        };
+        ASSERT_TRUE( dsp::write_iq_recording( path, info, iq ) );
+        EXPECT_EQ(
+            std::filesystem::file_size( path ),
+            64_UZ + ( iq.size( ) * dsp::sample_bytes( format ) )
+        );
+
+        auto recording = dsp::IqRecording::open( path );
+        ASSERT_TRUE( recording ) << recording.error( ).debug_error_message( );
+        EXPECT_EQ( recording->info( ), info );
+        EXPECT_EQ( recording->sample_count( ), iq.size( ) );
+
+        // Cs16 keeps 15 bits of each value.
+        auto const tolerance = ( dsp::IqFormat::Cf32 == format ) ? 0.0F : 1.0F / 32'768.0F;
+
+        auto read = 0_UZ;
+        for ( auto block = recording->next_block( 3'000 ); !block.empty( );
+              block      = recording->next_block( 3'000 ) )
+        {
+            EXPECT_EQ( block.size( ), std::min( 3'000_UZ, iq.size( ) - read ) );
+            for ( auto const sample : block )
+            {
+                EXPECT_NEAR( sample.x, iq[ read ].x, tolerance ) << read;
+                EXPECT_NEAR( sample.y, iq[ read ].y, tolerance ) << read;
+                ++read;
+            }
+        }
+        EXPECT_EQ( read, iq.size( ) );
+        EXPECT_EQ( recording->position( ), iq.size( ) );
+    }
+
+    std::filesystem::remove( temp_path( "round_trip" ) );
+}
+
+TEST( IqRecordingTests, SeeksBySampleAndTime )
+{
+    auto const path = temp_path( "seek" );
+    auto const iq   = test_samples( 1'000 );
+    ASSERT_TRUE( dsp::write_iq_recording( path, { .sample_rate_hz = 100.0 }, iq ) );
+
+    auto recording = dsp::IqRecording::open( path );
+    ASSERT_TRUE( recording );
+    EXPECT_DOUBLE_EQ( recording->duration_s( ), 10.0 );
+
+    ASSERT_TRUE( recording->seek( 700 ) );
+    EXPECT_EQ( recording->next_block( 1 ).front( ), iq[ 700 ] );
+
+    ASSERT_TRUE( recording->seek_time( 2.345 ) );
+    EXPECT_EQ( recording->position( ), 235_UZ );
+    EXPECT_EQ( recording->next_block( 1 ).front( ), iq[ 235 ] );
+
+    ASSERT_TRUE( recording->seek( 1'000 ) );
+    EXPECT_TRUE( recording->next_block( 10 ).empty( ) );
+
+    EXPECT_FALSE( recording->seek( 1'001 ) );
+    EXPECT_FALSE( recording->seek_time( -1.0 ) );
+
+    std::filesystem::remove( path );
+}
+
+TEST( IqRecordingTests, OpensHeaderlessRecordings )
+{
+    auto const path = temp_path( "raw" );
+
+    // Two whole Cs16 samples and half of a third, as a recording cut short would be.
+    auto const values = std::vector< int16 >{ 16'384, -16'384, -32'768, 0, 1 };
+    {
+        auto file = std::ofstream( path, std::ios::binary );
+        file.write(
+            reinterpret_cast< char const* >( values.data( ) ),
+            static_cast< std::streamsize >( values.size( ) * sizeof( int16 ) )
+        );
+    }
+
+    EXPECT_FALSE( dsp::IqRecording::open( path ) );
+
+    auto recording = dsp::IqRecording::open_raw(
+        path,
+        { .format = dsp::IqFormat::Cs16, .sample_rate_hz = 1'000.0 }
+    );
+    ASSERT_TRUE( recording );
+    ASSERT_EQ( recording->sample_count( ), 2_UZ );
+
+    auto const block = recording->next_block( 8 );
+    ASSERT_EQ( block.size( ), 2_UZ );
+    EXPECT_EQ( block[ 0 ], dsp::Iq( 0.5F, -0.5F ) );
+    EXPECT_EQ( block[ 1 ], dsp::Iq( -1.0F, 0.0F ) );
+
+    EXPECT_FALSE( dsp::IqRecording::open_raw( path, { .sample_rate_hz = 0.0 } ) );
+
+    std::filesystem::remove( path );
+}
+
+} // namespace
+} // namespace ltb
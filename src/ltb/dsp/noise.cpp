@@ -0,0 +1,303 @@
+#include "ltb/dsp/noise.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// standard
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace ltb::dsp
+{
+namespace
+{
+
+constexpr auto layer_count = 128_UZ;
+constexpr auto layer_mask  = uint32{ layer_count - 1_UZ };
+
+/// \brief Where the ziggurat's base layer meets its tail, and the area of each layer.
+constexpr auto tail_start = 3.442619855899;
+constexpr auto layer_area = 9.91256303526217e-3;
+
+/// \brief The 25 bits above the layer index hold a signed offset within the layer.
+constexpr auto offset_scale = 16'777'216.0;
+
+/// \brief 24 random bits to a value in [0, 1).
+constexpr auto unit_scale = 1.0 / 16'777'216.0;
+
+/// \brief Values at the same counter as a burst of four, or retries for one value.
+constexpr auto burst_attempt = 0U;
+
+/// \brief Marsaglia and Tsang's ziggurat for the normal distribution: layer `i` spans
+///        `|x| < offset_limit * widths[ i ]` and its accepted offsets need no more work.
+struct Ziggurat
+{
+    std::array< uint32, layer_count >  offset_limits = { };
+    std::array< float64, layer_count > widths        = { };
+    std::array< float64, layer_count > heights       = { };
+};
+
+auto make_ziggurat( ) -> Ziggurat
+{
+    auto table = Ziggurat{ };
+
+    auto edge     = tail_start;
+    auto previous = tail_start;
+    auto const q  = layer_area / std::exp( -0.5 * edge * edge );
+
+    table.offset_limits[ 0 ] = static_cast< uint32 >( ( edge / q ) * offset_scale );
+    table.offset_limits[ 1 ] = 0U;
+
+    table.widths[ 0 ]               = q / offset_scale;
+    table.widths[ layer_count - 1 ] = edge / offset_scale;
+
+    table.heights[ 0 ]               = 1.0;
+    table.heights[ layer_count - 1 ] = std::exp( -0.5 * edge * edge );
+
+    for ( auto i = layer_count - 2_UZ; i >= 1_UZ; --i )
+    {
+        auto const height = std::exp( -0.5 * edge * edge );
+        edge              = std::sqrt( -2.0 * std::log( ( layer_area / edge ) + height ) );
+
+        auto const limit                = ( edge / previous ) * offset_scale;
+        table.offset_limits[ i + 1_UZ ] = static_cast< uint32 >( limit );
+        table.heights[ i ]              = std::exp( -0.5 * edge * edge );
+        table.widths[ i ]               = edge / offset_scale;
+        previous                        = edge;
+    }
+    return table;
+}
+
+auto ziggurat( ) -> Ziggurat const&
+{
+    static auto const table = make_ziggurat( );
+    return table;
+}
+
+auto unit( uint32 const word ) -> float64
+{
+    return static_cast< float64 >( word >> 8U ) * unit_scale;
+}
+
+/// \brief The layer and signed offset a word picks.
+struct Draw
+{
+    std::size_t layer;
+    int32       offset;
+
+    explicit Draw( uint32 const word )
+        : layer( word & layer_mask )
+        , offset( static_cast< int32 >( word ) >> 7 )
+    {
+    }
+
+    [[nodiscard( "Const getter" )]]
+    auto accepted( Ziggurat const& table ) const -> bool
+    {
+        auto const magnitude = static_cast< uint32 >( ( offset < 0 ) ? -offset : offset );
+        return magnitude < table.offset_limits[ layer ];
+    }
+
+    [[nodiscard( "Const getter" )]]
+    auto value( Ziggurat const& table ) const -> float64
+    {
+        return static_cast< float64 >( offset ) * table.widths[ layer ];
+    }
+};
+
+} // namespace
+
+NoiseStream::NoiseStream( uint64 const seed, uint32 const stream )
+    : key_( { static_cast< uint32 >( seed ), static_cast< uint32 >( seed >> 32U ) } )
+    , stream_( stream )
+{
+}
+
+auto NoiseStream::position( ) const -> uint64
+{
+    return position_;
+}
+
+auto NoiseStream::seek( uint64 const position ) -> void
+{
+    position_ = position;
+}
+
+auto NoiseStream::uniform( std::span< float32 > const values ) -> void
+{
+    auto i = 0_UZ;
+    while ( i < values.size( ) )
+    {
+        auto const burst = words( position_ / 4U );
+        for ( auto w = position_ % 4U; ( w < 4U ) && ( i < values.size( ) ); ++w, ++i )
+        {
+            values[ i ] = static_cast< float32 >( unit( burst[ w ] ) );
+            ++position_;
+        }
+    }
+}
+
+auto NoiseStream::gaussian( std::span< float32 > const values ) -> void
+{
+    auto const& table = ziggurat( );
+
+    auto i = 0_UZ;
+    while ( i < values.size( ) )
+    {
+        auto const burst = words( position_ / 4U );
+        for ( auto w = position_ % 4U; ( w < 4U ) && ( i < values.size( ) ); ++w, ++i )
+        {
+            auto const draw = Draw{ burst[ w ] };
+            values[ i ]     = draw.accepted( table ) ? static_cast< float32 >( draw.value( table ) )
+                                                     : normal( burst[ w ], position_ );
+            ++position_;
+        }
+    }
+}
+
+auto NoiseStream::add_gaussian( std::span< float32 > const values, float32 const sigma ) -> void
+{
+    auto chunk = std::array< float32, 256 >{ };
+    for ( auto start = 0_UZ; start < values.size( ); start += chunk.size( ) )
+    {
+        auto const count = std::min( chunk.size( ), values.size( ) - start );
+        gaussian( std::span( chunk ).first( count ) );
+        for ( auto i = 0_UZ; i < count; ++i )
+        {
+            values[ start + i ] += sigma * chunk[ i ];
+        }
+    }
+}
+
+auto NoiseStream::add_gaussian( std::span< Iq > const iq, float32 const sigma ) -> void
+{
+    auto const component_sigma = sigma / std::sqrt( 2.0F );
+
+    auto       chunk = std::array< float32, 256 >{ };
+    auto const pairs = chunk.size( ) / 2_UZ;
+    for ( auto start = 0_UZ; start < iq.size( ); start += pairs )
+    {
+        auto const count = std::min( pairs, iq.size( ) - start );
+        gaussian( std::span( chunk ).first( count * 2_UZ ) );
+        for ( auto i = 0_UZ; i < count; ++i )
+        {
+            auto const noise = Iq( chunk[ 2_UZ * i ], chunk[ ( 2_UZ * i ) + 1_UZ ] );
+            iq[ start + i ] += component_sigma * noise;
+        }
+    }
+}
+
+auto NoiseStream::words( uint64 const k ) const -> std::array< uint32, 4 >
+{
+    return philox(
+        { static_cast< uint32 >( k ), static_cast< uint32 >( k >> 32U ), stream_, burst_attempt },
+        key_
+    );
+}
+
+auto NoiseStream::normal( uint32 const word, uint64 const position ) const -> float32
+{
+    auto const& table = ziggurat( );
+
+    // Further words for this value alone, four at a time.
+    auto attempt = burst_attempt;
+    auto retry   = std::array< uint32, 4 >{ };
+    auto used    = retry.size( );
+    auto next    = [ & ]( ) -> uint32
+    {
+        if ( used == retry.size( ) )
+        {
+            ++attempt;
+            retry = philox(
+                { static_cast< uint32 >( position ),
+                  static_cast< uint32 >( position >> 32U ),
+                  stream_,
+                  attempt },
+                key_
+            );
+            used = 0_UZ;
+        }
+        return retry[ used++ ];
+    };
+    // Strictly inside (0, 1), for the logarithms.
+    auto next_unit = [ & ]( ) { return unit( next( ) ) + ( 0.5 * unit_scale ); };
+
+    auto draw = Draw{ word };
+    while ( true )
+    {
+        auto const x = draw.value( table );
+
+        // The base layer: a point from the tail past `tail_start`.
+        if ( 0_UZ == draw.layer )
+        {
+            auto tail = 0.0;
+            auto y    = 0.0;
+            do
+            {
+                tail = -std::log( next_unit( ) ) / tail_start;
+                y    = -std::log( next_unit( ) );
+            } while ( ( y + y ) < ( tail * tail ) );
+            return static_cast< float32 >( ( draw.offset > 0 ) ? ( tail_start + tail )
+                                                               : -( tail_start + tail ) );
+        }
+
+        // The wedge of the layer outside the rectangle below it.
+        auto const low  = table.heights[ draw.layer ];
+        auto const high = table.heights[ draw.layer - 1_UZ ];
+        if ( ( low + ( next_unit( ) * ( high - low ) ) ) < std::exp( -0.5 * x * x ) )
+        {
+            return static_cast< float32 >( x );
+        }
+
+        draw = Draw{ next( ) };
+        if ( draw.accepted( table ) )
+        {
+            return static_cast< float32 >( draw.value( table ) );
+        }
+    }
+}
+
+auto measure_noise_throughput( std::size_t const block_size, float64 const seconds_each )
+    -> utils::Result< NoiseThroughput >
+{
+    LTB_CHECK_VALID( block_size > 0_UZ );
+
+    using Clock = std::chrono::steady_clock;
+
+    auto values = std::vector< float32 >( block_size );
+
+    auto const mega_samples_per_s = [ &values, seconds_each ]( auto&& fill ) -> float64
+    {
+        auto       count   = 0_UZ;
+        auto const start   = Clock::now( );
+        auto       elapsed = 0.0;
+        do
+        {
+            fill( std::span( values ) );
+            count += values.size( );
+            elapsed = std::chrono::duration< float64 >( Clock::now( ) - start ).count( );
+        } while ( elapsed < seconds_each );
+        return static_cast< float64 >( count ) * 1.0e-6 / elapsed;
+    };
+
+    auto stream = NoiseStream{ 0U, 0U };
+
+    auto engine       = std::mt19937{ };
+    auto distribution = std::normal_distribution< float32 >{ };
+
+    auto const uniform  = [ &stream ]( std::span< float32 > const v ) { stream.uniform( v ); };
+    auto const gaussian = [ &stream ]( std::span< float32 > const v ) { stream.gaussian( v ); };
+    auto const standard = [ &engine, &distribution ]( std::span< float32 > const v )
+    { std::ranges::generate( v, [ & ] { return distribution( engine ); } ); };
+
+    return NoiseThroughput{
+        .uniform_mega_samples_per_s  = mega_samples_per_s( uniform ),
+        .gaussian_mega_samples_per_s = mega_samples_per_s( gaussian ),
+        .standard_mega_samples_per_s = mega_samples_per_s( standard ),
+    };
+}
+
+} // namespace ltb::dsp
@@ -0,0 +1,150 @@
+// project
+#include "ltb/dsp/noise.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <gtest/gtest.h>
+
+// standard
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+// Known answers from the Random123 reference implementation.
+static_assert(
+    dsp::philox( { 0U, 0U, 0U, 0U }, { 0U, 0U } )
+    == std::array< uint32, 4 >{ 0x6627E8D5U, 0xE169C58DU, 0xBC57AC4CU, 0x9B00DBD8U }
+);
+static_assert(
+    dsp::philox( { ~0U, ~0U, ~0U, ~0U }, { ~0U, ~0U } )
+    == std::array< uint32, 4 >{ 0x408F276DU, 0x41C83B0EU, 0xA20BC7C6U, 0x6D5451FDU }
+);
+static_assert(
+    dsp::philox(
+        { 0x243F6A88U, 0x85A308D3U, 0x13198A2EU, 0x03707344U },
+        { 0xA4093822U, 0x299F31D0U }
+    )
+    == std::array< uint32, 4 >{ 0xD16CFE09U, 0x94FDCCEBU, 0x5001E420U, 0x24126EA1U }
+);
+
+TEST( NoiseTests, StreamsRepeatInAnyBlocks )
+{
+    constexpr auto count = 10'000_UZ;
+
+    auto whole = std::vector< float32 >( count );
+    dsp::NoiseStream{ 42U, 7U }.gaussian( whole );
+
+    auto stream = dsp::NoiseStream{ 42U, 7U };
+    auto blocks = std::vector< float32 >( count );
+    auto start  = 0_UZ;
+    for ( auto const size : { 1_UZ, 3_UZ, 4_UZ, 5_UZ, 987_UZ, 9'000_UZ } )
+    {
+        stream.gaussian( std::span( blocks ).subspan( start, size ) );
+        start += size;
+    }
+    EXPECT_EQ( stream.position( ), count );
+    EXPECT_EQ( blocks, whole );
+
+    // Any stretch can be drawn again on its own, as another thread would.
+    auto again = std::vector< float32 >( 100 );
+    stream.seek( 5'001U );
+    stream.gaussian( again );
+    EXPECT_TRUE( std::ranges::equal( again, std::span( whole ).subspan( 5'001, 100 ) ) );
+
+    // Other streams and seeds are different.
+    auto other = std::vector< float32 >( count );
+    dsp::NoiseStream{ 42U, 8U }.gaussian( other );
+    EXPECT_NE( other, whole );
+    dsp::NoiseStream{ 43U, 7U }.gaussian( other );
+    EXPECT_NE( other, whole );
+}
+
+TEST( NoiseTests, GaussianValuesAreNormal )
+{
+    constexpr auto count = 4'000'000_UZ;
+
+    auto values = std::vector< float32 >( count );
+    dsp::NoiseStream{ 1U, 0U }.gaussian( values );
+
+    auto sum       = 0.0;
+    auto squares   = 0.0;
+    auto fourths   = 0.0;
+    auto past_one  = 0_UZ;
+    auto past_tail = 0_UZ;
+    for ( auto const value : values )
+    {
+        auto const x = static_cast< float64 >( value );
+        sum += x;
+        squares += x * x;
+        fourths += x * x * x * x;
+        past_one += ( std::abs( x ) > 1.0 ) ? 1_UZ : 0_UZ;
+        past_tail += ( std::abs( x ) > 3.5 ) ? 1_UZ : 0_UZ;
+    }
+
+    auto const n = static_cast< float64 >( count );
+    EXPECT_NEAR( sum / n, 0.0, 2.0e-3 );
+    EXPECT_NEAR( squares / n, 1.0, 3.0e-3 );
+    EXPECT_NEAR( fourths / n, 3.0, 2.0e-2 );
+
+    // P(|x| > 1) and P(|x| > 3.5), the second from the tail past the ziggurat's base.
+    EXPECT_NEAR( static_cast< float64 >( past_one ) / n, 0.317311, 1.0e-3 );
+    EXPECT_NEAR( static_cast< float64 >( past_tail ) / n, 4.6525e-4, 4.0e-5 );
+}
+
+TEST( NoiseTests, UniformValuesFillTheUnitInterval )
+{
+    constexpr auto count = 1'000'000_UZ;
+    constexpr auto bins  = 10_UZ;
+
+    auto values = std::vector< float32 >( count );
+    dsp::NoiseStream{ 1U, 0U }.uniform( values );
+
+    auto histogram = std::vector< std::size_t >( bins, 0_UZ );
+    for ( auto const value : values )
+    {
+        ASSERT_GE( value, 0.0F );
+        ASSERT_LT( value, 1.0F );
+        ++histogram[ static_cast< std::size_t >( value * static_cast< float32 >( bins ) ) ];
+    }
+    for ( auto const in_bin : histogram )
+    {
+        EXPECT_NEAR( static_cast< float64 >( in_bin ), 1.0e5, 1.5e3 );
+    }
+}
+
+TEST( NoiseTests, ComplexNoiseSplitsItsPower )
+{
+    constexpr auto count = 200'000_UZ;
+
+    auto iq = std::vector< dsp::Iq >( count, dsp::Iq( 0.0F ) );
+    dsp::NoiseStream{ 3U, 0U }.add_gaussian( iq, 0.5F );
+
+    auto power = glm::dvec2( 0.0 );
+    for ( auto const sample : iq )
+    {
+        power += glm::dvec2( sample * sample );
+    }
+    power /= static_cast< float64 >( count );
+
+    EXPECT_NEAR( power.x, 0.125, 2.0e-3 );
+    EXPECT_NEAR( power.y, 0.125, 2.0e-3 );
+}
+
+TEST( NoiseTests, MeasuresEveryGenerator )
+{
+    EXPECT_FALSE( dsp::measure_noise_throughput( 0, 0.0 ) );
+
+    auto const throughput = dsp::measure_noise_throughput( 1'024, 0.0 );
+    ASSERT_TRUE( throughput );
+    EXPECT_GT( throughput->uniform_mega_samples_per_s, 0.0 );
+    EXPECT_GT( throughput->gaussian_mega_samples_per_s, 0.0 );
+    EXPECT_GT( throughput->standard_mega_samples_per_s, 0.0 );
+}
+
+} // namespace
+} // namespace ltb
@@ -0,0 +1,37 @@
+#include "ltb/dsp/oscillator.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <cmath>
+
+namespace ltb::dsp
+{
+namespace
+{
+
+auto phasor_at( float64 const cycles ) -> glm::dvec2
+{
+    auto const radians = glm::two_pi< float64 >( ) * cycles;
+    return { std::cos( radians ), std::sin( radians ) };
+}
+
+} // namespace
+
+Oscillator::Oscillator( float64 const frequency, float64 const start, float64 const step )
+    : frequency_( frequency )
+    , start_( start )
+    , step_( step )
+    , rotation_( phasor_at( frequency * step ) )
+{
+    reseed( 0 );
+}
+
+auto Oscillator::reseed( std::size_t const index ) -> void
+{
+    auto const t = start_ + ( static_cast< float64 >( index ) * step_ );
+    phasor_      = phasor_at( frequency_ * t );
+}
+
+} // namespace ltb::dsp
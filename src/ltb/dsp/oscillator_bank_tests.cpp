@@ -0,0 +1,62 @@
+// project
+#include "ltb/dsp/oscillator_bank.hpp"
+
+// external
+#include <gtest/gtest.h>
+
+// standard
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+TEST( OscillatorBankTests, MatchesSineAtEverySample )
+{
+    // Not a whole number of lanes or blocks.
+    constexpr auto count = 1'000'003_UZ;
+    constexpr auto start = 12.5;
+    constexpr auto step  = 100.0 / 50'000.0;
+
+    auto const frequencies = std::array{ 117.3, 9'960.0 / 1.0e6, 0.03 };
+    auto const bank        = dsp::OscillatorBank< 3 >{ frequencies, start, step };
+
+    auto sines   = std::vector< std::array< float64, 3 > >( count );
+    auto written = std::vector< int32 >( count, 0 );
+    bank.generate(
+        count,
+        [ & ]( std::size_t const i, std::array< float64, 3 > const& sample )
+        {
+            sines[ i ] = sample;
+            ++written[ i ];
+        }
+    );
+
+    EXPECT_EQ( std::ranges::count( written, 1 ), static_cast< std::ptrdiff_t >( count ) );
+
+    auto max_error = 0.0;
+    for ( auto i = 0_UZ; i < count; ++i )
+    {
+        auto const time = start + ( static_cast< float64 >( i ) * step );
+        for ( auto t = 0_UZ; t < frequencies.size( ); ++t )
+        {
+            auto const expected = std::sin( glm::two_pi< float64 >( ) * frequencies[ t ] * time );
+            max_error           = std::max( max_error, std::abs( sines[ i ][ t ] - expected ) );
+        }
+    }
+    EXPECT_LT( max_error, 1.0e-9 );
+}
+
+TEST( OscillatorBankTests, EmptyRangeWritesNothing )
+{
+    auto const bank  = dsp::OscillatorBank< 1 >{ { 1.0 }, 0.0, 0.1 };
+    auto       calls = 0;
+    bank.generate( 0, [ &calls ]( std::size_t, std::array< float64, 1 > const& ) { ++calls; } );
+    EXPECT_EQ( calls, 0 );
+}
+
+} // namespace
+} // namespace ltb
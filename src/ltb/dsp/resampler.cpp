@@ -0,0 +1,395 @@
+#include "ltb/dsp/resampler.hpp"
+
+// project
+#include "ltb/dsp/dot_details.hpp"
+#include "ltb/dsp/fft.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+namespace ltb::dsp
+{
+namespace
+{
+
+/// \brief A Blackman-Harris windowed sinc is this many cycles per sample wide from the
+///        end of its passband to 90 dB down, divided by its length.
+constexpr auto transition_width = 8.0;
+
+constexpr auto max_stage_factor = 10_UZ;
+
+/// \brief Samples per channel fed to each cascade while timing it.
+constexpr auto benchmark_block_size = 1_UZ << 16U;
+
+auto valid( ResamplerParams const& params ) -> bool
+{
+    return ( params.interpolation > 0_UZ ) && ( params.decimation > 0_UZ )
+        && ( params.passband > 0.0 ) && ( params.passband < params.stopband )
+        && ( params.channel_count > 0_UZ );
+}
+
+} // namespace
+
+Resampler::Resampler( ResamplerParams params )
+    : params_( std::move( params ) )
+{
+    if ( !valid( params_ ) )
+    {
+        return;
+    }
+
+    auto const interpolation = params_.interpolation;
+    auto const slower_rate   = std::max( interpolation, params_.decimation );
+
+    // Frequencies in cycles per sample at the interpolated rate.
+    auto const nyquist = 0.5 / static_cast< float64 >( slower_rate );
+    auto const cutoff  = 0.5 * ( params_.passband + params_.stopband ) * nyquist;
+    auto const width   = ( params_.stopband - params_.passband ) * nyquist;
+
+    auto const min_taps   = static_cast< std::size_t >( std::ceil( transition_width / width ) );
+    auto const min_branch = ( min_taps + interpolation - 1_UZ ) / interpolation;
+    branch_size_          = details::lane_multiple( min_branch );
+
+    // The periodic window over one extra point is symmetric about the middle of the rest.
+    auto const tap_count = interpolation * branch_size_;
+    auto const window    = window_coefficients( Window::BlackmanHarris, tap_count + 1_UZ );
+    auto const middle    = 0.5 * static_cast< float64 >( tap_count - 1_UZ );
+
+    auto prototype = std::vector< float64 >( tap_count );
+    for ( auto n = 0_UZ; n < tap_count; ++n )
+    {
+        auto const from_middle = static_cast< float64 >( n ) - middle;
+        auto const x           = glm::two_pi< float64 >( ) * cutoff * from_middle;
+        auto const sinc        = ( 0.0 == x ) ? 1.0 : ( std::sin( x ) / x );
+        prototype[ n ]         = sinc * static_cast< float64 >( window[ n + 1_UZ ] );
+    }
+
+    // Interpolation leaves `interpolation - 1` zeros between inputs, which the gain makes up.
+    auto const gain = static_cast< float64 >( interpolation )
+                    / std::accumulate( prototype.begin( ), prototype.end( ), 0.0 );
+
+    branches_.resize( tap_count );
+    for ( auto phase = 0_UZ; phase < interpolation; ++phase )
+    {
+        for ( auto k = 0_UZ; k < branch_size_; ++k )
+        {
+            auto const tap = prototype[ phase + ( k * interpolation ) ] * gain;
+            auto const index
+                = utils::array_index( branch_size_ - 1_UZ - k, phase, branch_size_ );
+            branches_[ index ] = static_cast< float32 >( tap );
+        }
+    }
+
+    inputs_.resize( params_.channel_count, std::vector< float32 >( branch_size_ - 1_UZ, 0.0F ) );
+}
+
+auto Resampler::params( ) const -> ResamplerParams const&
+{
+    return params_;
+}
+
+auto Resampler::tap_count( ) const -> std::size_t
+{
+    return branches_.size( );
+}
+
+auto Resampler::output_count( std::size_t const input_count ) const -> std::size_t
+{
+    auto const end = input_count * params_.interpolation;
+    if ( ( 0_UZ == params_.decimation ) || ( offset_ >= end ) )
+    {
+        return 0_UZ;
+    }
+    return ( end - offset_ + params_.decimation - 1_UZ ) / params_.decimation;
+}
+
+auto Resampler::process( std::span< float32 const > const input, std::span< float32 > const output )
+    -> utils::Result< void >
+{
+    auto const channels = params_.channel_count;
+    LTB_CHECK( check( input.size( ), output.size( ), channels ) );
+
+    auto const input_count = input.size( ) / channels;
+    for ( auto c = 0_UZ; c < channels; ++c )
+    {
+        auto&      inputs = inputs_[ c ];
+        auto const start  = inputs.size( );
+        inputs.resize( start + input_count );
+        for ( auto n = 0_UZ; n < input_count; ++n )
+        {
+            inputs[ start + n ] = input[ utils::array_index( c, n, channels ) ];
+        }
+
+        filter(
+            c,
+            input_count,
+            [ &output, c, channels ]( std::size_t const index, float32 const value )
+            { output[ utils::array_index( c, index, channels ) ] = value; }
+        );
+    }
+    advance( input_count );
+    return utils::success( );
+}
+
+auto Resampler::process( std::span< Iq const > const input, std::span< Iq > const output )
+    -> utils::Result< void >
+{
+    LTB_CHECK_VALID( 2_UZ == params_.channel_count, "Complex samples need two channels" );
+    LTB_CHECK( check( input.size( ) * 2_UZ, output.size( ) * 2_UZ, 2_UZ ) );
+
+    for ( auto c = 0_UZ; c < 2_UZ; ++c )
+    {
+        auto&      inputs = inputs_[ c ];
+        auto const start  = inputs.size( );
+        inputs.resize( start + input.size( ) );
+        for ( auto n = 0_UZ; n < input.size( ); ++n )
+        {
+            inputs[ start + n ] = input[ n ][ static_cast< int32 >( c ) ];
+        }
+
+        filter(
+            c,
+            input.size( ),
+            [ &output, c ]( std::size_t const index, float32 const value )
+            { output[ index ][ static_cast< int32 >( c ) ] = value; }
+        );
+    }
+    advance( input.size( ) );
+    return utils::success( );
+}
+
+auto Resampler::check(
+    std::size_t const input_count,
+    std::size_t const output_count,
+    std::size_t const channels
+) const -> utils::Result< void >
+{
+    LTB_CHECK_VALID( valid( params_ ) );
+    LTB_CHECK_VALID( 0_UZ == ( input_count % channels ), "Every sample needs every channel" );
+    LTB_CHECK_VALID(
+        output_count == ( this->output_count( input_count / channels ) * channels ),
+        "The output must hold exactly the samples the input produces"
+    );
+    return utils::success( );
+}
+
+template < typename Write >
+auto Resampler::filter(
+    std::size_t const channel,
+    std::size_t const input_count,
+    Write const&      write
+) const -> void
+{
+    auto const  end    = input_count * params_.interpolation;
+    auto const* inputs = inputs_[ channel ].data( );
+
+    // Output `index` is at interpolated time `offset_ + index * decimation`, which is a
+    // whole `interpolation` steps past the newest input it needs plus one branch's phase.
+    auto index = 0_UZ;
+    for ( auto time = offset_; time < end; time += params_.decimation )
+    {
+        auto const newest = time / params_.interpolation;
+        auto const phase  = time % params_.interpolation;
+
+        auto const* branch = branches_.data( ) + ( phase * branch_size_ );
+        write( index, details::dot( branch, inputs + newest, branch_size_ ) );
+        ++index;
+    }
+}
+
+auto Resampler::advance( std::size_t const input_count ) -> void
+{
+    for ( auto& inputs : inputs_ )
+    {
+        auto const history = static_cast< std::ptrdiff_t >( branch_size_ - 1_UZ );
+        std::copy( inputs.end( ) - history, inputs.end( ), inputs.begin( ) );
+        inputs.resize( branch_size_ - 1_UZ );
+    }
+
+    auto const produced = output_count( input_count ) * params_.decimation;
+    offset_             = ( offset_ + produced ) - ( input_count * params_.interpolation );
+}
+
+ResamplerCascade::ResamplerCascade( std::vector< ResamplerParams > const& stages )
+{
+    for ( auto const& stage : stages )
+    {
+        stages_.emplace_back( stage );
+    }
+    if ( !stages_.empty( ) )
+    {
+        between_.resize( stages_.size( ) - 1_UZ );
+        between_iq_.resize( stages_.size( ) - 1_UZ );
+    }
+}
+
+auto ResamplerCascade::stages( ) const -> std::vector< Resampler > const&
+{
+    return stages_;
+}
+
+auto ResamplerCascade::output_count( std::size_t const input_count ) const -> std::size_t
+{
+    auto count = input_count;
+    for ( auto const& stage : stages_ )
+    {
+        count = stage.output_count( count );
+    }
+    return count;
+}
+
+auto ResamplerCascade::process(
+    std::span< float32 const > const input,
+    std::span< float32 > const       output
+) -> utils::Result< void >
+{
+    LTB_CHECK_VALID( !stages_.empty( ) );
+    auto const channels = stages_.front( ).params( ).channel_count;
+    LTB_CHECK_VALID(
+        std::ranges::all_of(
+            stages_,
+            [ channels ]( Resampler const& stage )
+            { return stage.params( ).channel_count == channels; }
+        ),
+        "Every stage must have the same channels"
+    );
+    LTB_CHECK_VALID( 0_UZ == ( input.size( ) % channels ), "Every sample needs every channel" );
+    LTB_CHECK_VALID( output.size( ) == ( output_count( input.size( ) / channels ) * channels ) );
+
+    auto stage_input = input;
+    for ( auto s = 0_UZ; s + 1_UZ < stages_.size( ); ++s )
+    {
+        auto& between = between_[ s ];
+        between.resize( stages_[ s ].output_count( stage_input.size( ) / channels ) * channels );
+        LTB_CHECK( stages_[ s ].process( stage_input, between ) );
+        stage_input = between;
+    }
+    return stages_.back( ).process( stage_input, output );
+}
+
+auto ResamplerCascade::process( std::span< Iq const > const input, std::span< Iq > const output )
+    -> utils::Result< void >
+{
+    LTB_CHECK_VALID( !stages_.empty( ) );
+    LTB_CHECK_VALID( output.size( ) == output_count( input.size( ) ) );
+
+    auto stage_input = input;
+    for ( auto s = 0_UZ; s + 1_UZ < stages_.size( ); ++s )
+    {
+        auto& between = between_iq_[ s ];
+        between.resize( stages_[ s ].output_count( stage_input.size( ) ) );
+        LTB_CHECK( stages_[ s ].process( stage_input, between ) );
+        stage_input = between;
+    }
+    return stages_.back( ).process( stage_input, output );
+}
+
+auto decimation_stages(
+    std::size_t const factor,
+    float64 const     passband,
+    std::size_t const channel_count
+) -> std::vector< ResamplerParams >
+{
+    auto factors   = std::vector< std::size_t >{ };
+    auto remaining = factor;
+    while ( remaining > 1_UZ )
+    {
+        auto stage = std::min( remaining, max_stage_factor );
+        while ( ( stage > 1_UZ ) && ( 0_UZ != ( remaining % stage ) ) )
+        {
+            --stage;
+        }
+
+        // Take the smallest prime factor when none fits in a stage.
+        if ( 1_UZ == stage )
+        {
+            stage = remaining;
+            for ( auto divisor = max_stage_factor + 1_UZ; divisor * divisor <= remaining;
+                  ++divisor )
+            {
+                if ( 0_UZ == ( remaining % divisor ) )
+                {
+                    stage = divisor;
+                    break;
+                }
+            }
+        }
+        factors.push_back( stage );
+        remaining /= stage;
+    }
+    std::ranges::sort( factors, std::greater{ } );
+
+    // The final passband in units of each stage's own output Nyquist frequency.
+    auto stages = std::vector< ResamplerParams >{ };
+    auto after  = factor;
+    for ( auto const stage : factors )
+    {
+        after /= stage;
+        auto const kept = passband / static_cast< float64 >( after );
+        stages.push_back( {
+            .interpolation = 1,
+            .decimation    = stage,
+            .passband      = kept,
+            .stopband      = 2.0 - kept,
+            .channel_count = channel_count,
+        } );
+    }
+    return stages;
+}
+
+auto measure_decimation_throughput(
+    std::span< std::size_t const > const factors,
+    float64 const                        seconds_per_factor
+) -> utils::Result< std::vector< ResamplerThroughput > >
+{
+    LTB_CHECK_VALID( std::ranges::all_of( factors, []( auto const f ) { return f > 1_UZ; } ) );
+
+    using Clock = std::chrono::steady_clock;
+
+    auto input = std::vector< float32 >( benchmark_block_size );
+    for ( auto n = 0_UZ; n < input.size( ); ++n )
+    {
+        input[ n ] = std::sin( 0.01F * static_cast< float32 >( n ) );
+    }
+
+    auto results = std::vector< ResamplerThroughput >{ };
+    for ( auto const factor : factors )
+    {
+        auto cascade = ResamplerCascade{ decimation_stages( factor ) };
+        auto output  = std::vector< float32 >{ };
+
+        auto       count   = 0_UZ;
+        auto const start   = Clock::now( );
+        auto       elapsed = 0.0;
+        do
+        {
+            output.resize( cascade.output_count( input.size( ) ) );
+            LTB_CHECK( cascade.process( input, output ) );
+            count += input.size( );
+            elapsed = std::chrono::duration< float64 >( Clock::now( ) - start ).count( );
+        } while ( elapsed < seconds_per_factor );
+
+        auto tap_count = 0_UZ;
+        for ( auto const& stage : cascade.stages( ) )
+        {
+            tap_count += stage.tap_count( );
+        }
+
+        results.push_back( {
+            .decimation         = factor,
+            .stage_count        = cascade.stages( ).size( ),
+            .tap_count          = tap_count,
+            .mega_samples_per_s = static_cast< float64 >( count ) * 1.0e-6 / elapsed,
+        } );
+    }
+    return results;
+}
+
+} // namespace ltb::dsp
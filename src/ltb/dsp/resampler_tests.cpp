@@ -0,0 +1,199 @@
+// project
+#include "ltb/dsp/resampler.hpp"
+#include "ltb/dsp/tone_bank.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+#include <gtest/gtest.h>
+
+// standard
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+/// \brief `Σ cos(2π f t)` over \p tones_hz, time-major for every channel.
+auto tones(
+    std::vector< float64 > const& tones_hz,
+    float64 const                 sample_rate_hz,
+    std::size_t const             sample_count,
+    std::size_t const             channel_count = 1
+) -> std::vector< float32 >
+{
+    auto samples = std::vector< float32 >( sample_count * channel_count );
+    for ( auto n = 0_UZ; n < sample_count; ++n )
+    {
+        auto value = 0.0;
+        for ( auto const tone_hz : tones_hz )
+        {
+            value += std::cos(
+                glm::two_pi< float64 >( ) * tone_hz * static_cast< float64 >( n ) / sample_rate_hz
+            );
+        }
+        for ( auto c = 0_UZ; c < channel_count; ++c )
+        {
+            // Each channel at its own level, to tell them apart.
+            samples[ utils::array_index( c, n, channel_count ) ]
+                = static_cast< float32 >( value / static_cast< float64 >( c + 1_UZ ) );
+        }
+    }
+    return samples;
+}
+
+TEST( ResamplerTests, DecimatesWithoutAliasing )
+{
+    // 10 kHz would alias to 480 Hz at 4.8 kHz.
+    auto const input = tones( { 960.0, 10'080.0 }, 48'000.0, 48'000 );
+
+    auto resampler = dsp::Resampler{ { .decimation = 10 } };
+    EXPECT_EQ( resampler.output_count( input.size( ) ), 4'800_UZ );
+
+    auto output = std::vector< float32 >( 4'800 );
+    ASSERT_TRUE( resampler.process( input, output ) );
+
+    auto bank = dsp::ToneBank{ { .sample_rate_hz = 4'800.0, .tones_hz = { 960.0, 480.0 } } };
+    ASSERT_TRUE( bank.process( output ) );
+    EXPECT_NEAR( glm::length( bank.value( 0, 0 ) ), 1.0, 1.0e-3 );
+    EXPECT_LT( glm::length( bank.value( 1, 0 ) ), 1.0e-4 );
+}
+
+TEST( ResamplerTests, RationalFactorsKeepEveryChannel )
+{
+    // CD audio rate to the receivers' rate.
+    constexpr auto channels = 3_UZ;
+    auto const     input    = tones( { 990.0 }, 44'100.0, 44'100, channels );
+
+    auto const params = dsp::ResamplerParams{
+        .interpolation = 160,
+        .decimation    = 147,
+        .channel_count = channels,
+    };
+
+    auto whole = dsp::Resampler{ params };
+    EXPECT_EQ( whole.output_count( 44'100 ), 48'000_UZ );
+    auto expected = std::vector< float32 >( 48'000 * channels );
+    ASSERT_TRUE( whole.process( input, expected ) );
+
+    // Uneven blocks give exactly the same samples.
+    auto blocks   = dsp::Resampler{ params };
+    auto output   = std::vector< float32 >{ };
+    auto consumed = 0_UZ;
+    for ( auto const count : { 1_UZ, 146_UZ, 147_UZ, 10'000_UZ, 33'806_UZ } )
+    {
+        auto block = std::vector< float32 >( blocks.output_count( count ) * channels );
+        ASSERT_TRUE( blocks.process(
+            std::span( input ).subspan( consumed * channels, count * channels ),
+            block
+        ) );
+        output.insert( output.end( ), block.begin( ), block.end( ) );
+        consumed += count;
+    }
+    EXPECT_EQ( output, expected );
+
+    auto bank = dsp::ToneBank{ { .tones_hz = { 990.0 }, .channel_count = channels } };
+    ASSERT_TRUE( bank.process( expected ) );
+    for ( auto c = 0_UZ; c < channels; ++c )
+    {
+        EXPECT_NEAR(
+            glm::length( bank.value( 0, c ) ),
+            1.0 / static_cast< float64 >( c + 1_UZ ),
+            1.0e-3
+        ) << c;
+    }
+}
+
+TEST( ResamplerTests, CascadesLargeFactors )
+{
+    auto factors = []( std::size_t const factor )
+    {
+        auto result = std::vector< std::size_t >{ };
+        for ( auto const& stage : dsp::decimation_stages( factor ) )
+        {
+            result.push_back( stage.decimation );
+        }
+        return result;
+    };
+    EXPECT_EQ( factors( 1'000 ), ( std::vector< std::size_t >{ 10, 10, 10 } ) );
+    EXPECT_EQ( factors( 480 ), ( std::vector< std::size_t >{ 10, 8, 6 } ) );
+    EXPECT_EQ( factors( 22 ), ( std::vector< std::size_t >{ 11, 2 } ) );
+    EXPECT_EQ( factors( 1 ), ( std::vector< std::size_t >{ } ) );
+
+    // Complex baseband at 480 kHz down to 4.8 kHz: a tone 600 Hz below the center survives
+    // and one 50 kHz above is gone.
+    constexpr auto sample_rate_hz = 480'000.0;
+    auto           input          = std::vector< dsp::Iq >( 96'000 );
+    for ( auto n = 0_UZ; n < input.size( ); ++n )
+    {
+        auto const time_s = static_cast< float64 >( n ) / sample_rate_hz;
+        auto const wanted = -glm::two_pi< float64 >( ) * 600.0 * time_s;
+        auto const strong = glm::two_pi< float64 >( ) * 50'000.0 * time_s;
+        input[ n ]        = dsp::Iq( glm::dvec2(
+            std::cos( wanted ) + ( 10.0 * std::cos( strong ) ),
+            std::sin( wanted ) + ( 10.0 * std::sin( strong ) )
+        ) );
+    }
+
+    auto cascade = dsp::ResamplerCascade{ dsp::decimation_stages( 100, 0.8, 2 ) };
+    ASSERT_EQ( cascade.stages( ).size( ), 2_UZ );
+
+    auto output = std::vector< dsp::Iq >( cascade.output_count( input.size( ) ) );
+    ASSERT_EQ( output.size( ), 960_UZ );
+    ASSERT_TRUE( cascade.process( input, output ) );
+
+    // The last window of output: the tone is all that's left.
+    for ( auto n = output.size( ) - 160_UZ; n < output.size( ); ++n )
+    {
+        EXPECT_NEAR( glm::length( output[ n ] ), 1.0F, 1.0e-3F ) << n;
+    }
+}
+
+TEST( ResamplerTests, RejectsInvalidInput )
+{
+    auto input  = std::vector< float32 >( 100 );
+    auto output = std::vector< float32 >( 10 );
+    EXPECT_TRUE( dsp::Resampler{ { .decimation = 10 } }.process( input, output ) );
+    EXPECT_FALSE(
+        dsp::Resampler{ { .decimation = 10 } }.process( input, std::span( output ).first( 9 ) )
+    );
+    EXPECT_FALSE( dsp::Resampler{ { .decimation = 0 } }.process( input, output ) );
+
+    auto empty_band = dsp::Resampler{ { .passband = 1.2, .stopband = 1.2 } };
+    EXPECT_FALSE( empty_band.process( input, output ) );
+
+    auto three = dsp::Resampler{ { .decimation = 1, .channel_count = 3 } };
+    EXPECT_FALSE( three.process( input, std::span( input ).first( 99 ) ) );
+
+    auto iq = std::vector< dsp::Iq >( 100 );
+    EXPECT_FALSE( dsp::Resampler{ { } }.process( iq, std::span( iq ).first( 10 ) ) );
+
+    EXPECT_FALSE( dsp::ResamplerCascade{ { } }.process( input, output ) );
+    auto mismatched = dsp::ResamplerCascade{ {
+        { .decimation = 2, .channel_count = 1 },
+        { .decimation = 5, .channel_count = 2 },
+    } };
+    EXPECT_FALSE( mismatched.process( input, output ) );
+
+    EXPECT_FALSE( dsp::measure_decimation_throughput( std::array{ 1_UZ }, 0.0 ) );
+}
+
+TEST( ResamplerTests, MeasuresEveryFactor )
+{
+    auto const factors    = std::array{ 10_UZ, 100_UZ, 1'000_UZ };
+    auto const throughput = dsp::measure_decimation_throughput( factors, 0.0 );
+    ASSERT_TRUE( throughput );
+    ASSERT_EQ( throughput->size( ), factors.size( ) );
+    for ( auto i = 0_UZ; i < factors.size( ); ++i )
+    {
+        EXPECT_EQ( ( *throughput )[ i ].decimation, factors[ i ] );
+        EXPECT_EQ( ( *throughput )[ i ].stage_count, i + 1_UZ );
+        EXPECT_GT( ( *throughput )[ i ].mega_samples_per_s, 0.0 );
+    }
+}
+
+} // namespace
+} // namespace ltb
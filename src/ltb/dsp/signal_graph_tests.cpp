@@ -0,0 +1,103 @@
+// project
+#include "ltb/dsp/signal_graph.hpp"
+
+// external
+#include <gtest/gtest.h>
+
+// standard
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+TEST( SignalGraphTests, FusedGraphMatchesSeparateStages )
+{
+    // Not a whole number of blocks.
+    constexpr auto count = 50'001_UZ;
+    auto const     clock = dsp::SampleClock{ .start = 3.25, .step = 1.0 / 48'000.0 };
+
+    auto const carrier   = dsp::Tone{ 1'020.0 };
+    auto const message   = dsp::Tone{ 30.0, 0.5 };
+    auto const composite = dsp::amplitude_modulate( carrier, message, 0.3 ) + 0.25;
+
+    static_assert( decltype( composite )::stateless );
+
+    auto fused = std::vector< float64 >( count );
+    dsp::render( composite, clock, fused );
+
+    auto max_error = 0.0;
+    for ( auto i = 0_UZ; i < count; ++i )
+    {
+        auto const t = clock.start + ( static_cast< float64 >( i ) * clock.step );
+        auto const c = std::sin( glm::two_pi< float64 >( ) * 1'020.0 * t );
+        auto const m = std::sin( ( glm::two_pi< float64 >( ) * 30.0 * t ) + 0.5 );
+
+        auto const expected = ( c * ( 0.7 + ( 0.3 * m ) ) ) + 0.25;
+        max_error           = std::max( max_error, std::abs( fused[ i ] - expected ) );
+    }
+    EXPECT_LT( max_error, 1.0e-9 );
+}
+
+TEST( SignalGraphTests, StatefulGraphsRunInOrder )
+{
+    constexpr auto count = 10'000_UZ;
+    auto const     clock = dsp::SampleClock{ .start = 0.0, .step = 1.0e-3 };
+
+    // A step into a 10 Hz low-pass rises as 1 - e^(-t / τ), with the first sample
+    // already one step in.
+    auto const filtered = dsp::low_pass( dsp::Constant{ 1.0 }, 10.0 );
+    static_assert( !decltype( filtered )::stateless );
+
+    auto values = std::vector< float64 >( count );
+    dsp::render( filtered, clock, values );
+
+    auto const time_constant_s = 1.0 / ( glm::two_pi< float64 >( ) * 10.0 );
+    for ( auto const i : { 0_UZ, 15_UZ, 100_UZ } )
+    {
+        auto const t = static_cast< float64 >( i + 1_UZ ) * clock.step;
+        EXPECT_NEAR( values[ i ], 1.0 - std::exp( -t / time_constant_s ), 1.0e-12 );
+    }
+    EXPECT_NEAR( values.back( ), 1.0, 1.0e-9 );
+
+    // A constant message shifts the FM tone to a new frequency.
+    auto shifted = std::vector< float64 >( count );
+    dsp::render( dsp::frequency_modulate( 50.0, 20.0, dsp::Constant{ 1.0 } ), clock, shifted );
+
+    auto expected = std::vector< float64 >( count );
+    dsp::render( dsp::Tone{ 70.0 }, clock, expected );
+
+    for ( auto i = 0_UZ; i < count; ++i )
+    {
+        ASSERT_NEAR( shifted[ i ], expected[ i ], 1.0e-6 ) << i;
+    }
+}
+
+TEST( SignalGraphTests, SinkSeesEveryNodeOnce )
+{
+    constexpr auto count = 4'097_UZ;
+    auto const     clock = dsp::SampleClock{ .start = 0.0, .step = 1.0 };
+
+    auto first  = std::vector< float64 >( count, -1.0 );
+    auto second = std::vector< float64 >( count, -1.0 );
+    dsp::for_each_sample(
+        clock,
+        count,
+        [ & ]( std::size_t const i, float64 const a, float64 const b )
+        {
+            first[ i ]  = a;
+            second[ i ] = b;
+        },
+        dsp::Constant{ 2.0 },
+        dsp::Constant{ 3.0 } * dsp::Constant{ 4.0 }
+    );
+
+    EXPECT_EQ( first, std::vector< float64 >( count, 2.0 ) );
+    EXPECT_EQ( second, std::vector< float64 >( count, 12.0 ) );
+}
+
+} // namespace
+} // namespace ltb
@@ -0,0 +1,208 @@
+#include "ltb/dsp/tone_bank.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <algorithm>
+#include <cmath>
+
+namespace ltb::dsp
+{
+namespace
+{
+
+auto whole_multiple( float64 const value, float64 const of ) -> bool
+{
+    return std::fmod( value, of ) == 0.0;
+}
+
+auto valid( ToneBankParams const& params ) -> bool
+{
+    return ( params.sample_rate_hz > 0.0 ) && ( params.window_hz > 0.0 )
+        && ( params.channel_count > 0_UZ ) && !params.tones_hz.empty( )
+        && whole_multiple( params.sample_rate_hz, params.window_hz )
+        && std::ranges::all_of(
+               params.tones_hz,
+               [ &params ]( float64 const tone_hz )
+               { return ( tone_hz >= 0.0 ) && whole_multiple( tone_hz, params.window_hz ); }
+        );
+}
+
+} // namespace
+
+ToneBank::ToneBank( ToneBankParams params )
+    : params_( std::move( params ) )
+{
+    if ( !valid( params_ ) )
+    {
+        return;
+    }
+
+    window_size_ = static_cast< std::size_t >( params_.sample_rate_hz / params_.window_hz );
+
+    auto const tones    = params_.tones_hz.size( );
+    auto const channels = params_.channel_count;
+
+    history_.resize( window_size_ * channels, 0.0F );
+    sums_re_.resize( tones * channels, 0.0 );
+    sums_im_.resize( tones * channels, 0.0 );
+
+    phasor_re_.resize( tones * window_size_ );
+    phasor_im_.resize( tones * window_size_ );
+    scales_.resize( tones );
+
+    for ( auto t = 0_UZ; t < tones; ++t )
+    {
+        auto const tone_hz = params_.tones_hz[ t ];
+        for ( auto k = 0_UZ; k < window_size_; ++k )
+        {
+            auto const time_s
+                = params_.start_time_s + ( static_cast< float64 >( k ) / params_.sample_rate_hz );
+            auto const angle = glm::two_pi< float64 >( ) * std::fmod( tone_hz * time_s, 1.0 );
+
+            phasor_re_[ utils::array_index( k, t, window_size_ ) ] = std::cos( angle );
+            phasor_im_[ utils::array_index( k, t, window_size_ ) ] = -std::sin( angle );
+        }
+
+        // A tone A cos(ωt + φ) sums to (N A / 2) e^(jφ); a constant A sums to N A.
+        auto const samples = static_cast< float64 >( window_size_ );
+        scales_[ t ]       = ( 0.0 == tone_hz ) ? ( 1.0 / samples ) : ( 2.0 / samples );
+    }
+}
+
+auto ToneBank::params( ) const -> ToneBankParams const&
+{
+    return params_;
+}
+
+auto ToneBank::window_size( ) const -> std::size_t
+{
+    return window_size_;
+}
+
+auto ToneBank::sample_count( ) const -> std::size_t
+{
+    return sample_count_;
+}
+
+auto ToneBank::process( std::span< float32 const > const samples ) -> utils::Result< void >
+{
+    LTB_CHECK_VALID(
+        valid( params_ ),
+        "The sample rate and every tone must be whole multiples of the window frequency"
+    );
+    auto const channels = params_.channel_count;
+    LTB_CHECK_VALID(
+        0_UZ == ( samples.size( ) % channels ),
+        "Every sample must hold a value for each channel"
+    );
+
+    for ( auto start = 0_UZ; start < samples.size( ); start += channels )
+    {
+        push( samples.subspan( start, channels ) );
+    }
+    return utils::success( );
+}
+
+auto ToneBank::push( std::span< float32 const > const frame ) -> void
+{
+    auto const channels = params_.channel_count;
+    auto const row      = sample_count_ % window_size_;
+
+    auto* const history = history_.data( ) + ( row * channels );
+
+    for ( auto t = 0_UZ; t < params_.tones_hz.size( ); ++t )
+    {
+        auto const phasor_re = phasor_re_[ utils::array_index( row, t, window_size_ ) ];
+        auto const phasor_im = phasor_im_[ utils::array_index( row, t, window_size_ ) ];
+
+        auto* const sums_re = sums_re_.data( ) + ( t * channels );
+        auto* const sums_im = sums_im_.data( ) + ( t * channels );
+
+        // The sample leaving the window had the same phasor as the one replacing it.
+        for ( auto c = 0_UZ; c < channels; ++c )
+        {
+            auto const change
+                = static_cast< float64 >( frame[ c ] ) - static_cast< float64 >( history[ c ] );
+            sums_re[ c ] += change * phasor_re;
+            sums_im[ c ] += change * phasor_im;
+        }
+    }
+    std::ranges::copy( frame, history );
+
+    if ( 0_UZ == ( ++sample_count_ % window_size_ ) )
+    {
+        resum( );
+    }
+}
+
+auto ToneBank::value( std::size_t const tone, std::size_t const channel ) const -> glm::dvec2
+{
+    auto const index = utils::array_index( channel, tone, params_.channel_count );
+    return glm::dvec2( sums_re_[ index ], sums_im_[ index ] ) * scales_[ tone ];
+}
+
+auto ToneBank::amplitudes( std::size_t const tone, std::span< float32 > const values ) const
+    -> utils::Result< void >
+{
+    LTB_CHECK( check_tone( tone, values ) );
+    for ( auto c = 0_UZ; c < values.size( ); ++c )
+    {
+        values[ c ] = static_cast< float32 >( glm::length( value( tone, c ) ) );
+    }
+    return utils::success( );
+}
+
+auto ToneBank::phases( std::size_t const tone, std::span< float32 > const values ) const
+    -> utils::Result< void >
+{
+    LTB_CHECK( check_tone( tone, values ) );
+    for ( auto c = 0_UZ; c < values.size( ); ++c )
+    {
+        auto const sum = value( tone, c );
+        values[ c ]    = static_cast< float32 >( std::atan2( sum.y, sum.x ) );
+    }
+    return utils::success( );
+}
+
+auto ToneBank::check_tone( std::size_t const tone, std::span< float32 > const values ) const
+    -> utils::Result< void >
+{
+    LTB_CHECK_VALID( valid( params_ ) );
+    LTB_CHECK_VALID( tone < params_.tones_hz.size( ), "Tone index out of range" );
+    LTB_CHECK_VALID( values.size( ) == params_.channel_count, "One value per channel" );
+    return utils::success( );
+}
+
+auto ToneBank::resum( ) -> void
+{
+    auto const channels = params_.channel_count;
+
+    std::ranges::fill( sums_re_, 0.0 );
+    std::ranges::fill( sums_im_, 0.0 );
+
+    for ( auto t = 0_UZ; t < params_.tones_hz.size( ); ++t )
+    {
+        auto* const sums_re = sums_re_.data( ) + ( t * channels );
+        auto* const sums_im = sums_im_.data( ) + ( t * channels );
+
+        for ( auto k = 0_UZ; k < window_size_; ++k )
+        {
+            auto const  phasor_re = phasor_re_[ utils::array_index( k, t, window_size_ ) ];
+            auto const  phasor_im = phasor_im_[ utils::array_index( k, t, window_size_ ) ];
+            auto const* history   = history_.data( ) + ( k * channels );
+
+            for ( auto c = 0_UZ; c < channels; ++c )
+            {
+                sums_re[ c ] += static_cast< float64 >( history[ c ] ) * phasor_re;
+                sums_im[ c ] += static_cast< float64 >( history[ c ] ) * phasor_im;
+            }
+        }
+    }
+}
+
+} // namespace ltb::dsp
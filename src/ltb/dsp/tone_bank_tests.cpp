@@ -0,0 +1,157 @@
+// project
+#include "ltb/dsp/tone_bank.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+#include <gtest/gtest.h>
+
+// standard
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+constexpr auto sample_rate_hz = 48'000.0;
+
+struct Component
+{
+    float64 frequency_hz = 0.0;
+    float64 amplitude    = 0.0;
+    float64 phase_rad    = 0.0;
+};
+
+/// \brief Time-major samples of every channel, each the sum of its components.
+auto synthesize(
+    std::vector< std::vector< Component > > const& channels,
+    std::size_t const                              first_sample,
+    std::size_t const                              sample_count
+) -> std::vector< float32 >
+{
+    auto samples = std::vector< float32 >( sample_count * channels.size( ) );
+    for ( auto n = 0_UZ; n < sample_count; ++n )
+    {
+        auto const time_s = static_cast< float64 >( first_sample + n ) / sample_rate_hz;
+        for ( auto c = 0_UZ; c < channels.size( ); ++c )
+        {
+            auto value = 0.0;
+            for ( auto const& component : channels[ c ] )
+            {
+                auto const angle = ( glm::two_pi< float64 >( ) * component.frequency_hz * time_s )
+                                 + component.phase_rad;
+                value += component.amplitude * std::cos( angle );
+            }
+            auto const index = utils::array_index( c, n, channels.size( ) );
+            samples[ index ] = static_cast< float32 >( value );
+        }
+    }
+    return samples;
+}
+
+TEST( ToneBankTests, TracksEveryToneInEveryChannel )
+{
+    // A mean plus the four default tones, at different levels and phases per channel.
+    auto const channels = std::vector< std::vector< Component > >{
+        { { 0.0, 1.0, 0.0 }, { 30.0, 0.3, 0.5 }, { 9'960.0, 0.3, -2.0 } },
+        { { 0.0, 0.8, 0.0 }, { 90.0, 0.2, 1.0 }, { 150.0, 0.1, 3.0 } },
+        { { 0.0, 1.2, 0.0 }, { 30.0, 0.05, -1.5 }, { 90.0, 0.4, 0.0 }, { 150.0, 0.4, -3.0 } },
+    };
+
+    auto bank = dsp::ToneBank{ { .channel_count = channels.size( ) } };
+    EXPECT_EQ( bank.window_size( ), 1'600_UZ );
+
+    // Uneven blocks, ending part way through the third window.
+    auto processed = 0_UZ;
+    for ( auto const count : { 1_UZ, 999_UZ, 2'000_UZ, 555_UZ } )
+    {
+        ASSERT_TRUE( bank.process( synthesize( channels, processed, count ) ) );
+        processed += count;
+    }
+    EXPECT_EQ( bank.sample_count( ), processed );
+
+    auto const& tones_hz   = bank.params( ).tones_hz;
+    auto        amplitudes = std::vector< float32 >( channels.size( ) );
+    auto        phases     = std::vector< float32 >( channels.size( ) );
+
+    for ( auto t = 0_UZ; t < tones_hz.size( ); ++t )
+    {
+        ASSERT_TRUE( bank.amplitudes( t, amplitudes ) );
+        ASSERT_TRUE( bank.phases( t, phases ) );
+
+        for ( auto c = 0_UZ; c < channels.size( ); ++c )
+        {
+            auto expected = Component{ };
+            for ( auto const& component : channels[ c ] )
+            {
+                if ( component.frequency_hz == tones_hz[ t ] )
+                {
+                    expected = component;
+                }
+            }
+
+            EXPECT_NEAR( amplitudes[ c ], expected.amplitude, 1.0e-5 ) << t << ", " << c;
+            if ( expected.amplitude > 0.0 )
+            {
+                EXPECT_NEAR(
+                    std::remainder( phases[ c ] - expected.phase_rad, glm::two_pi< float64 >( ) ),
+                    0.0,
+                    1.0e-4
+                ) << t << ", " << c;
+            }
+        }
+    }
+
+    // The mean of the first channel, as a 0 Hz tone.
+    auto mean_bank = dsp::ToneBank{ { .tones_hz = { 0.0 } } };
+    auto first     = std::vector< std::vector< Component > >{ channels.front( ) };
+    ASSERT_TRUE( mean_bank.process( synthesize( first, 0, 2'000 ) ) );
+    EXPECT_NEAR( mean_bank.value( 0, 0 ).x, 1.0, 1.0e-6 );
+}
+
+TEST( ToneBankTests, SlidesWithTheSignal )
+{
+    // The tone steps up part way through; each output covers only the latest window.
+    auto const before = std::vector< std::vector< Component > >{ { { 150.0, 0.1, 0.0 } } };
+    auto const after  = std::vector< std::vector< Component > >{ { { 150.0, 0.5, 0.0 } } };
+
+    auto bank = dsp::ToneBank{ { .tones_hz = { 150.0 } } };
+    ASSERT_TRUE( bank.process( synthesize( before, 0, 3'000 ) ) );
+    EXPECT_NEAR( glm::length( bank.value( 0, 0 ) ), 0.1, 1.0e-6 );
+
+    // One of the window's five cycles replaced.
+    ASSERT_TRUE( bank.process( synthesize( after, 3'000, 320 ) ) );
+    EXPECT_NEAR( glm::length( bank.value( 0, 0 ) ), 0.18, 1.0e-6 );
+
+    ASSERT_TRUE( bank.process( synthesize( after, 3'320, 1'280 ) ) );
+    EXPECT_NEAR( glm::length( bank.value( 0, 0 ) ), 0.5, 1.0e-6 );
+}
+
+TEST( ToneBankTests, RejectsInvalidInput )
+{
+    auto samples = std::vector< float32 >( 10 );
+    auto values  = std::vector< float32 >( 3 );
+
+    // 100 Hz doesn't complete whole cycles in a 30 Hz window.
+    auto partial_cycles = dsp::ToneBank{ { .tones_hz = { 100.0 } } };
+    EXPECT_FALSE( partial_cycles.process( samples ) );
+    EXPECT_FALSE( partial_cycles.amplitudes( 0, std::span( values ).first( 1 ) ) );
+
+    auto rate = dsp::ToneBank{ {
+        .sample_rate_hz = 44'100.0,
+        .window_hz      = 40.0,
+        .tones_hz       = { 40.0 },
+    } };
+    EXPECT_FALSE( rate.process( samples ) );
+
+    auto bank = dsp::ToneBank{ { .channel_count = 3 } };
+    EXPECT_FALSE( bank.process( samples ) );
+    EXPECT_TRUE( bank.process( std::span( samples ).first( 9 ) ) );
+    EXPECT_FALSE( bank.phases( 4, values ) );
+    EXPECT_FALSE( bank.amplitudes( 0, std::span( values ).first( 2 ) ) );
+}
+
+} // namespace
+} // namespace ltb
@@ -1,10 +1,223 @@
 #include "ltb/gui/dsp.hpp"
 
+// project
+#include "ltb/utils/error_callback.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <implot.h>
+
+// standard
+#include <array>
+#include <utility>
+
 namespace ltb::gui
 {
+namespace
+{
+
+constexpr auto benchmark_log2_range   = std::array{ 10_UZ, 22_UZ };
+constexpr auto benchmark_seconds_each = 0.05;
+
+constexpr auto benchmark_decimations = std::array{ 10_UZ, 50_UZ, 100_UZ, 500_UZ, 1'000_UZ };
+
+constexpr auto benchmark_channel_counts = std::array{ 1_UZ, 16_UZ, 256_UZ, 4'096_UZ };
+constexpr auto benchmark_block_size     = 256_UZ;
+
+constexpr auto benchmark_noise_block_size = 4'096_UZ;
+
+} // namespace
 
 auto configure_lines( ) -> void {}
 
 auto configure_histogram( ) -> void {}
 
+auto plot_spectrum(
+    char const* const                label,
+    std::span< float32 const > const db,
+    float64 const                    first_hz,
+    float64 const                    bin_hz
+) -> void
+{
+    ImPlot::PlotLine( label, db.data( ), static_cast< int32 >( db.size( ) ), bin_hz, first_hz );
+}
+
+auto configure_fft_benchmark( std::vector< dsp::FftThroughput >& throughput ) -> void
+{
+    if ( ImGui::Button( "Measure FFT throughput" ) )
+    {
+        if ( auto result = dsp::measure_fft_throughput(
+                 benchmark_log2_range.front( ),
+                 benchmark_log2_range.back( ),
+                 benchmark_seconds_each
+             ) )
+        {
+            throughput = std::move( *result );
+        }
+        else
+        {
+            utils::log_error( result.error( ) );
+        }
+    }
+
+    if ( throughput.empty( ) )
+    {
+        return;
+    }
+
+    if ( ImGui::BeginTable( "##fft", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg ) )
+    {
+        ImGui::TableSetupColumn( "Points" );
+        ImGui::TableSetupColumn( "Transforms/s" );
+        ImGui::TableSetupColumn( "M samples/s" );
+        ImGui::TableHeadersRow( );
+
+        for ( auto const& row : throughput )
+        {
+            ImGui::TableNextRow( );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%zu", row.size );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%.0f", row.transforms_per_s );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%.1f", row.mega_samples_per_s );
+        }
+        ImGui::EndTable( );
+    }
+}
+
+auto configure_decimation_benchmark( std::vector< dsp::ResamplerThroughput >& throughput )
+    -> void
+{
+    if ( ImGui::Button( "Measure decimation throughput" ) )
+    {
+        if ( auto result
+             = dsp::measure_decimation_throughput( benchmark_decimations, benchmark_seconds_each ) )
+        {
+            throughput = std::move( *result );
+        }
+        else
+        {
+            utils::log_error( result.error( ) );
+        }
+    }
+
+    if ( throughput.empty( ) )
+    {
+        return;
+    }
+
+    if ( ImGui::BeginTable( "##decimation", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg ) )
+    {
+        ImGui::TableSetupColumn( "Decimation" );
+        ImGui::TableSetupColumn( "Stages" );
+        ImGui::TableSetupColumn( "Taps" );
+        ImGui::TableSetupColumn( "M input samples/s" );
+        ImGui::TableHeadersRow( );
+
+        for ( auto const& row : throughput )
+        {
+            ImGui::TableNextRow( );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%zu", row.decimation );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%zu", row.stage_count );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%zu", row.tap_count );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%.1f", row.mega_samples_per_s );
+        }
+        ImGui::EndTable( );
+    }
+}
+
+auto configure_am_detector_benchmark( std::vector< dsp::AmDetectorThroughput >& throughput )
+    -> void
+{
+    if ( ImGui::Button( "Measure AM detector throughput" ) )
+    {
+        if ( auto result = dsp::measure_am_detector_throughput(
+                 benchmark_channel_counts,
+                 benchmark_block_size,
+                 benchmark_seconds_each
+             ) )
+        {
+            throughput = std::move( *result );
+        }
+        else
+        {
+            utils::log_error( result.error( ) );
+        }
+    }
+
+    if ( throughput.empty( ) )
+    {
+        return;
+    }
+
+    auto const detector = dsp::AmDetector{ { } };
+    ImGui::Text(
+        "Blocks of %zu samples. Real input is delayed %.1f us by smoothing.",
+        throughput.front( ).block_size,
+        detector.passband_delay_samples( ) * 1.0e6 / detector.params( ).sample_rate_hz
+    );
+
+    if ( ImGui::BeginTable( "##am_detector", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg ) )
+    {
+        ImGui::TableSetupColumn( "Channels" );
+        ImGui::TableSetupColumn( "Real us/block" );
+        ImGui::TableSetupColumn( "IQ us/block" );
+        ImGui::TableSetupColumn( "Real M samples/s" );
+        ImGui::TableSetupColumn( "IQ M samples/s" );
+        ImGui::TableHeadersRow( );
+
+        for ( auto const& row : throughput )
+        {
+            ImGui::TableNextRow( );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%zu", row.channel_count );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%.1f", row.passband_block_us );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%.1f", row.iq_block_us );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%.1f", row.passband_mega_samples_per_s );
+            ImGui::TableNextColumn( );
+            ImGui::Text( "%.1f", row.iq_mega_samples_per_s );
+        }
+        ImGui::EndTable( );
+    }
+}
+
+auto configure_noise_benchmark( std::optional< dsp::NoiseThroughput >& throughput ) -> void
+{
+    if ( ImGui::Button( "Measure noise throughput" ) )
+    {
+        if ( auto result = dsp::measure_noise_throughput(
+                 benchmark_noise_block_size,
+                 benchmark_seconds_each
+             ) )
+        {
+            throughput = *result;
+        }
+        else
+        {
+            utils::log_error( result.error( ) );
+        }
+    }
+
+    if ( !throughput.has_value( ) )
+    {
+        return;
+    }
+
+    ImGui::Text(
+        "Uniform: %.1f M samples/s, Gaussian: %.1f M samples/s, std::normal_distribution: "
+        "%.1f M samples/s",
+        throughput->uniform_mega_samples_per_s,
+        throughput->gaussian_mega_samples_per_s,
+        throughput->standard_mega_samples_per_s
+    );
+}
+
 } // namespace ltb::gui
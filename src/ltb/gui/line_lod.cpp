@@ -0,0 +1,156 @@
+#include "ltb/gui/line_lod.hpp"
+
+// standard
+#include <algorithm>
+#include <cmath>
+
+namespace ltb::gui
+{
+namespace
+{
+
+/// \brief Reduce every \p factor values of \p min and \p max into one bucket.
+template < typename T >
+auto reduce(
+    std::span< T const > const min,
+    std::span< T const > const max,
+    std::size_t const          factor,
+    std::vector< T >&          bucket_min,
+    std::vector< T >&          bucket_max
+) -> void
+{
+    auto const bucket_count = ( min.size( ) + factor - 1 ) / factor;
+    bucket_min.resize( bucket_count );
+    bucket_max.resize( bucket_count );
+
+    for ( auto b = 0_UZ; b < bucket_count; ++b )
+    {
+        auto const first = b * factor;
+        auto const last  = std::min( first + factor, min.size( ) );
+
+        auto low  = min[ first ];
+        auto high = max[ first ];
+        for ( auto i = first + 1_UZ; i < last; ++i )
+        {
+            low  = std::min( low, min[ i ] );
+            high = std::max( high, max[ i ] );
+        }
+        bucket_min[ b ] = low;
+        bucket_max[ b ] = high;
+    }
+}
+
+} // namespace
+
+template < typename T >
+auto LineLod< T >::set_values(
+    std::span< T const > const values,
+    float64 const              x_start,
+    float64 const              x_step
+) -> void
+{
+    values_.assign( values.begin( ), values.end( ) );
+    x_start_ = x_start;
+    x_step_  = x_step;
+
+    levels_.clear( );
+    auto min = std::span< T const >( values_ );
+    auto max = std::span< T const >( values_ );
+    while ( min.size( ) > 1_UZ )
+    {
+        auto& level = levels_.emplace_back( );
+        reduce( min, max, level_factor, level.min, level.max );
+        min = level.min;
+        max = level.max;
+    }
+}
+
+template < typename T >
+auto LineLod< T >::values( ) const -> std::vector< T > const&
+{
+    return values_;
+}
+
+template < typename T >
+auto LineLod< T >::x_range( ) const -> math::Range< float64 >
+{
+    auto const last = values_.empty( ) ? 0.0 : static_cast< float64 >( values_.size( ) - 1_UZ );
+    return { .min = x_start_, .max = x_start_ + ( last * x_step_ ) };
+}
+
+template < typename T >
+auto LineLod< T >::envelope( math::Range< float64 > const& x_limits, int32 const pixel_width ) const
+    -> LineEnvelope< T >
+{
+    auto output = LineEnvelope< T >{ };
+    if ( values_.empty( ) || ( pixel_width <= 0 ) || ( x_step_ <= 0.0 ) )
+    {
+        return output;
+    }
+
+    // Include one sample past each limit so the line reaches the edges of the plot.
+    auto const sample_count = static_cast< float64 >( values_.size( ) );
+    auto const to_index     = [ this, sample_count ]( float64 const x )
+    {
+        return static_cast< std::size_t >(
+            std::clamp( ( x - x_start_ ) / x_step_, 0.0, sample_count )
+        );
+    };
+    auto const first = to_index( x_limits.min - x_step_ );
+    auto const last  = std::min( to_index( x_limits.max + x_step_ ) + 1_UZ, values_.size( ) );
+    if ( first >= last )
+    {
+        return output;
+    }
+
+    auto const samples_per_pixel = ( last - first ) / static_cast< std::size_t >( pixel_width );
+
+    // The coarsest level whose buckets still fit in a pixel.
+    auto level       = 0_UZ;
+    auto bucket_size = 1_UZ;
+    while ( ( level < levels_.size( ) ) && ( bucket_size * level_factor <= samples_per_pixel ) )
+    {
+        bucket_size *= level_factor;
+        ++level;
+    }
+
+    if ( 1_UZ == bucket_size )
+    {
+        output.x.reserve( last - first );
+        output.y.reserve( last - first );
+        for ( auto i = first; i < last; ++i )
+        {
+            output.x.push_back( x_start_ + ( static_cast< float64 >( i ) * x_step_ ) );
+            output.y.push_back( values_[ i ] );
+        }
+        return output;
+    }
+
+    auto const& buckets      = levels_[ level - 1_UZ ];
+    auto const  bucket_count = buckets.min.size( );
+
+    // Buckets are drawn at their centers, so add one past each edge as well.
+    auto const first_bucket = std::max( first / bucket_size, 1_UZ ) - 1_UZ;
+    auto const last_bucket  = std::min( ( last / bucket_size ) + 2_UZ, bucket_count );
+
+    output.x.reserve( 2_UZ * ( last_bucket - first_bucket ) );
+    output.y.reserve( 2_UZ * ( last_bucket - first_bucket ) );
+    for ( auto b = first_bucket; b < last_bucket; ++b )
+    {
+        auto const bucket_first = b * bucket_size;
+        auto const bucket_last  = std::min( bucket_first + bucket_size, values_.size( ) );
+        auto const center       = static_cast< float64 >( bucket_first + bucket_last - 1_UZ ) * 0.5;
+        auto const x            = x_start_ + ( center * x_step_ );
+
+        output.x.push_back( x );
+        output.y.push_back( buckets.min[ b ] );
+        output.x.push_back( x );
+        output.y.push_back( buckets.max[ b ] );
+    }
+    return output;
+}
+
+template class LineLod< float32 >;
+template class LineLod< float64 >;
+
+} // namespace ltb::gui
@@ -0,0 +1,93 @@
+// project
+#include "ltb/gui/line_lod.hpp"
+
+// external
+#include <gtest/gtest.h>
+
+// standard
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+auto make_series( std::size_t const count ) -> std::vector< float32 >
+{
+    auto values = std::vector< float32 >( count );
+    for ( auto i = 0_UZ; i < count; ++i )
+    {
+        values[ i ] = std::sin( static_cast< float32 >( i ) * 0.001F );
+    }
+    return values;
+}
+
+TEST( LineLodTests, ZoomedInReturnsTheSamples )
+{
+    auto const values = make_series( 10'000 );
+    auto       lod    = gui::LineLod< float32 >{ };
+    lod.set_values( values, 5.0, 0.5 );
+
+    EXPECT_EQ( lod.x_range( ), ( math::Range< float64 >{ .min = 5.0, .max = 5.0 + 4'999.5 } ) );
+
+    // 200 samples across 1000 pixels, plus one either side.
+    auto const envelope = lod.envelope( { .min = 505.0, .max = 604.5 }, 1'000 );
+    ASSERT_EQ( envelope.y.size( ), 202_UZ );
+    EXPECT_EQ( envelope.x.front( ), 504.5 );
+    EXPECT_EQ( envelope.x.back( ), 605.0 );
+    for ( auto i = 0_UZ; i < envelope.y.size( ); ++i )
+    {
+        EXPECT_EQ( envelope.y[ i ], values[ 999_UZ + i ] );
+    }
+}
+
+TEST( LineLodTests, ZoomedOutKeepsEveryPeak )
+{
+    constexpr auto count  = 10'000'000_UZ;
+    auto           values = make_series( count );
+
+    // Single sample spikes that naive decimation would skip.
+    values[ 1'234'567 ] = 5.0F;
+    values[ 8'765'431 ] = -7.0F;
+
+    auto lod = gui::LineLod< float32 >{ };
+    lod.set_values( values );
+
+    auto const pixel_width = 1'920;
+    auto const envelope    = lod.envelope( lod.x_range( ), pixel_width );
+
+    // A few points per pixel at most, whatever the series length.
+    EXPECT_LE( envelope.y.size( ), 2_UZ * gui::LineLod< float32 >::level_factor * 1'920_UZ );
+    EXPECT_GE( envelope.y.size( ), 2_UZ * 1'920_UZ );
+    EXPECT_TRUE( std::ranges::is_sorted( envelope.x ) );
+    EXPECT_EQ( *std::ranges::max_element( envelope.y ), 5.0F );
+    EXPECT_EQ( *std::ranges::min_element( envelope.y ), -7.0F );
+
+    // A view that only contains the first spike.
+    auto const zoomed = lod.envelope( { .min = 1'000'000.0, .max = 2'000'000.0 }, pixel_width );
+    EXPECT_EQ( *std::ranges::max_element( zoomed.y ), 5.0F );
+    EXPECT_GT( *std::ranges::min_element( zoomed.y ), -7.0F );
+    EXPECT_LE( zoomed.x.front( ), 1'000'000.0 );
+    EXPECT_GE( zoomed.x.back( ), 2'000'000.0 );
+}
+
+TEST( LineLodTests, EmptyAndOutOfRangeViews )
+{
+    auto lod = gui::LineLod< float64 >{ };
+    EXPECT_TRUE( lod.envelope( { .min = 0.0, .max = 1.0 }, 100 ).x.empty( ) );
+
+    auto const values = std::vector< float64 >{ 1.0, 2.0, 3.0 };
+    lod.set_values( values );
+    EXPECT_TRUE( lod.envelope( { .min = 10.0, .max = 20.0 }, 100 ).x.empty( ) );
+    EXPECT_TRUE( lod.envelope( { .min = 0.0, .max = 2.0 }, 0 ).x.empty( ) );
+    // Plus the first sample past the limit.
+    EXPECT_EQ(
+        lod.envelope( { .min = -5.0, .max = 0.0 }, 100 ).y,
+        ( std::vector< float64 >{ 1.0, 2.0 } )
+    );
+}
+
+} // namespace
+} // namespace ltb
@@ -0,0 +1,162 @@
+#include "ltb/gui/plot_lines.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <implot.h>
+
+// standard
+#include <algorithm>
+#include <cmath>
+
+namespace ltb::gui
+{
+namespace
+{
+
+/// \brief The part of a ring buffer inside the plot limits.
+template < typename T >
+struct RingView
+{
+    utils::RingBuffer< T > const* samples = nullptr;
+    std::size_t                   first   = 0;
+    std::size_t                   count   = 0;
+
+    /// \brief Samples reduced to each min/max pair of points, or 1 to plot them as they are.
+    std::size_t bucket = 1;
+
+    float64 x_start = 0.0;
+    float64 x_step  = 1.0;
+};
+
+template < typename T >
+auto ring_point( int32 const index, void* const data ) -> ImPlotPoint
+{
+    auto const& view    = *static_cast< RingView< T > const* >( data );
+    auto const& samples = *view.samples;
+    auto const  i       = static_cast< std::size_t >( index );
+
+    if ( 1_UZ == view.bucket )
+    {
+        auto const sample = view.first + i;
+        return {
+            view.x_start + ( static_cast< float64 >( sample ) * view.x_step ),
+            static_cast< float64 >( samples[ sample ] ),
+        };
+    }
+
+    // Even points are the min of their bucket and odd points the max.
+    auto const begin = view.first + ( ( i / 2_UZ ) * view.bucket );
+    auto const end   = std::min( begin + view.bucket, view.first + view.count );
+
+    auto value = samples[ begin ];
+    for ( auto s = begin + 1_UZ; s < end; ++s )
+    {
+        value = ( 0_UZ == i % 2_UZ ) ? std::min( value, samples[ s ] )
+                                     : std::max( value, samples[ s ] );
+    }
+
+    auto const center = 0.5 * static_cast< float64 >( begin + end - 1_UZ );
+    return { view.x_start + ( center * view.x_step ), static_cast< float64 >( value ) };
+}
+
+} // namespace
+
+template < typename T >
+auto plot_line( char const* const label, LineLod< T > const& lod ) -> void
+{
+    auto const limits   = ImPlot::GetPlotLimits( );
+    auto const width    = static_cast< int32 >( ImPlot::GetPlotSize( ).x );
+    auto       envelope = lod.envelope( { .min = limits.X.Min, .max = limits.X.Max }, width );
+
+    ImPlot::PlotLineG(
+        label,
+        []( int32 const index, void* const data )
+        {
+            auto const& points = *static_cast< LineEnvelope< T > const* >( data );
+            auto const  i      = static_cast< std::size_t >( index );
+            return ImPlotPoint( points.x[ i ], static_cast< float64 >( points.y[ i ] ) );
+        },
+        &envelope,
+        static_cast< int32 >( envelope.x.size( ) )
+    );
+}
+
+template < typename T >
+auto plot_line(
+    char const* const             label,
+    utils::RingBuffer< T > const& samples,
+    float64 const                 x_start,
+    float64 const                 x_step
+) -> void
+{
+    auto const limits = ImPlot::GetPlotLimits( );
+    auto const width  = std::max( 1.0F, ImPlot::GetPlotSize( ).x );
+
+    // The samples inside the limits, plus one either side so the line reaches the edges.
+    auto const sample_at = [ & ]( float64 const x )
+    {
+        auto const index = std::clamp(
+            std::floor( ( x - x_start ) / x_step ),
+            0.0,
+            static_cast< float64 >( samples.size( ) )
+        );
+        return static_cast< std::size_t >( index );
+    };
+    auto const first = sample_at( limits.X.Min );
+    auto const last  = std::min( sample_at( limits.X.Max ) + 2_UZ, samples.size( ) );
+
+    auto view = RingView< T >{
+        .samples = &samples,
+        .first   = first,
+        .count   = last - first,
+        .bucket  = 1,
+        .x_start = x_start,
+        .x_step  = x_step,
+    };
+
+    auto const per_pixel
+        = static_cast< std::size_t >( static_cast< float32 >( view.count ) / width );
+
+    auto point_count = view.count;
+    if ( per_pixel >= LineLod< T >::level_factor )
+    {
+        view.bucket = per_pixel;
+        point_count = 2_UZ * ( ( view.count + per_pixel - 1_UZ ) / per_pixel );
+    }
+
+    ImPlot::PlotLineG( label, ring_point< T >, &view, static_cast< int32 >( point_count ) );
+}
+
+auto plot_lines(
+    char const* const         label,
+    LineLod< float32 > const& lod,
+    float32 const             scale_min,
+    float32 const             scale_max,
+    ImVec2 const              graph_size
+) -> void
+{
+    auto const width    = ( graph_size.x > 0.0F ) ? graph_size.x : ImGui::CalcItemWidth( );
+    auto const envelope = lod.envelope( lod.x_range( ), static_cast< int32 >( width ) );
+
+    ImGui::PlotLines(
+        label,
+        envelope.y.data( ),
+        static_cast< int32 >( envelope.y.size( ) ),
+        0,
+        nullptr,
+        scale_min,
+        scale_max,
+        graph_size
+    );
+}
+
+template auto plot_line( char const*, LineLod< float32 > const& ) -> void;
+template auto plot_line( char const*, LineLod< float64 > const& ) -> void;
+template auto
+plot_line( char const*, utils::RingBuffer< float32 > const&, float64, float64 ) -> void;
+template auto
+plot_line( char const*, utils::RingBuffer< float64 > const&, float64, float64 ) -> void;
+
+} // namespace ltb::gui
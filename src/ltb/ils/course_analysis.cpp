@@ -0,0 +1,238 @@
+#include "ltb/ils/course_analysis.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// standard
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <numeric>
+
+namespace ltb::ils
+{
+namespace
+{
+
+/// \brief The angle between samples \p index and `index + 1` where the DDM reaches \p value.
+auto crossing_angle(
+    std::span< float32 const > const angles_rad,
+    std::span< float32 const > const ddm,
+    std::size_t const                index,
+    float32 const                    value
+) -> float32
+{
+    auto const t = math::inv_lerp( ddm[ index ], ddm[ index + 1_UZ ], value );
+    return math::lerp( angles_rad[ index ], angles_rad[ index + 1_UZ ], t );
+}
+
+} // namespace
+
+auto Points::view( ) const -> PointsView
+{
+    return { .x_m = x_m, .y_m = y_m, .z_m = z_m };
+}
+
+auto linspace( math::Range< float32 > const& range, std::size_t const count )
+    -> std::vector< float32 >
+{
+    auto values = std::vector< float32 >( count, range.min );
+    if ( count > 1_UZ )
+    {
+        auto const last = static_cast< float32 >( count - 1_UZ );
+        for ( auto i = 0_UZ; i < count; ++i )
+        {
+            values[ i ] = math::lerp( range.min, range.max, static_cast< float32 >( i ) / last );
+        }
+    }
+    return values;
+}
+
+auto arc_points(
+    std::span< float32 const > const ranges_m,
+    std::span< float32 const > const angles_rad
+) -> Points
+{
+    auto points = Points{ };
+    points.x_m.reserve( ranges_m.size( ) * angles_rad.size( ) );
+    points.y_m.reserve( ranges_m.size( ) * angles_rad.size( ) );
+
+    for ( auto const range_m : ranges_m )
+    {
+        for ( auto const angle_rad : angles_rad )
+        {
+            points.x_m.push_back( range_m * std::cos( angle_rad ) );
+            points.y_m.push_back( range_m * std::sin( angle_rad ) );
+        }
+    }
+    return points;
+}
+
+auto radial_points(
+    std::span< float32 const > const angles_rad,
+    std::span< float32 const > const ranges_m
+) -> Points
+{
+    auto points = Points{ };
+    points.x_m.reserve( ranges_m.size( ) * angles_rad.size( ) );
+    points.y_m.reserve( ranges_m.size( ) * angles_rad.size( ) );
+
+    for ( auto const angle_rad : angles_rad )
+    {
+        auto const direction = glm::vec2( std::cos( angle_rad ), std::sin( angle_rad ) );
+        for ( auto const range_m : ranges_m )
+        {
+            points.x_m.push_back( range_m * direction.x );
+            points.y_m.push_back( range_m * direction.y );
+        }
+    }
+    return points;
+}
+
+auto evaluate_ddm( FieldParams params, PointsView const points, std::span< float32 > const ddm )
+    -> utils::Result< void >
+{
+    params.summation = Summation::Phasor;
+
+    auto csb = std::vector< float32 >( points.x_m.size( ) );
+    auto sbo = std::vector< float32 >( points.x_m.size( ) );
+    return FieldEvaluator{ std::move( params ) }.evaluate_points(
+        points,
+        { .csb = csb, .sbo = sbo, .ddm = ddm }
+    );
+}
+
+auto analyze_arc(
+    std::span< float32 const > const angles_rad,
+    std::span< float32 const > const ddm,
+    float32 const                    sector_ddm
+) -> std::optional< CourseReport >
+{
+    auto const count = angles_rad.size( );
+    if ( ( ddm.size( ) != count ) || ( count < 2_UZ ) )
+    {
+        return std::nullopt;
+    }
+
+    // The course line is the zero crossing closest to the approach course.
+    auto course_segment = std::optional< std::size_t >{ };
+    auto course_line    = 0.0F;
+
+    for ( auto i = 0_UZ; i + 1_UZ < count; ++i )
+    {
+        auto const a = ddm[ i ];
+        auto const b = ddm[ i + 1_UZ ];
+
+        if ( ( ( a <= 0.0F ) && ( b > 0.0F ) ) || ( ( a >= 0.0F ) && ( b < 0.0F ) ) )
+        {
+            auto const angle = crossing_angle( angles_rad, ddm, i, 0.0F );
+            if ( !course_segment || ( std::abs( angle ) < std::abs( course_line ) ) )
+            {
+                course_segment = i;
+                course_line    = angle;
+            }
+        }
+    }
+
+    if ( !course_segment )
+    {
+        return std::nullopt;
+    }
+
+    // Walk out from the course line to the first full-scale sample on each side.
+    auto positive_edge = std::optional< float32 >{ };
+    for ( auto j = *course_segment + 1_UZ; j < count; ++j )
+    {
+        if ( std::abs( ddm[ j ] ) >= sector_ddm )
+        {
+            auto const target = std::copysign( sector_ddm, ddm[ j ] );
+            positive_edge     = crossing_angle( angles_rad, ddm, j - 1_UZ, target );
+            break;
+        }
+    }
+
+    auto negative_edge = std::optional< float32 >{ };
+    for ( auto j = *course_segment + 1_UZ; j > 0_UZ; --j )
+    {
+        auto const index = j - 1_UZ;
+        if ( std::abs( ddm[ index ] ) >= sector_ddm )
+        {
+            auto const target = std::copysign( sector_ddm, ddm[ index ] );
+            negative_edge     = crossing_angle( angles_rad, ddm, index, target );
+            break;
+        }
+    }
+
+    if ( !positive_edge || !negative_edge )
+    {
+        return std::nullopt;
+    }
+
+    auto report = CourseReport{
+        .course_line_rad         = course_line,
+        .positive_half_width_rad = *positive_edge - course_line,
+        .negative_half_width_rad = course_line - *negative_edge,
+        .course_width_rad        = *positive_edge - *negative_edge,
+        .linearity_error         = 0.0F,
+    };
+
+    // Full-scale DDM on each side, with the sign the array produces there.
+    auto const positive_target = ddm[ *course_segment + 1_UZ ] < 0.0F ? -sector_ddm : sector_ddm;
+    auto const negative_target = -positive_target;
+
+    for ( auto i = 0_UZ; i < count; ++i )
+    {
+        auto const angle = angles_rad[ i ];
+        if ( ( angle <= *negative_edge ) || ( angle >= *positive_edge ) )
+        {
+            continue;
+        }
+
+        auto const ideal
+            = ( angle >= course_line )
+                ? positive_target * ( angle - course_line ) / report.positive_half_width_rad
+                : negative_target * ( course_line - angle ) / report.negative_half_width_rad;
+
+        report.linearity_error
+            = std::max( report.linearity_error, std::abs( ddm[ i ] - ideal ) / sector_ddm );
+    }
+
+    return report;
+}
+
+auto analyze_arcs(
+    FieldParams const&               params,
+    std::span< float32 const > const ranges_m,
+    std::span< float32 const > const angles_rad
+) -> utils::Result< std::vector< std::optional< CourseReport > > >
+{
+    LTB_CHECK_VALID( std::ranges::is_sorted( angles_rad ), "Arc angles must be ascending" );
+
+    auto const points = arc_points( ranges_m, angles_rad );
+
+    auto ddm = std::vector< float32 >( points.x_m.size( ) );
+    LTB_CHECK( evaluate_ddm( params, points.view( ), ddm ) );
+
+    auto arcs = std::vector< std::size_t >( ranges_m.size( ) );
+    std::iota( arcs.begin( ), arcs.end( ), 0_UZ );
+
+    auto reports = std::vector< std::optional< CourseReport > >( ranges_m.size( ) );
+
+    std::for_each(
+        std::execution::par,
+        arcs.begin( ),
+        arcs.end( ),
+        [ & ]( std::size_t const arc )
+        {
+            auto const arc_ddm = std::span< float32 const >{ ddm }.subspan(
+                arc * angles_rad.size( ),
+                angles_rad.size( )
+            );
+            reports[ arc ] = analyze_arc( angles_rad, arc_ddm );
+        }
+    );
+
+    return reports;
+}
+
+} // namespace ltb::ils
@@ -0,0 +1,107 @@
+
+// project
+#include "ltb/ils/course_analysis.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <gtest/gtest.h>
+
+// standard
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+TEST( CourseAnalysisTests, PointsMatchSinglePointEvaluation )
+{
+    auto const params = ils::FieldParams{
+        .antenna_pairs     = 4,
+        .antenna_spacing_m = 1.5F,
+        .summation         = ils::Summation::Phasor,
+    };
+
+    auto const ranges = ils::linspace( { .min = 50.0F, .max = 2'000.0F }, 7 );
+    auto const angles = ils::linspace( { .min = -0.4F, .max = 0.4F }, 301 );
+    auto const points = ils::arc_points( ranges, angles );
+
+    auto ddm = std::vector< float32 >( points.x_m.size( ) );
+    ASSERT_TRUE( ils::evaluate_ddm( params, points.view( ), ddm ) );
+
+    auto const evaluator = ils::FieldEvaluator{ params };
+    for ( auto i = 0_UZ; i < ddm.size( ); ++i )
+    {
+        auto const point = glm::vec2( points.x_m[ i ], points.y_m[ i ] );
+        EXPECT_NEAR( ddm[ i ], evaluator.evaluate_point( point ).x, 1.0e-4F );
+    }
+}
+
+TEST( CourseAnalysisTests, LinearDdmHasNoLinearityError )
+{
+    // A course 0.05 rad off the approach, reaching full scale 0.1 rad either side.
+    constexpr auto course_line = 0.05F;
+    constexpr auto half_width  = 0.1F;
+    constexpr auto sector_ddm  = ils::Constants< float32 >::course_sector_ddm( );
+
+    auto const angles = ils::linspace( { .min = -0.5F, .max = 0.5F }, 1'001 );
+
+    auto ddm = std::vector< float32 >( angles.size( ) );
+    for ( auto i = 0_UZ; i < angles.size( ); ++i )
+    {
+        ddm[ i ] = -sector_ddm * ( angles[ i ] - course_line ) / half_width;
+    }
+
+    auto const report = ils::analyze_arc( angles, ddm );
+    ASSERT_TRUE( report.has_value( ) );
+
+    EXPECT_NEAR( report->course_line_rad, course_line, 1.0e-5F );
+    EXPECT_NEAR( report->positive_half_width_rad, half_width, 1.0e-5F );
+    EXPECT_NEAR( report->negative_half_width_rad, half_width, 1.0e-5F );
+    EXPECT_NEAR( report->course_width_rad, 2.0F * half_width, 1.0e-5F );
+    EXPECT_NEAR( report->linearity_error, 0.0F, 1.0e-4F );
+
+    // Bending one half of the sector shows up as a linearity error.
+    for ( auto i = 0_UZ; i < angles.size( ); ++i )
+    {
+        if ( angles[ i ] > course_line )
+        {
+            auto const t = ( angles[ i ] - course_line ) / half_width;
+            ddm[ i ]     = -sector_ddm * t * t;
+        }
+    }
+
+    auto const bent_report = ils::analyze_arc( angles, ddm );
+    ASSERT_TRUE( bent_report.has_value( ) );
+    EXPECT_NEAR( bent_report->positive_half_width_rad, half_width, 1.0e-4F );
+    EXPECT_NEAR( bent_report->linearity_error, 0.25F, 1.0e-3F );
+}
+
+TEST( CourseAnalysisTests, ArrayCourseIsCenteredAndSymmetric )
+{
+    auto const params = ils::FieldParams{
+        .antenna_pairs     = 6,
+        .antenna_spacing_m = 1.3F,
+    };
+
+    auto const ranges = ils::linspace( { .min = 500.0F, .max = 5'000.0F }, 10 );
+    auto const angles = ils::linspace( { .min = -0.6F, .max = 0.6F }, 2'401 );
+
+    auto const reports = ils::analyze_arcs( params, ranges, angles );
+    ASSERT_TRUE( reports );
+    ASSERT_EQ( reports->size( ), ranges.size( ) );
+
+    for ( auto const& report : *reports )
+    {
+        ASSERT_TRUE( report.has_value( ) );
+        EXPECT_NEAR( report->course_line_rad, 0.0F, 1.0e-3F );
+        EXPECT_NEAR( report->positive_half_width_rad, report->negative_half_width_rad, 1.0e-3F );
+        EXPECT_GT( report->course_width_rad, 0.0F );
+    }
+
+    EXPECT_FALSE( ils::analyze_arc( angles, std::vector< float32 >( angles.size( ), 0.0F ) ) );
+}
+
+} // namespace
+} // namespace ltb
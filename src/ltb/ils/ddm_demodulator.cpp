@@ -0,0 +1,108 @@
+#include "ltb/ils/ddm_demodulator.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// standard
+#include <algorithm>
+#include <cmath>
+
+namespace ltb::ils
+{
+namespace
+{
+
+// Both tones complete whole cycles in one period of their 30 Hz difference.
+constexpr auto demodulation_window_hz = 30.0;
+
+constexpr auto mean_tone         = 0_UZ;
+constexpr auto ninety_hz_tone    = 1_UZ;
+constexpr auto one_fifty_hz_tone = 2_UZ;
+
+} // namespace
+
+DdmDemodulator::DdmDemodulator( float64 const sample_rate_hz, float64 const start_time_s )
+    : tones_( {
+          .sample_rate_hz = sample_rate_hz,
+          .window_hz      = demodulation_window_hz,
+          .tones_hz       = { 0.0, 90.0, 150.0 },
+          .start_time_s   = start_time_s,
+      } )
+{
+}
+
+auto DdmDemodulator::sample_count( ) const -> std::size_t
+{
+    return tones_.sample_count( );
+}
+
+auto DdmDemodulator::process(
+    std::span< float32 const > const envelope,
+    ReceiverOutput const&            output
+) -> utils::Result< void >
+{
+    LTB_CHECK( check( envelope.size( ), output ) );
+
+    for ( auto i = 0_UZ; i < envelope.size( ); ++i )
+    {
+        auto const sample = envelope[ i ];
+        auto const depths = demodulate( static_cast< float64 >( sample ) );
+
+        output.envelope[ i ]     = sample;
+        output.ninety_hz[ i ]    = depths.x;
+        output.one_fifty_hz[ i ] = depths.y;
+        output.ddm[ i ]          = depths.x - depths.y;
+    }
+    return utils::success( );
+}
+
+auto DdmDemodulator::process_iq( std::span< dsp::Iq const > const iq, ReceiverOutput const& output )
+    -> utils::Result< void >
+{
+    LTB_CHECK( check( iq.size( ), output ) );
+    LTB_CHECK( dsp::envelope( iq, output.envelope ) );
+    return process( output.envelope, output );
+}
+
+auto DdmDemodulator::demodulate( float64 const envelope ) -> glm::vec2
+{
+    auto const sample = static_cast< float32 >( envelope );
+    tones_.push( std::span( &sample, 1_UZ ) );
+
+    auto const mean = tones_.value( mean_tone, 0_UZ ).x;
+    if ( mean <= 0.0 )
+    {
+        return glm::vec2( 0.0F );
+    }
+
+    return {
+        static_cast< float32 >( glm::length( tones_.value( ninety_hz_tone, 0_UZ ) ) / mean ),
+        static_cast< float32 >( glm::length( tones_.value( one_fifty_hz_tone, 0_UZ ) ) / mean ),
+    };
+}
+
+auto DdmDemodulator::check( std::size_t const samples, ReceiverOutput const& output ) const
+    -> utils::Result< void >
+{
+    LTB_CHECK_VALID(
+        tones_.window_size( ) > 0_UZ,
+        "The sample rate must be a positive multiple of 30 Hz"
+    );
+
+    if ( ( output.envelope.size( ) != samples ) || ( output.ninety_hz.size( ) != samples )
+         || ( output.one_fifty_hz.size( ) != samples ) || ( output.ddm.size( ) != samples ) )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "Receiver output size mismatch. Got {} samples, envelope: {}, 90 Hz: {}, "
+            "150 Hz: {}, ddm: {}",
+            samples,
+            output.envelope.size( ),
+            output.ninety_hz.size( ),
+            output.one_fifty_hz.size( ),
+            output.ddm.size( )
+        );
+    }
+    return utils::success( );
+}
+
+} // namespace ltb::ils
@@ -0,0 +1,143 @@
+// project
+#include "ltb/dsp/am_detector.hpp"
+#include "ltb/ils/ddm_demodulator.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+#include <gtest/gtest.h>
+
+// standard
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+TEST( DdmDemodulatorTests, MeasuresToneDepthsFromBaseband )
+{
+    constexpr auto sample_rate_hz = 48'000.0;
+    constexpr auto offset_hz      = 310.0;
+    constexpr auto ninety_depth   = 0.23;
+    constexpr auto fifty_depth    = 0.17;
+    constexpr auto samples        = 9'600_UZ;
+
+    // A CSB carrier 310 Hz off tune, with the 90 Hz tone deeper than the 150 Hz one.
+    auto iq = std::vector< dsp::Iq >( samples );
+    for ( auto i = 0_UZ; i < samples; ++i )
+    {
+        auto const turns    = glm::two_pi< float64 >( ) * static_cast< float64 >( i )
+                            / sample_rate_hz;
+        auto const envelope = 1.0 + ( ninety_depth * std::sin( 90.0 * turns ) )
+                            + ( fifty_depth * std::sin( 150.0 * turns ) );
+        auto const angle    = offset_hz * turns;
+        auto const carrier  = glm::dvec2( std::cos( angle ), std::sin( angle ) );
+        iq[ i ]             = dsp::Iq( carrier * envelope );
+    }
+
+    auto envelope     = std::vector< float32 >( samples );
+    auto ninety_hz    = std::vector< float32 >( samples );
+    auto one_fifty_hz = std::vector< float32 >( samples );
+    auto ddm          = std::vector< float32 >( samples );
+
+    auto demodulator = ils::DdmDemodulator{ sample_rate_hz };
+    for ( auto start = 0_UZ; start < samples; start += 1'000_UZ )
+    {
+        auto const count = std::min( 1'000_UZ, samples - start );
+        ASSERT_TRUE( demodulator.process_iq(
+            std::span( iq ).subspan( start, count ),
+            {
+                .envelope     = std::span( envelope ).subspan( start, count ),
+                .ninety_hz    = std::span( ninety_hz ).subspan( start, count ),
+                .one_fifty_hz = std::span( one_fifty_hz ).subspan( start, count ),
+                .ddm          = std::span( ddm ).subspan( start, count ),
+            }
+        ) );
+    }
+    EXPECT_EQ( demodulator.sample_count( ), samples );
+
+    // Settled after one 30 Hz period.
+    for ( auto i = 1'600_UZ; i < samples; i += 101_UZ )
+    {
+        EXPECT_NEAR( ninety_hz[ i ], ninety_depth, 1.0e-4 ) << i;
+        EXPECT_NEAR( one_fifty_hz[ i ], fifty_depth, 1.0e-4 ) << i;
+        EXPECT_NEAR( ddm[ i ], ninety_depth - fifty_depth, 1.0e-4 ) << i;
+    }
+}
+
+TEST( DdmDemodulatorTests, MeasuresToneDepthsFromAFadingIf )
+{
+    // A weak real IF that strengthens by 20 % over the capture, detected with AGC.
+    constexpr auto if_rate_hz   = 480'000.0;
+    constexpr auto carrier_hz   = 100'000.0;
+    constexpr auto ninety_depth = 0.23;
+    constexpr auto fifty_depth  = 0.17;
+    constexpr auto samples      = 96'000_UZ;
+
+    auto passband = std::vector< float32 >( samples );
+    for ( auto i = 0_UZ; i < samples; ++i )
+    {
+        auto const time_s   = static_cast< float64 >( i ) / if_rate_hz;
+        auto const turns    = glm::two_pi< float64 >( ) * time_s;
+        auto const level    = 1.0e-3 * ( 1.0 + time_s );
+        auto const envelope = 1.0 + ( ninety_depth * std::sin( 90.0 * turns ) )
+                            + ( fifty_depth * std::sin( 150.0 * turns ) );
+        passband[ i ] = static_cast< float32 >( level * envelope * std::cos( carrier_hz * turns ) );
+    }
+
+    auto envelope     = std::vector< float32 >( samples );
+    auto ninety_hz    = std::vector< float32 >( samples );
+    auto one_fifty_hz = std::vector< float32 >( samples );
+    auto ddm          = std::vector< float32 >( samples );
+
+    auto detector    = dsp::AmDetector{ { .sample_rate_hz = if_rate_hz } };
+    auto demodulator = ils::DdmDemodulator{ if_rate_hz };
+    for ( auto start = 0_UZ; start < samples; start += 4'800_UZ )
+    {
+        auto const block = std::span( envelope ).subspan( start, 4'800 );
+        ASSERT_TRUE( detector.process( std::span( passband ).subspan( start, 4'800 ), block ) );
+        ASSERT_TRUE( demodulator.process(
+            block,
+            {
+                .envelope     = block,
+                .ninety_hz    = std::span( ninety_hz ).subspan( start, 4'800 ),
+                .one_fifty_hz = std::span( one_fifty_hz ).subspan( start, 4'800 ),
+                .ddm          = std::span( ddm ).subspan( start, 4'800 ),
+            }
+        ) );
+    }
+
+    // The AGC has the level in hand after two windows, and the demodulator one after. The
+    // gain is set from the mean of the window before last, when the level was 1.15e-3, so
+    // a trace of the change is left in each window.
+    EXPECT_NEAR( detector.gains( ).front( ) * 1.15e-3, 1.0, 0.01 );
+    for ( auto i = 48'000_UZ; i < samples; i += 1'001_UZ )
+    {
+        EXPECT_NEAR( ninety_hz[ i ], ninety_depth, 1.0e-3 ) << i;
+        EXPECT_NEAR( one_fifty_hz[ i ], fifty_depth, 1.0e-3 ) << i;
+        EXPECT_NEAR( ddm[ i ], ninety_depth - fifty_depth, 1.0e-3 ) << i;
+    }
+}
+
+TEST( DdmDemodulatorTests, RejectsInvalidInput )
+{
+    auto       envelope  = std::vector< float32 >( 4 );
+    auto       short_ddm = std::vector< float32 >( 3 );
+    auto const output    = ils::ReceiverOutput{
+        .envelope     = envelope,
+        .ninety_hz    = envelope,
+        .one_fifty_hz = envelope,
+        .ddm          = short_ddm,
+    };
+
+    EXPECT_FALSE( ils::DdmDemodulator{ 48'000.0 }.process( envelope, output ) );
+    EXPECT_FALSE( ils::DdmDemodulator{ 1'000.0 }.process(
+        envelope,
+        { .envelope = envelope, .ninety_hz = envelope, .one_fifty_hz = envelope, .ddm = envelope }
+    ) );
+}
+
+} // namespace
+} // namespace ltb
@@ -0,0 +1,53 @@
+#include "ltb/ils/excitation.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <algorithm>
+#include <cmath>
+
+namespace ltb::ils
+{
+
+auto default_excitations( int32 const antenna_pairs ) -> std::vector< ElementExcitation >
+{
+    auto const half_count = static_cast< std::size_t >( std::max( antenna_pairs, 0 ) );
+
+    auto excitations = std::vector< ElementExcitation >( half_count * 2_UZ );
+    for ( auto i = 0_UZ; i < excitations.size( ); ++i )
+    {
+        // The upper half is fed with an inverted SBO signal.
+        auto const upper_half = ( i >= half_count );
+
+        excitations[ i ] = {
+            .csb_amplitude = 1.0F,
+            .csb_phase_rad = 0.0F,
+            .sbo_amplitude = 1.0F,
+            .sbo_phase_rad = upper_half ? -glm::half_pi< float32 >( ) : glm::half_pi< float32 >( ),
+        };
+    }
+    return excitations;
+}
+
+auto excitation_phasors( ElementExcitation const& excitation ) -> glm::vec4
+{
+    return {
+        excitation.csb_amplitude * std::cos( excitation.csb_phase_rad ),
+        excitation.csb_amplitude * std::sin( excitation.csb_phase_rad ),
+        excitation.sbo_amplitude * std::cos( excitation.sbo_phase_rad ),
+        excitation.sbo_amplitude * std::sin( excitation.sbo_phase_rad ),
+    };
+}
+
+auto ddm( glm::vec2 const csb, glm::vec2 const sbo ) -> float32
+{
+    auto const csb_power = glm::dot( csb, csb );
+    if ( csb_power <= 0.0F )
+    {
+        return 0.0F;
+    }
+    return 2.0F * glm::dot( sbo, csb ) / csb_power;
+}
+
+} // namespace ltb::ils
@@ -0,0 +1,904 @@
+#include "ltb/ils/field_evaluator.hpp"
+
+// project
+#include "ltb/ils/constants.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <execution>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace ltb::ils
+{
+namespace
+{
+
+using Consts = Constants< float32 >;
+
+constexpr auto inf = std::numeric_limits< float32 >::infinity( );
+
+// Rows are handed to worker threads in blocks so each
+// block only allocates its antenna scratch space once.
+constexpr auto rows_per_block = 16;
+
+// Point lists are split into blocks of this many points, each treated like one row.
+constexpr auto points_per_block = 1024_UZ;
+
+auto antenna_count( FieldParams const& params ) -> std::size_t
+{
+    return static_cast< std::size_t >( params.antenna_pairs ) * 2_UZ;
+}
+
+/// \brief The antenna positions are spread evenly along the y axis, centered on the origin.
+auto antenna_position_m( FieldParams const& params, std::size_t const index ) -> glm::vec3
+{
+    auto const min_antenna_pos
+        = ( static_cast< float32 >( params.antenna_pairs ) - 0.5F ) * params.antenna_spacing_m;
+    return {
+        0.0F,
+        -min_antenna_pos + ( params.antenna_spacing_m * static_cast< float32 >( index ) ),
+        params.antenna_height_m,
+    };
+}
+
+/// \brief The point every path difference is measured from.
+auto array_center_m( FieldParams const& params ) -> glm::vec3
+{
+    return { 0.0F, 0.0F, params.antenna_height_m };
+}
+
+/// \brief The complex CSB (xy) and SBO (zw) feed of every element.
+auto element_phasors( FieldParams const& params ) -> std::vector< glm::vec4 >
+{
+    auto const excitations = params.excitations.empty( )
+                               ? default_excitations( params.antenna_pairs )
+                               : params.excitations;
+
+    auto phasors = std::vector< glm::vec4 >( antenna_count( params ), glm::vec4( 0.0F ) );
+    for ( auto i = 0_UZ; i < std::min( phasors.size( ), excitations.size( ) ); ++i )
+    {
+        phasors[ i ] = excitation_phasors( excitations[ i ] );
+    }
+    return phasors;
+}
+
+/// \brief A plane `dot( xyz, p ) + w` that is non-negative on the inside.
+using HalfSpace = glm::vec4;
+
+auto signed_distance( HalfSpace const& plane, glm::vec3 const position ) -> float32
+{
+    return glm::dot( glm::vec3( plane ), position ) + plane.w;
+}
+
+/// \brief The plane through \p image containing the reflector edge at \p edge_point
+///        running along \p edge_direction, facing the reflector's center.
+auto edge_half_space(
+    glm::vec3 const image,
+    glm::vec3 const edge_point,
+    glm::vec3 const edge_direction,
+    glm::vec3 const center
+) -> HalfSpace
+{
+    auto normal = glm::cross( edge_direction, edge_point - image );
+    if ( glm::dot( normal, center - image ) < 0.0F )
+    {
+        normal = -normal;
+    }
+    return { normal, -glm::dot( normal, image ) };
+}
+
+/// \brief One antenna mirrored across one reflector.
+///
+/// A receiver sees the reflection when the straight path from the image to it crosses
+/// the reflector's rectangle. That is the inside of the pyramid from the image through
+/// the rectangle, beyond the reflector plane: the intersection of up to five half spaces.
+struct ImageSource
+{
+    glm::vec3 position_m  = { };
+    glm::vec2 coefficient = { };
+
+    std::array< HalfSpace, 5 > bounds      = { };
+    std::size_t                bound_count = 0_UZ;
+};
+
+auto make_image_source( glm::vec3 const antenna, Reflector const& reflector ) -> ImageSource
+{
+    auto const image  = mirror( antenna, reflector );
+    auto const center = reflector.center_m;
+
+    auto source = ImageSource{
+        .position_m  = image,
+        .coefficient = reflector.coefficient,
+        .bounds      = { HalfSpace( reflector.normal, -glm::dot( reflector.normal, center ) ) },
+        .bound_count = 1_UZ,
+    };
+
+    auto const bitangent = glm::cross( reflector.normal, reflector.tangent );
+    auto const axes      = std::array{ reflector.tangent, bitangent };
+    auto const half_size = std::array{ reflector.half_size_m.x, reflector.half_size_m.y };
+
+    for ( auto axis = 0_UZ; axis < axes.size( ); ++axis )
+    {
+        // Unbounded directions add no edges.
+        if ( !std::isfinite( half_size[ axis ] ) )
+        {
+            continue;
+        }
+
+        auto const edge_direction = axes[ 1_UZ - axis ];
+        for ( auto const side : { -1.0F, 1.0F } )
+        {
+            auto const edge_point = center + ( axes[ axis ] * ( side * half_size[ axis ] ) );
+            source.bounds[ source.bound_count++ ]
+                = edge_half_space( image, edge_point, edge_direction, center );
+        }
+    }
+
+    return source;
+}
+
+/// \brief Every real antenna and the images of it a receiver can see.
+struct Sources
+{
+    glm::vec3                                 center_m = { };
+    std::vector< glm::vec3 >                  antennas = { };
+    std::vector< std::vector< ImageSource > > images   = { };
+};
+
+auto make_sources( FieldParams const& params ) -> Sources
+{
+    auto const antennas = antenna_count( params );
+
+    auto sources = Sources{
+        .center_m = array_center_m( params ),
+        .antennas = std::vector< glm::vec3 >( antennas ),
+        .images   = std::vector< std::vector< ImageSource > >( antennas ),
+    };
+
+    for ( auto i = 0_UZ; i < antennas; ++i )
+    {
+        auto const antenna    = antenna_position_m( params, i );
+        sources.antennas[ i ] = antenna;
+
+        for ( auto const& reflector : params.reflectors )
+        {
+            // An antenna behind the reflector cannot illuminate it.
+            if ( glm::dot( antenna - reflector.center_m, reflector.normal ) < 0.0F )
+            {
+                continue;
+            }
+            sources.images[ i ].push_back( make_image_source( antenna, reflector ) );
+        }
+    }
+
+    return sources;
+}
+
+/// \brief Mirrors `reference_phase()` in `ils.frag`: the distance from the array center
+///        (x) and the fraction of a carrier cycle left over along it (y).
+auto reference_phase( glm::vec3 const position, glm::vec3 const center ) -> glm::vec2
+{
+    auto const reference_m  = glm::length( position - center );
+    auto const microseconds = reference_m / Consts::speed_of_light_m_us( );
+    auto const cycles       = Consts::localizer_frequency_mhz( ) * microseconds;
+    return { reference_m, cycles - std::floor( cycles ) };
+}
+
+/// \brief Mirrors `value()` in `ils.frag`. The operation order matches the shader
+///        so the CPU and GPU round the same way.
+///
+/// The phase is the \p reference cycles shared by every antenna plus this antenna's
+/// path difference from the array center. The path difference is computed without
+/// cancellation, so it stays accurate at any range, while rounding in the shared part
+/// rotates every phasor equally and leaves the CSB, SBO, and DDM unchanged.
+auto antenna_value(
+    glm::vec3 const position,
+    glm::vec3 const antenna,
+    glm::vec3 const center,
+    glm::vec2 const reference
+) -> glm::vec2
+{
+    auto const offset = position - antenna;
+    auto const dist_meters
+        = std::sqrt( ( offset.x * offset.x ) + ( offset.y * offset.y ) + ( offset.z * offset.z ) );
+
+    // |p - a| - |p - c| == (a - c)·(a + c - 2p) / (|p - a| + |p - c|)
+    auto const path_difference_m
+        = glm::dot( antenna - center, antenna + center - ( 2.0F * position ) )
+        / ( dist_meters + reference.x );
+
+    auto const microseconds = path_difference_m / Consts::speed_of_light_m_us( );
+    auto const phase_angle  = reference.y + ( Consts::localizer_frequency_mhz( ) * microseconds );
+    auto const radians      = phase_angle * 2.0F * glm::pi< float32 >( );
+    auto const intensity    = Consts::antenna_power( ) / ( dist_meters * dist_meters );
+    return { std::cos( radians ) * intensity, std::sin( radians ) * intensity };
+}
+
+/// \brief Complex multiplication, written out the same way as `cmul()` in `ils.frag`.
+auto cmul( glm::vec2 const a, glm::vec2 const b ) -> glm::vec2
+{
+    return { ( a.x * b.x ) - ( a.y * b.y ), ( a.x * b.y ) + ( a.y * b.x ) };
+}
+
+auto image_visible( glm::vec3 const position, ImageSource const& image ) -> bool
+{
+    for ( auto i = 0_UZ; i < image.bound_count; ++i )
+    {
+        if ( signed_distance( image.bounds[ i ], position ) < 0.0F )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// \brief The direct phasor of one antenna plus every visible reflection of it.
+auto received_value(
+    Sources const&    sources,
+    std::size_t const antenna,
+    glm::vec3 const   position,
+    glm::vec2 const   reference
+) -> glm::vec2
+{
+    auto value
+        = antenna_value( position, sources.antennas[ antenna ], sources.center_m, reference );
+
+    for ( auto const& image : sources.images[ antenna ] )
+    {
+        if ( image_visible( position, image ) )
+        {
+            value += cmul(
+                antenna_value( position, image.position_m, sources.center_m, reference ),
+                image.coefficient
+            );
+        }
+    }
+
+    return value;
+}
+
+/// \brief Positions of one row (or block) of points, structure-of-arrays.
+struct RowPositions
+{
+    float32 const* x_m = nullptr;
+    float32 const* y_m = nullptr;
+    float32 const* z_m = nullptr;
+
+    [[nodiscard( "Const getter" )]]
+    auto at( std::size_t const x ) const -> glm::vec3
+    {
+        return { x_m[ x ], y_m[ x ], z_m[ x ] };
+    }
+};
+
+/// \brief Scratch space holding complex values for a number of rows of pixels, plus the
+///        reference phase and image visibility of each pixel in the current row and its bounds.
+struct RowScratch
+{
+    std::size_t              width     = 0_UZ;
+    std::vector< float32 >   real      = { };
+    std::vector< float32 >   imag      = { };
+    std::vector< float32 >   reference = { };
+    std::vector< float32 >   visible   = { };
+    math::Range< glm::vec3 > bounds_m  = { };
+
+    RowScratch( std::size_t const rows, std::size_t const row_width )
+        : width( row_width )
+        , real( rows * row_width, 0.0F )
+        , imag( rows * row_width, 0.0F )
+        , reference( 2_UZ * row_width, 0.0F )
+        , visible( row_width, 0.0F )
+    {
+    }
+
+    auto set_reference_phases( RowPositions const& positions, glm::vec3 const center ) -> void
+    {
+        bounds_m = { .min = glm::vec3( inf ), .max = glm::vec3( -inf ) };
+
+        for ( auto x = 0_UZ; x < width; ++x )
+        {
+            auto const position = positions.at( x );
+            auto const phase    = reference_phase( position, center );
+
+            reference[ x ]         = phase.x;
+            reference[ width + x ] = phase.y;
+
+            bounds_m.min = glm::min( bounds_m.min, position );
+            bounds_m.max = glm::max( bounds_m.max, position );
+        }
+    }
+
+    /// \brief Whether any part of the row's bounding box is inside \p plane.
+    [[nodiscard( "Const getter" )]]
+    auto reaches( HalfSpace const& plane ) const -> bool
+    {
+        auto const farthest = glm::vec3(
+            ( plane.x > 0.0F ) ? bounds_m.max.x : bounds_m.min.x,
+            ( plane.y > 0.0F ) ? bounds_m.max.y : bounds_m.min.y,
+            ( plane.z > 0.0F ) ? bounds_m.max.z : bounds_m.min.z
+        );
+        return signed_distance( plane, farthest ) >= 0.0F;
+    }
+
+    [[nodiscard( "Const getter" )]]
+    auto reference_at( std::size_t const x ) const -> glm::vec2
+    {
+        return { reference[ x ], reference[ width + x ] };
+    }
+
+    auto real_row( std::size_t const row ) -> float32*
+    {
+        return real.data( ) + ( row * width );
+    }
+
+    auto imag_row( std::size_t const row ) -> float32*
+    {
+        return imag.data( ) + ( row * width );
+    }
+};
+
+/// \brief Pointers to the start of one row of each requested output.
+struct RowOutput
+{
+    float32* csb = nullptr;
+    float32* sbo = nullptr;
+    float32* ddm = nullptr;
+};
+
+/// \brief Adds \p image to the row wherever it is visible.
+///
+/// Rows entirely outside one of the image's half spaces are skipped, which discards most
+/// small reflectors without touching the points. Otherwise the visibility mask is built
+/// one half space at a time, and since reflections are usually seen by one contiguous
+/// stretch of a row, only the span between the first and last visible points is
+/// evaluated, with invisible points inside it masked out.
+auto accumulate_image_row(
+    Sources const&      sources,
+    ImageSource const&  image,
+    RowPositions const& positions,
+    RowScratch&         scratch,
+    float32* const      real,
+    float32* const      imag
+) -> void
+{
+    auto const width  = scratch.width;
+    auto const bounds = std::span( image.bounds ).first( image.bound_count );
+
+    auto const row_reaches = [ &scratch ]( HalfSpace const& plane )
+    { return scratch.reaches( plane ); };
+
+    if ( !std::ranges::all_of( bounds, row_reaches ) )
+    {
+        return;
+    }
+
+    auto& visible = scratch.visible;
+    std::fill( visible.begin( ), visible.end( ), 1.0F );
+
+    for ( auto const& plane : bounds )
+    {
+        for ( auto x = 0_UZ; x < width; ++x )
+        {
+            auto const inside = signed_distance( plane, positions.at( x ) ) >= 0.0F;
+            visible[ x ]      = inside ? visible[ x ] : 0.0F;
+        }
+    }
+
+    auto const first = std::find( visible.begin( ), visible.end( ), 1.0F );
+    if ( first == visible.end( ) )
+    {
+        return;
+    }
+    auto const last = std::find( visible.rbegin( ), visible.rend( ), 1.0F ).base( );
+
+    auto const begin = static_cast< std::size_t >( first - visible.begin( ) );
+    auto const end   = static_cast< std::size_t >( last - visible.begin( ) );
+
+    for ( auto x = begin; x < end; ++x )
+    {
+        auto const value = cmul(
+            antenna_value(
+                positions.at( x ),
+                image.position_m,
+                sources.center_m,
+                scratch.reference_at( x )
+            ),
+            image.coefficient
+        );
+        real[ x ] += value.x * visible[ x ];
+        imag[ x ] += value.y * visible[ x ];
+    }
+}
+
+/// \brief Stores the received phasor of one antenna, direct path plus reflections, for the row.
+auto antenna_row(
+    Sources const&      sources,
+    std::size_t const   antenna,
+    RowPositions const& positions,
+    RowScratch&         scratch,
+    float32* const      real,
+    float32* const      imag
+) -> void
+{
+    auto const position_m = sources.antennas[ antenna ];
+
+    for ( auto x = 0_UZ; x < scratch.width; ++x )
+    {
+        auto const value = antenna_value(
+            positions.at( x ),
+            position_m,
+            sources.center_m,
+            scratch.reference_at( x )
+        );
+        real[ x ] = value.x;
+        imag[ x ] = value.y;
+    }
+
+    for ( auto const& image : sources.images[ antenna ] )
+    {
+        accumulate_image_row( sources, image, positions, scratch, real, imag );
+    }
+}
+
+/// \brief Every antenna's phasor for the row is stored, then summed pairwise. O(N²).
+auto evaluate_pairwise_row(
+    Sources const&      sources,
+    RowPositions const& positions,
+    RowScratch&         scratch,
+    RowOutput const&    output
+) -> void
+{
+    auto const antennas = sources.antennas.size( );
+    auto const width    = scratch.width;
+
+    scratch.set_reference_phases( positions, sources.center_m );
+
+    for ( auto i = 0_UZ; i < antennas; ++i )
+    {
+        antenna_row( sources, i, positions, scratch, scratch.real_row( i ), scratch.imag_row( i ) );
+    }
+
+    auto* const csb = output.csb;
+    auto* const sbo = output.sbo;
+
+    std::fill_n( csb, width, 0.0F );
+    std::fill_n( sbo, width, 0.0F );
+
+    // Same accumulation order as the nested loops in `ils.frag`.
+    for ( auto i = 0_UZ; i < antennas; ++i )
+    {
+        auto const* const i_real = scratch.real_row( i );
+        auto const* const i_imag = scratch.imag_row( i );
+
+        for ( auto j = i + 1_UZ; j < antennas; ++j )
+        {
+            auto const* const j_real = scratch.real_row( j );
+            auto const* const j_imag = scratch.imag_row( j );
+
+            for ( auto x = 0_UZ; x < width; ++x )
+            {
+                auto const sum_real  = i_real[ x ] + j_real[ x ];
+                auto const sum_imag  = i_imag[ x ] + j_imag[ x ];
+                auto const diff_real = i_real[ x ] - j_real[ x ];
+                auto const diff_imag = i_imag[ x ] - j_imag[ x ];
+
+                csb[ x ] += std::sqrt( ( sum_real * sum_real ) + ( sum_imag * sum_imag ) );
+                sbo[ x ] += std::sqrt( ( diff_real * diff_real ) + ( diff_imag * diff_imag ) );
+            }
+        }
+    }
+}
+
+/// \brief Each antenna's phasor is weighted by its CSB and SBO feed and
+///        accumulated straight into the row sums. O(N).
+auto evaluate_phasor_row(
+    Sources const&                  sources,
+    std::vector< glm::vec4 > const& phasors,
+    RowPositions const&             positions,
+    RowScratch&                     scratch,
+    RowOutput const&                output
+) -> void
+{
+    auto const width = scratch.width;
+
+    auto* const csb_real     = scratch.real_row( 0_UZ );
+    auto* const csb_imag     = scratch.imag_row( 0_UZ );
+    auto* const sbo_real     = scratch.real_row( 1_UZ );
+    auto* const sbo_imag     = scratch.imag_row( 1_UZ );
+    auto* const antenna_real = scratch.real_row( 2_UZ );
+    auto* const antenna_imag = scratch.imag_row( 2_UZ );
+
+    std::fill( scratch.real.begin( ), scratch.real.end( ), 0.0F );
+    std::fill( scratch.imag.begin( ), scratch.imag.end( ), 0.0F );
+
+    scratch.set_reference_phases( positions, sources.center_m );
+
+    for ( auto i = 0_UZ; i < phasors.size( ); ++i )
+    {
+        auto const csb_feed = glm::vec2( phasors[ i ].x, phasors[ i ].y );
+        auto const sbo_feed = glm::vec2( phasors[ i ].z, phasors[ i ].w );
+
+        antenna_row( sources, i, positions, scratch, antenna_real, antenna_imag );
+
+        for ( auto x = 0_UZ; x < width; ++x )
+        {
+            auto const value = glm::vec2( antenna_real[ x ], antenna_imag[ x ] );
+            auto const csb   = cmul( value, csb_feed );
+            auto const sbo   = cmul( value, sbo_feed );
+
+            csb_real[ x ] += csb.x;
+            csb_imag[ x ] += csb.y;
+            sbo_real[ x ] += sbo.x;
+            sbo_imag[ x ] += sbo.y;
+        }
+    }
+
+    for ( auto x = 0_UZ; x < width; ++x )
+    {
+        auto const csb = glm::vec2( csb_real[ x ], csb_imag[ x ] );
+        auto const sbo = glm::vec2( sbo_real[ x ], sbo_imag[ x ] );
+
+        output.csb[ x ] = glm::length( csb );
+        output.sbo[ x ] = glm::length( sbo );
+
+        if ( nullptr != output.ddm )
+        {
+            output.ddm[ x ] = ddm( csb, sbo );
+        }
+    }
+}
+
+auto evaluate_row(
+    FieldParams const&              params,
+    Sources const&                  sources,
+    std::vector< glm::vec4 > const& phasors,
+    RowPositions const&             positions,
+    RowScratch&                     scratch,
+    RowOutput const&                output
+) -> void
+{
+    switch ( params.summation )
+    {
+        using enum Summation;
+        case Pairwise:
+            evaluate_pairwise_row( sources, positions, scratch, output );
+            break;
+        case Phasor:
+            evaluate_phasor_row( sources, phasors, positions, scratch, output );
+            break;
+    }
+}
+
+/// \brief Pairwise summation keeps every antenna's row, phasor summation the CSB and
+///        SBO sums plus the antenna currently being added.
+auto scratch_row_count( FieldParams const& params ) -> std::size_t
+{
+    return ( Summation::Pairwise == params.summation ) ? antenna_count( params ) : 3_UZ;
+}
+
+} // namespace
+
+FieldEvaluator::FieldEvaluator( FieldParams params )
+    : params_( std::move( params ) )
+{
+}
+
+auto FieldEvaluator::set_params( FieldParams params ) -> void
+{
+    params_ = std::move( params );
+}
+
+auto FieldEvaluator::params( ) const -> FieldParams const&
+{
+    return params_;
+}
+
+auto FieldEvaluator::evaluate(
+    glm::ivec2 const      field_size_pixels,
+    math::Range2Di const& region,
+    FieldOutput const     output
+) const -> utils::Result< void >
+{
+    LTB_CHECK_VALID( params_.antenna_pairs >= 0 );
+    LTB_CHECK_VALID( ( field_size_pixels.x > 0 ) && ( field_size_pixels.y > 0 ) );
+    LTB_CHECK_VALID( ( region.min.x >= 0 ) && ( region.min.y >= 0 ) );
+    LTB_CHECK_VALID( ( region.min.x <= region.max.x ) && ( region.min.y <= region.max.y ) );
+    LTB_CHECK_VALID(
+        ( region.max.x <= field_size_pixels.x ) && ( region.max.y <= field_size_pixels.y )
+    );
+
+    auto const region_size = dimensions( region );
+    auto const total_size  = utils::total_size( region_size.x, region_size.y );
+
+    if ( ( output.csb.size( ) != total_size ) || ( output.sbo.size( ) != total_size ) )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "Field output size mismatch. Expected {} values, got csb: {}, sbo: {}",
+            total_size,
+            output.csb.size( ),
+            output.sbo.size( )
+        );
+    }
+
+    auto const write_ddm = !output.ddm.empty( );
+    if ( write_ddm )
+    {
+        LTB_CHECK_VALID(
+            Summation::Phasor == params_.summation,
+            "DDM is only defined for phasor summation"
+        );
+        LTB_CHECK_VALID( output.ddm.size( ) == total_size );
+    }
+
+    if ( 0_UZ == total_size )
+    {
+        return utils::success( );
+    }
+
+    auto const width        = static_cast< std::size_t >( region_size.x );
+    auto const sources      = make_sources( params_ );
+    auto const phasors      = element_phasors( params_ );
+    auto const scratch_rows = scratch_row_count( params_ );
+
+    // The x positions are shared by every row.
+    auto pixel_x_m = std::vector< float32 >( width );
+    for ( auto x = 0_UZ; x < width; ++x )
+    {
+        auto const frag_x = static_cast< float32 >( region.min.x ) + static_cast< float32 >( x );
+        pixel_x_m[ x ]    = ( frag_x + 0.5F ) * params_.pixel_size_m;
+    }
+    auto const pixel_z_m = std::vector< float32 >( width, params_.receiver_height_m );
+
+    auto block_starts = std::vector< int32 >{ };
+    for ( auto y = region.min.y; y < region.max.y; y += rows_per_block )
+    {
+        block_starts.push_back( y );
+    }
+
+    auto const half_frame_height = static_cast< float32 >( field_size_pixels.y ) * 0.5F;
+
+    std::for_each(
+        std::execution::par,
+        block_starts.begin( ),
+        block_starts.end( ),
+        [ & ]( int32 const block_start )
+        {
+            auto scratch   = RowScratch{ scratch_rows, width };
+            auto pixel_y_m = std::vector< float32 >( width );
+
+            auto const block_end = std::min( block_start + rows_per_block, region.max.y );
+            for ( auto y = block_start; y < block_end; ++y )
+            {
+                auto const frag_y     = static_cast< float32 >( y ) + 0.5F;
+                auto const row_offset = static_cast< std::size_t >( y - region.min.y ) * width;
+
+                std::fill(
+                    pixel_y_m.begin( ),
+                    pixel_y_m.end( ),
+                    ( half_frame_height - frag_y ) * params_.pixel_size_m
+                );
+
+                evaluate_row(
+                    params_,
+                    sources,
+                    phasors,
+                    {
+                        .x_m = pixel_x_m.data( ),
+                        .y_m = pixel_y_m.data( ),
+                        .z_m = pixel_z_m.data( ),
+                    },
+                    scratch,
+                    {
+                        .csb = output.csb.data( ) + row_offset,
+                        .sbo = output.sbo.data( ) + row_offset,
+                        .ddm = write_ddm ? ( output.ddm.data( ) + row_offset ) : nullptr,
+                    }
+                );
+            }
+        }
+    );
+
+    return utils::success( );
+}
+
+auto FieldEvaluator::evaluate( glm::ivec2 const field_size_pixels, FieldOutput const output ) const
+    -> utils::Result< void >
+{
+    return evaluate(
+        field_size_pixels,
+        math::Range2Di{ .min = glm::ivec2{ 0, 0 }, .max = field_size_pixels },
+        output
+    );
+}
+
+auto FieldEvaluator::evaluate_points( PointsView const points, FieldOutput const output ) const
+    -> utils::Result< void >
+{
+    LTB_CHECK_VALID( params_.antenna_pairs >= 0 );
+
+    auto const total_size = points.x_m.size( );
+
+    if ( ( points.y_m.size( ) != total_size ) || ( output.csb.size( ) != total_size )
+         || ( output.sbo.size( ) != total_size ) )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "Point output size mismatch. Got x: {}, y: {}, csb: {}, sbo: {}",
+            total_size,
+            points.y_m.size( ),
+            output.csb.size( ),
+            output.sbo.size( )
+        );
+    }
+
+    auto const explicit_heights = !points.z_m.empty( );
+    if ( explicit_heights )
+    {
+        LTB_CHECK_VALID( points.z_m.size( ) == total_size );
+    }
+
+    auto const write_ddm = !output.ddm.empty( );
+    if ( write_ddm )
+    {
+        LTB_CHECK_VALID(
+            Summation::Phasor == params_.summation,
+            "DDM is only defined for phasor summation"
+        );
+        LTB_CHECK_VALID( output.ddm.size( ) == total_size );
+    }
+
+    auto const sources      = make_sources( params_ );
+    auto const phasors      = element_phasors( params_ );
+    auto const scratch_rows = scratch_row_count( params_ );
+
+    // Shared by every block when the points don't carry their own heights.
+    auto const default_z_m = std::vector< float32 >(
+        explicit_heights ? 0_UZ : std::min( points_per_block, total_size ),
+        params_.receiver_height_m
+    );
+
+    auto block_starts = std::vector< std::size_t >{ };
+    for ( auto i = 0_UZ; i < total_size; i += points_per_block )
+    {
+        block_starts.push_back( i );
+    }
+
+    std::for_each(
+        std::execution::par,
+        block_starts.begin( ),
+        block_starts.end( ),
+        [ & ]( std::size_t const block_start )
+        {
+            auto const block_size = std::min( points_per_block, total_size - block_start );
+            auto       scratch    = RowScratch{ scratch_rows, block_size };
+
+            evaluate_row(
+                params_,
+                sources,
+                phasors,
+                {
+                    .x_m = points.x_m.data( ) + block_start,
+                    .y_m = points.y_m.data( ) + block_start,
+                    .z_m = explicit_heights ? ( points.z_m.data( ) + block_start )
+                                            : default_z_m.data( ),
+                },
+                scratch,
+                {
+                    .csb = output.csb.data( ) + block_start,
+                    .sbo = output.sbo.data( ) + block_start,
+                    .ddm = write_ddm ? ( output.ddm.data( ) + block_start ) : nullptr,
+                }
+            );
+        }
+    );
+
+    return utils::success( );
+}
+
+auto FieldEvaluator::evaluate_colors(
+    glm::ivec2 const             field_size_pixels,
+    math::Range2Di const&        region,
+    std::span< glm::vec3 > const colors
+) const -> utils::Result< void >
+{
+    auto const region_size = dimensions( region );
+    auto const total_size  = utils::total_size( region_size.x, region_size.y );
+    LTB_CHECK_VALID( colors.size( ) == total_size );
+
+    auto const phasor_summation = ( Summation::Phasor == params_.summation );
+
+    auto csb = std::vector< float32 >( total_size );
+    auto sbo = std::vector< float32 >( total_size );
+    auto ddm = std::vector< float32 >( phasor_summation ? total_size : 0_UZ );
+    LTB_CHECK( evaluate(
+        field_size_pixels,
+        region,
+        FieldOutput{ .csb = csb, .sbo = sbo, .ddm = ddm }
+    ) );
+
+    for ( auto i = 0_UZ; i < total_size; ++i )
+    {
+        auto const signal_x = phasor_summation ? ddm[ i ] : 1.0F;
+        colors[ i ]         = color( glm::vec3( signal_x, csb[ i ], sbo[ i ] ) );
+    }
+
+    return utils::success( );
+}
+
+auto FieldEvaluator::evaluate_colors(
+    glm::ivec2 const             field_size_pixels,
+    std::span< glm::vec3 > const colors
+) const -> utils::Result< void >
+{
+    return evaluate_colors(
+        field_size_pixels,
+        math::Range2Di{ .min = glm::ivec2{ 0, 0 }, .max = field_size_pixels },
+        colors
+    );
+}
+
+auto FieldEvaluator::evaluate_point( glm::vec2 const position_m ) const -> glm::vec3
+{
+    return evaluate_point( glm::vec3( position_m, params_.receiver_height_m ) );
+}
+
+auto FieldEvaluator::evaluate_point( glm::vec3 const position_m ) const -> glm::vec3
+{
+    auto const sources   = make_sources( params_ );
+    auto const antennas  = sources.antennas.size( );
+    auto const reference = reference_phase( position_m, sources.center_m );
+
+    auto antenna_values = std::vector< glm::vec2 >( antennas );
+    for ( auto i = 0_UZ; i < antennas; ++i )
+    {
+        antenna_values[ i ] = received_value( sources, i, position_m, reference );
+    }
+
+    auto signal = glm::vec3( 1.0F, 0.0F, 0.0F );
+
+    switch ( params_.summation )
+    {
+        using enum Summation;
+        case Pairwise:
+            for ( auto i = 0_UZ; i < antennas; ++i )
+            {
+                for ( auto j = i + 1_UZ; j < antennas; ++j )
+                {
+                    signal.y += glm::length( antenna_values[ i ] + antenna_values[ j ] );
+                    signal.z += glm::length( antenna_values[ i ] - antenna_values[ j ] );
+                }
+            }
+            break;
+
+        case Phasor:
+        {
+            auto const phasors = element_phasors( params_ );
+
+            auto csb = glm::vec2( 0.0F );
+            auto sbo = glm::vec2( 0.0F );
+            for ( auto i = 0_UZ; i < antennas; ++i )
+            {
+                csb += cmul( antenna_values[ i ], glm::vec2( phasors[ i ].x, phasors[ i ].y ) );
+                sbo += cmul( antenna_values[ i ], glm::vec2( phasors[ i ].z, phasors[ i ].w ) );
+            }
+            signal = glm::vec3( ddm( csb, sbo ), glm::length( csb ), glm::length( sbo ) );
+            break;
+        }
+    }
+
+    return signal;
+}
+
+auto FieldEvaluator::color( glm::vec3 const signal ) const -> glm::vec3
+{
+    return ( signal * params_.output_scale ) + params_.output_scale;
+}
+
+} // namespace ltb::ils
@@ -0,0 +1,387 @@
+
+// project
+#include "ltb/ils/constants.hpp"
+#include "ltb/ils/field_evaluator.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+#include <gtest/gtest.h>
+
+// standard
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+// A line-for-line port of `res/shaders/ils.frag` used as the reference.
+struct IlsFrag
+{
+    float32   pixel_size_m      = 1.0F;
+    int32     antenna_pairs     = 1;
+    float32   antenna_spacing_m = 5.0F;
+    float32   antenna_height_m  = 0.0F;
+    float32   receiver_height_m = 0.0F;
+    glm::vec3 output_scale      = { 0.1F, 0.0F, 0.0F };
+    glm::vec2 field_size_pixels = { };
+    glm::vec2 gl_frag_coord     = { };
+
+    static constexpr auto power = 100000.0F;
+    static constexpr auto c     = 299.792458F;
+    static constexpr auto pi    = 3.14159265359F;
+
+    static auto reference_phase( glm::vec3 position, glm::vec3 center, float32 frequency )
+        -> glm::vec2
+    {
+        auto reference_m  = glm::length( position - center );
+        auto microseconds = reference_m / c;
+        auto cycles       = frequency * microseconds;
+        return { reference_m, cycles - std::floor( cycles ) };
+    }
+
+    static auto value(
+        glm::vec3 position,
+        glm::vec3 antenna,
+        glm::vec3 center,
+        glm::vec2 reference,
+        float32   frequency
+    ) -> glm::vec2
+    {
+        auto dist_meters = glm::length( position - antenna );
+
+        auto path_difference_m = glm::dot( antenna - center, antenna + center - 2.0F * position )
+                               / ( dist_meters + reference.x );
+
+        auto microseconds = path_difference_m / c;
+        auto phase_angle  = reference.y + frequency * microseconds;
+        auto radians      = phase_angle * 2.0F * pi;
+        auto intensity    = power / ( dist_meters * dist_meters );
+        return glm::vec2( std::cos( radians ), std::sin( radians ) ) * intensity;
+    }
+
+    auto main( ) const -> glm::vec3
+    {
+        constexpr auto loc_freq = 110.1F;
+
+        auto half_frame_height = field_size_pixels.y * 0.5F;
+        auto pixel_pos = glm::vec2( gl_frag_coord.x, half_frame_height - gl_frag_coord.y );
+        auto position  = glm::vec3( pixel_pos * pixel_size_m, receiver_height_m );
+        auto center    = glm::vec3( 0.0F, 0.0F, antenna_height_m );
+
+        auto signal    = glm::vec3( 1.0F, 0.0F, 0.0F );
+        auto reference = reference_phase( position, center, loc_freq );
+
+        auto min_antenna_pos
+            = ( static_cast< float32 >( antenna_pairs ) - 0.5F ) * antenna_spacing_m;
+
+        for ( auto i = 0; i < antenna_pairs * 2; ++i )
+        {
+            auto antenna_i_pos = glm::vec3(
+                0.0F,
+                -min_antenna_pos + antenna_spacing_m * static_cast< float32 >( i ),
+                antenna_height_m
+            );
+            auto i_value_carrier_c
+                = value( position, antenna_i_pos, center, reference, loc_freq );
+
+            for ( auto j = i; j < antenna_pairs * 2; ++j )
+            {
+                if ( i != j )
+                {
+                    auto antenna_j_pos = glm::vec3(
+                        0.0F,
+                        -min_antenna_pos + antenna_spacing_m * static_cast< float32 >( j ),
+                        antenna_height_m
+                    );
+                    auto j_value_carrier_c
+                        = value( position, antenna_j_pos, center, reference, loc_freq );
+
+                    signal.y += glm::length( i_value_carrier_c + j_value_carrier_c );
+                    signal.z += glm::length( i_value_carrier_c - j_value_carrier_c );
+                }
+            }
+        }
+
+        return ( signal * output_scale ) + output_scale;
+    }
+};
+
+/// \brief The phasor-summed (DDM, CSB, SBO) computed directly in float64.
+auto reference_signal( ils::FieldParams const& params, glm::dvec2 const position ) -> glm::dvec3
+{
+    using Consts = ils::Constants< float64 >;
+
+    auto const excitations = ils::default_excitations( params.antenna_pairs );
+    auto const spacing     = static_cast< float64 >( params.antenna_spacing_m );
+    auto const min_pos     = ( static_cast< float64 >( params.antenna_pairs ) - 0.5 ) * spacing;
+
+    auto const cmul = []( glm::dvec2 const a, glm::dvec2 const b ) -> glm::dvec2
+    { return { ( a.x * b.x ) - ( a.y * b.y ), ( a.x * b.y ) + ( a.y * b.x ) }; };
+
+    auto csb = glm::dvec2( 0.0 );
+    auto sbo = glm::dvec2( 0.0 );
+    for ( auto i = 0_UZ; i < excitations.size( ); ++i )
+    {
+        auto const antenna_y = -min_pos + ( spacing * static_cast< float64 >( i ) );
+        auto const dist      = glm::distance( position, glm::dvec2( 0.0, antenna_y ) );
+        auto const cycles
+            = Consts::localizer_frequency_mhz( ) * dist / Consts::speed_of_light_m_us( );
+        auto const radians   = glm::two_pi< float64 >( ) * cycles;
+        auto const intensity = Consts::antenna_power( ) / ( dist * dist );
+        auto const value = glm::dvec2( std::cos( radians ), std::sin( radians ) ) * intensity;
+
+        auto const feed = glm::dvec4( ils::excitation_phasors( excitations[ i ] ) );
+        csb += cmul( value, glm::dvec2( feed.x, feed.y ) );
+        sbo += cmul( value, glm::dvec2( feed.z, feed.w ) );
+    }
+
+    auto const ddm = 2.0 * glm::dot( sbo, csb ) / glm::dot( csb, csb );
+    return { ddm, glm::length( csb ), glm::length( sbo ) };
+}
+
+auto expect_matches_shader( ils::FieldParams const& params, glm::ivec2 const size ) -> void
+{
+    auto const evaluator = ils::FieldEvaluator{ params };
+
+    auto colors = std::vector< glm::vec3 >( utils::total_size( size.x, size.y ) );
+    ASSERT_TRUE( evaluator.evaluate_colors( size, colors ) );
+
+    auto frag = IlsFrag{
+        .pixel_size_m      = params.pixel_size_m,
+        .antenna_pairs     = params.antenna_pairs,
+        .antenna_spacing_m = params.antenna_spacing_m,
+        .antenna_height_m  = params.antenna_height_m,
+        .receiver_height_m = params.receiver_height_m,
+        .output_scale      = params.output_scale,
+        .field_size_pixels = glm::vec2( size ),
+    };
+
+    for ( auto y = 0; y < size.y; ++y )
+    {
+        for ( auto x = 0; x < size.x; ++x )
+        {
+            frag.gl_frag_coord = glm::vec2(
+                static_cast< float32 >( x ) + 0.5F,
+                static_cast< float32 >( y ) + 0.5F
+            );
+
+            auto const expected = frag.main( );
+            auto const actual   = colors[ utils::array_index( x, y, size.x ) ];
+
+            // The evaluator keeps the shader's operation order, so only the
+            // compiler's choice of fused multiply-adds can change the result.
+            EXPECT_NEAR( actual.x, expected.x, std::abs( expected.x ) * 1.0e-5F );
+            EXPECT_NEAR( actual.y, expected.y, std::abs( expected.y ) * 1.0e-5F );
+            EXPECT_NEAR( actual.z, expected.z, std::abs( expected.z ) * 1.0e-5F );
+        }
+    }
+}
+
+TEST( FieldEvaluatorTests, MatchesShaderSinglePair )
+{
+    expect_matches_shader(
+        {
+            .pixel_size_m      = 1.0F,
+            .antenna_pairs     = 1,
+            .antenna_spacing_m = 5.0F,
+            .output_scale      = { 0.1F, 0.1F, 0.1F },
+        },
+        { 64, 48 }
+    );
+}
+
+TEST( FieldEvaluatorTests, MatchesShaderManyPairs )
+{
+    expect_matches_shader(
+        {
+            .pixel_size_m      = 2.5F,
+            .antenna_pairs     = 6,
+            .antenna_spacing_m = 1.3F,
+            .output_scale      = { 0.0F, 1.0F / 60.0F, 1.0F / 60.0F },
+        },
+        { 37, 53 }
+    );
+}
+
+TEST( FieldEvaluatorTests, MatchesShaderAboveGround )
+{
+    expect_matches_shader(
+        {
+            .pixel_size_m      = 2.0F,
+            .antenna_pairs     = 4,
+            .antenna_spacing_m = 2.5F,
+            .output_scale      = { 0.0F, 0.05F, 0.05F },
+            .antenna_height_m  = 2.0F,
+            .receiver_height_m = 30.0F,
+        },
+        { 41, 29 }
+    );
+}
+
+TEST( FieldEvaluatorTests, RegionMatchesFullField )
+{
+    auto const evaluator = ils::FieldEvaluator{ {
+        .pixel_size_m      = 0.5F,
+        .antenna_pairs     = 3,
+        .antenna_spacing_m = 2.0F,
+    } };
+
+    constexpr auto size       = glm::ivec2{ 40, 40 };
+    constexpr auto total_size = utils::total_size( size.x, size.y );
+
+    auto full_csb = std::vector< float32 >( total_size );
+    auto full_sbo = std::vector< float32 >( total_size );
+    ASSERT_TRUE( evaluator.evaluate( size, { .csb = full_csb, .sbo = full_sbo } ) );
+
+    auto const region      = math::Range2Di{ .min = { 5, 17 }, .max = { 31, 40 } };
+    auto const region_size = dimensions( region );
+
+    auto csb = std::vector< float32 >( utils::total_size( region_size.x, region_size.y ) );
+    auto sbo = std::vector< float32 >( csb.size( ) );
+    ASSERT_TRUE( evaluator.evaluate( size, region, { .csb = csb, .sbo = sbo } ) );
+
+    for ( auto y = 0; y < region_size.y; ++y )
+    {
+        for ( auto x = 0; x < region_size.x; ++x )
+        {
+            auto const full_index
+                = utils::array_index( x + region.min.x, y + region.min.y, size.x );
+            auto const index = utils::array_index( x, y, region_size.x );
+
+            EXPECT_EQ( csb[ index ], full_csb[ full_index ] );
+            EXPECT_EQ( sbo[ index ], full_sbo[ full_index ] );
+        }
+    }
+}
+
+TEST( FieldEvaluatorTests, PhasorMatchesPairwiseForSinglePair )
+{
+    // With one pair, the default CSB feed sums the two phasors and the 90° shifted,
+    // antisymmetric SBO feed gives the magnitude of their difference.
+    auto params = ils::FieldParams{
+        .pixel_size_m      = 1.5F,
+        .antenna_pairs     = 1,
+        .antenna_spacing_m = 4.0F,
+    };
+
+    constexpr auto size       = glm::ivec2{ 32, 24 };
+    constexpr auto total_size = utils::total_size( size.x, size.y );
+
+    auto pairwise_csb = std::vector< float32 >( total_size );
+    auto pairwise_sbo = std::vector< float32 >( total_size );
+    ASSERT_TRUE(
+        ils::FieldEvaluator{ params }.evaluate( size, { .csb = pairwise_csb, .sbo = pairwise_sbo } )
+    );
+
+    params.summation = ils::Summation::Phasor;
+
+    auto phasor_csb = std::vector< float32 >( total_size );
+    auto phasor_sbo = std::vector< float32 >( total_size );
+    ASSERT_TRUE(
+        ils::FieldEvaluator{ params }.evaluate( size, { .csb = phasor_csb, .sbo = phasor_sbo } )
+    );
+
+    for ( auto i = 0_UZ; i < total_size; ++i )
+    {
+        EXPECT_NEAR( phasor_csb[ i ], pairwise_csb[ i ], pairwise_csb[ i ] * 1.0e-5F );
+        EXPECT_NEAR( phasor_sbo[ i ], pairwise_sbo[ i ], pairwise_csb[ i ] * 1.0e-5F );
+    }
+}
+
+TEST( FieldEvaluatorTests, PhasorDdmIsAntisymmetric )
+{
+    auto const evaluator = ils::FieldEvaluator{ {
+        .pixel_size_m      = 2.0F,
+        .antenna_pairs     = 6,
+        .antenna_spacing_m = 1.3F,
+        .summation         = ils::Summation::Phasor,
+    } };
+
+    // An even number of rows puts the course line between the two middle rows.
+    constexpr auto size       = glm::ivec2{ 50, 40 };
+    constexpr auto total_size = utils::total_size( size.x, size.y );
+
+    auto csb = std::vector< float32 >( total_size );
+    auto sbo = std::vector< float32 >( total_size );
+    auto ddm = std::vector< float32 >( total_size );
+    ASSERT_TRUE( evaluator.evaluate( size, { .csb = csb, .sbo = sbo, .ddm = ddm } ) );
+
+    for ( auto y = 0; y < size.y / 2; ++y )
+    {
+        for ( auto x = 0; x < size.x; ++x )
+        {
+            auto const index          = utils::array_index( x, y, size.x );
+            auto const mirrored_index = utils::array_index( x, size.y - 1 - y, size.x );
+
+            EXPECT_NEAR( csb[ index ], csb[ mirrored_index ], csb[ index ] * 1.0e-4F );
+            EXPECT_NEAR( ddm[ index ], -ddm[ mirrored_index ], 1.0e-3F );
+
+            auto const point = evaluator.evaluate_point( glm::vec2(
+                ( static_cast< float32 >( x ) + 0.5F ) * 2.0F,
+                ( 20.0F - ( static_cast< float32 >( y ) + 0.5F ) ) * 2.0F
+            ) );
+            EXPECT_NEAR( point.x, ddm[ index ], 1.0e-3F );
+            EXPECT_NEAR( point.y, csb[ index ], csb[ index ] * 1.0e-4F );
+        }
+    }
+}
+
+TEST( FieldEvaluatorTests, PhaseStaysAccurateAtLongRange )
+{
+    auto const params = ils::FieldParams{
+        .antenna_pairs     = 6,
+        .antenna_spacing_m = 1.3F,
+        .summation         = ils::Summation::Phasor,
+    };
+    auto const evaluator = ils::FieldEvaluator{ params };
+
+    // Thousands of carrier cycles out, where a float32 phase has no fractional bits left.
+    for ( auto const range_m : { 1'000.0F, 5'000.0F, 10'000.0F, 20'000.0F } )
+    {
+        for ( auto step = -20; step <= 20; ++step )
+        {
+            auto const angle    = static_cast< float32 >( step ) * 0.005F;
+            auto const position = glm::vec2( std::cos( angle ), std::sin( angle ) ) * range_m;
+
+            auto const actual   = evaluator.evaluate_point( position );
+            auto const expected = reference_signal( params, glm::dvec2( position ) );
+
+            EXPECT_NEAR( actual.x, expected.x, 1.0e-3 ) << range_m << " m, " << angle << " rad";
+            EXPECT_NEAR( actual.y, expected.y, expected.y * 1.0e-4 );
+            EXPECT_NEAR( actual.z, expected.z, expected.y * 1.0e-4 );
+        }
+    }
+}
+
+TEST( FieldEvaluatorTests, DdmRequiresPhasorSummation )
+{
+    auto const evaluator = ils::FieldEvaluator{ };
+
+    auto csb = std::vector< float32 >( 4 );
+    auto sbo = std::vector< float32 >( 4 );
+    auto ddm = std::vector< float32 >( 4 );
+    EXPECT_FALSE( evaluator.evaluate( { 2, 2 }, { .csb = csb, .sbo = sbo, .ddm = ddm } ) );
+}
+
+TEST( FieldEvaluatorTests, RejectsMismatchedOutput )
+{
+    auto const evaluator = ils::FieldEvaluator{ };
+
+    auto csb = std::vector< float32 >( 10 );
+    auto sbo = std::vector< float32 >( 11 );
+    EXPECT_FALSE( evaluator.evaluate( { 2, 5 }, { .csb = csb, .sbo = sbo } ) );
+
+    sbo.resize( 10 );
+    EXPECT_TRUE( evaluator.evaluate( { 2, 5 }, { .csb = csb, .sbo = sbo } ) );
+    EXPECT_FALSE( evaluator.evaluate(
+        { 2, 5 },
+        math::Range2Di{ .min = { 0, 0 }, .max = { 2, 6 } },
+        { .csb = csb, .sbo = sbo }
+    ) );
+}
+
+} // namespace
+} // namespace ltb
@@ -0,0 +1,81 @@
+#include "ltb/ils/field_export.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// standard
+#include <algorithm>
+#include <array>
+#include <span>
+#include <vector>
+
+namespace ltb::ils
+{
+
+auto field_export_layout(
+    FieldParams const& params,
+    glm::ivec2 const   field_size_pixels,
+    glm::ivec2 const   tile_size
+) -> utils::TiledFieldLayout
+{
+    auto const pixel_size_m = static_cast< float64 >( params.pixel_size_m );
+    auto const half_height  = static_cast< float64 >( field_size_pixels.y ) * 0.5;
+
+    // Pixel (x, y) is centered at ((x + 0.5) * size, (height / 2 - y - 0.5) * size).
+    return {
+        .size_pixels   = field_size_pixels,
+        .tile_size     = tile_size,
+        .channel_count = ( Summation::Phasor == params.summation ) ? 3 : 2,
+        .origin_m      = { 0.5 * pixel_size_m, ( half_height - 0.5 ) * pixel_size_m },
+        .pixel_step_m  = { pixel_size_m, -pixel_size_m },
+    };
+}
+
+auto export_field(
+    FieldEvaluator const&        evaluator,
+    glm::ivec2 const             field_size_pixels,
+    std::filesystem::path const& path,
+    glm::ivec2 const             tile_size
+) -> utils::Result< void >
+{
+    LTB_CHECK_VALID( ( field_size_pixels.x > 0 ) && ( field_size_pixels.y > 0 ) );
+
+    auto const layout = field_export_layout( evaluator.params( ), field_size_pixels, tile_size );
+    LTB_CHECK( auto writer, utils::TiledFieldWriter::create( path, layout ) );
+
+    auto const band_size = utils::total_size( field_size_pixels.x, tile_size.y );
+    auto       csb       = std::vector< float32 >( band_size );
+    auto       sbo       = std::vector< float32 >( band_size );
+    auto       ddm       = std::vector< float32 >( 3 == layout.channel_count ? band_size : 0_UZ );
+
+    for ( auto first_row = 0; first_row < field_size_pixels.y; first_row += tile_size.y )
+    {
+        auto const last_row = std::min( first_row + tile_size.y, field_size_pixels.y );
+        auto const band     = math::Range2Di{
+            .min = { 0, first_row },
+            .max = { field_size_pixels.x, last_row },
+        };
+        auto const count = utils::total_size( band.max.x, band.max.y - band.min.y );
+
+        auto const output = FieldOutput{
+            .csb = std::span( csb ).first( count ),
+            .sbo = std::span( sbo ).first( count ),
+            .ddm = std::span( ddm ).first( ddm.empty( ) ? 0_UZ : count ),
+        };
+        LTB_CHECK( evaluator.evaluate( field_size_pixels, band, output ) );
+
+        auto const channels = std::array< std::span< float32 const >, 3 >{
+            output.csb,
+            output.sbo,
+            output.ddm,
+        };
+        LTB_CHECK( writer.write_rows(
+            first_row,
+            std::span( channels ).first( static_cast< std::size_t >( layout.channel_count ) )
+        ) );
+    }
+
+    return writer.finish( );
+}
+
+} // namespace ltb::ils
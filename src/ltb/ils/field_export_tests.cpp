@@ -0,0 +1,57 @@
+// project
+#include "ltb/ils/field_export.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <gtest/gtest.h>
+
+// standard
+#include <filesystem>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+TEST( FieldExportTests, ExportedFieldMatchesEvaluation )
+{
+    auto const path      = std::filesystem::temp_directory_path( ) / "ltb_field_export.bin";
+    auto const size      = glm::ivec2{ 300, 170 };
+    auto const evaluator = ils::FieldEvaluator{ {
+        .pixel_size_m      = 25.0F,
+        .antenna_pairs     = 4,
+        .antenna_spacing_m = 1.5F,
+        .summation         = ils::Summation::Phasor,
+    } };
+
+    ASSERT_TRUE( ils::export_field( evaluator, size, path, { 64, 32 } ) );
+
+    auto const count = utils::total_size( size.x, size.y );
+    auto       csb   = std::vector< float32 >( count );
+    auto       sbo   = std::vector< float32 >( count );
+    auto       ddm   = std::vector< float32 >( count );
+    ASSERT_TRUE( evaluator.evaluate( size, { .csb = csb, .sbo = sbo, .ddm = ddm } ) );
+
+    auto const reader = utils::TiledFieldReader::open( path );
+    ASSERT_TRUE( reader );
+    ASSERT_EQ( reader->layout( ).channel_count, 3 );
+
+    auto values = std::vector< float32 >( count );
+    ASSERT_TRUE( reader->read( { .min = { 0, 0 }, .max = size }, 2, values ) );
+    EXPECT_EQ( values, ddm );
+    ASSERT_TRUE( reader->read( { .min = { 0, 0 }, .max = size }, 0, values ) );
+    EXPECT_EQ( values, csb );
+
+    // The layout maps pixels back to the positions they were evaluated at.
+    auto const& layout   = reader->layout( );
+    auto const  pixel    = glm::ivec2{ 123, 45 };
+    auto const  position = layout.origin_m + ( glm::dvec2( pixel ) * layout.pixel_step_m );
+    auto const  signal   = evaluator.evaluate_point( glm::vec2( position ) );
+    EXPECT_NEAR( reader->value( pixel, 1 ), signal.z, 1.0e-6F );
+
+    std::filesystem::remove( path );
+}
+
+} // namespace
+} // namespace ltb
@@ -0,0 +1,276 @@
+#include "ltb/ils/flight_receiver.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// standard
+#include <algorithm>
+#include <cmath>
+
+namespace ltb::ils
+{
+namespace
+{
+
+// Both tones complete whole cycles in one period of their 30 Hz difference.
+constexpr auto demodulation_window_hz = 30.0;
+
+constexpr auto ninety_hz_frequency    = 90.0;
+constexpr auto one_fifty_hz_frequency = 150.0;
+
+/// \brief The trajectory position at \p time_s, held constant outside its time span.
+auto position_at( TrajectoryView const& trajectory, float64 const time_s ) -> glm::vec3
+{
+    auto const& times = trajectory.time_s;
+
+    auto const after = static_cast< std::size_t >(
+        std::upper_bound( times.begin( ), times.end( ), time_s ) - times.begin( )
+    );
+
+    auto const at = [ &trajectory ]( std::size_t const i ) -> glm::vec3
+    { return { trajectory.x_m[ i ], trajectory.y_m[ i ], trajectory.z_m[ i ] }; };
+
+    if ( 0_UZ == after )
+    {
+        return at( 0_UZ );
+    }
+    if ( times.size( ) == after )
+    {
+        return at( after - 1_UZ );
+    }
+
+    auto const before = after - 1_UZ;
+    auto const t      = static_cast< float32 >(
+        ( time_s - times[ before ] ) / ( times[ after ] - times[ before ] )
+    );
+    return at( before ) + ( ( at( after ) - at( before ) ) * t );
+}
+
+} // namespace
+
+FlightReceiver::FlightReceiver( FieldParams field, ReceiverParams params )
+    : evaluator_( std::move( field ) )
+    , params_( params )
+    , demodulator_( params_.sample_rate_hz, params_.start_time_s )
+    , impairments_( params_.impairments, params_.sample_rate_hz )
+{
+    auto field_params      = evaluator_.params( );
+    field_params.summation = Summation::Phasor;
+    evaluator_.set_params( std::move( field_params ) );
+
+    auto const step = 1.0 / params_.sample_rate_hz;
+    ninety_hz_      = dsp::Oscillator{ ninety_hz_frequency, params_.start_time_s, step };
+    one_fifty_hz_   = dsp::Oscillator{ one_fifty_hz_frequency, params_.start_time_s, step };
+}
+
+auto FlightReceiver::params( ) const -> ReceiverParams const&
+{
+    return params_;
+}
+
+auto FlightReceiver::sample_count( ) const -> std::size_t
+{
+    return sample_count_;
+}
+
+auto FlightReceiver::time_s( ) const -> float64
+{
+    return params_.start_time_s
+         + ( static_cast< float64 >( sample_count_ ) / params_.sample_rate_hz );
+}
+
+auto FlightReceiver::process( TrajectoryView const trajectory, ReceiverOutput const output )
+    -> utils::Result< void >
+{
+    LTB_CHECK_VALID(
+        ( params_.sample_rate_hz >= demodulation_window_hz )
+            && ( std::fmod( params_.sample_rate_hz, demodulation_window_hz ) == 0.0 ),
+        "The sample rate must be a positive multiple of 30 Hz"
+    );
+    LTB_CHECK_VALID( ( params_.field_update_samples > 0_UZ ) && ( params_.block_size > 0_UZ ) );
+
+    auto const points = trajectory.time_s.size( );
+    LTB_CHECK_VALID( points > 0_UZ, "The trajectory is empty" );
+    if ( ( trajectory.x_m.size( ) != points ) || ( trajectory.y_m.size( ) != points )
+         || ( trajectory.z_m.size( ) != points ) )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "Trajectory size mismatch. Got t: {}, x: {}, y: {}, z: {}",
+            points,
+            trajectory.x_m.size( ),
+            trajectory.y_m.size( ),
+            trajectory.z_m.size( )
+        );
+    }
+    LTB_CHECK_VALID(
+        std::ranges::is_sorted( trajectory.time_s ),
+        "Trajectory times must be increasing"
+    );
+
+    auto const samples = output.envelope.size( );
+    if ( ( output.ninety_hz.size( ) != samples ) || ( output.one_fifty_hz.size( ) != samples )
+         || ( output.ddm.size( ) != samples ) )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "Receiver output size mismatch. Got envelope: {}, 90 Hz: {}, 150 Hz: {}, ddm: {}",
+            samples,
+            output.ninety_hz.size( ),
+            output.one_fifty_hz.size( ),
+            output.ddm.size( )
+        );
+    }
+
+    for ( auto block_start = 0_UZ; block_start < samples; block_start += params_.block_size )
+    {
+        auto const block_size = std::min( params_.block_size, samples - block_start );
+        LTB_CHECK( process_block(
+            trajectory,
+            {
+                .envelope     = output.envelope.subspan( block_start, block_size ),
+                .ninety_hz    = output.ninety_hz.subspan( block_start, block_size ),
+                .one_fifty_hz = output.one_fifty_hz.subspan( block_start, block_size ),
+                .ddm          = output.ddm.subspan( block_start, block_size ),
+            }
+        ) );
+    }
+
+    return utils::success( );
+}
+
+auto FlightReceiver::process_block( TrajectoryView const& trajectory, ReceiverOutput const& output )
+    -> utils::Result< void >
+{
+    auto const samples      = output.envelope.size( );
+    auto const update       = params_.field_update_samples;
+    auto const first_sample = sample_count_;
+
+    // Field nodes bracketing every sample in the block.
+    auto const first_node = first_sample / update;
+    auto const node_count = ( ( first_sample + samples - 1_UZ ) / update ) + 2_UZ - first_node;
+
+    for ( auto* const nodes :
+          { &node_x_m_, &node_y_m_, &node_z_m_, &node_csb_, &node_sbo_, &node_ddm_ } )
+    {
+        nodes->resize( node_count );
+    }
+
+    auto const node_step_s = static_cast< float64 >( update ) / params_.sample_rate_hz;
+    for ( auto j = 0_UZ; j < node_count; ++j )
+    {
+        auto const node_time_s
+            = params_.start_time_s + ( static_cast< float64 >( first_node + j ) * node_step_s );
+        auto const position = position_at( trajectory, node_time_s );
+
+        node_x_m_[ j ] = position.x;
+        node_y_m_[ j ] = position.y;
+        node_z_m_[ j ] = position.z;
+    }
+
+    LTB_CHECK( evaluator_.evaluate_points(
+        { .x_m = node_x_m_, .y_m = node_y_m_, .z_m = node_z_m_ },
+        { .csb = node_csb_, .sbo = node_sbo_, .ddm = node_ddm_ }
+    ) );
+
+    // Only the ratio S / C matters to the envelope shape. Its real part follows from the
+    // DDM and the size of its imaginary part from the magnitudes. The sign of the
+    // imaginary part doesn't change the envelope.
+    for ( auto j = 0_UZ; j < node_count; ++j )
+    {
+        auto const ratio = ( node_csb_[ j ] > 0.0F ) ? ( node_sbo_[ j ] / node_csb_[ j ] ) : 0.0F;
+        auto const real  = node_ddm_[ j ] * 0.5F;
+
+        node_ddm_[ j ] = real;
+        node_sbo_[ j ] = std::sqrt( std::max( ( ratio * ratio ) - ( real * real ), 0.0F ) );
+    }
+
+    auto const depth      = static_cast< float64 >( params_.modulation_depth );
+    auto const inv_update = 1.0F / static_cast< float32 >( update );
+
+    for ( auto i = 0_UZ; i < samples; ++i )
+    {
+        auto const sample = first_sample + i;
+        if ( 0_UZ == ( sample % dsp::Oscillator::reseed_interval ) )
+        {
+            ninety_hz_.reseed( sample );
+            one_fifty_hz_.reseed( sample );
+        }
+
+        auto const node = ( sample / update ) - first_node;
+        auto const t    = static_cast< float32 >( sample % update ) * inv_update;
+
+        auto const lerp = [ node, t ]( std::vector< float32 > const& values ) -> float64
+        { return values[ node ] + ( t * ( values[ node + 1_UZ ] - values[ node ] ) ); };
+
+        auto const amplitude = lerp( node_csb_ );
+        auto const real      = lerp( node_ddm_ );
+        auto const imag      = lerp( node_sbo_ );
+
+        auto const ninety    = ninety_hz_.phasor( );
+        auto const one_fifty = one_fifty_hz_.phasor( );
+
+        // |C (1 + m (a90 + a150)) + S (a90 - a150)|
+        //     == |C| |1 + m (a90 + a150) + (S / C) (a90 - a150)|
+        auto const sum        = ninety.y + one_fifty.y;
+        auto const difference = ninety.y - one_fifty.y;
+        auto const in_phase   = 1.0 + ( depth * sum ) + ( real * difference );
+        auto const quadrature = imag * difference;
+        auto const envelope
+            = amplitude * std::sqrt( ( in_phase * in_phase ) + ( quadrature * quadrature ) );
+
+        output.envelope[ i ] = static_cast< float32 >( envelope );
+
+        ninety_hz_.advance( );
+        one_fifty_hz_.advance( );
+    }
+
+    LTB_CHECK( impairments_.apply( output.envelope ) );
+    LTB_CHECK( demodulator_.process( output.envelope, output ) );
+
+    sample_count_ += samples;
+
+    return utils::success( );
+}
+
+auto simulate_flight(
+    FieldParams const&                                   field,
+    ReceiverParams const&                                params,
+    TrajectoryView const&                                trajectory,
+    std::function< void( ReceiverOutput const& ) > const on_block
+) -> utils::Result< void >
+{
+    LTB_CHECK_VALID( !trajectory.time_s.empty( ), "The trajectory is empty" );
+    LTB_CHECK_VALID( params.sample_rate_hz > 0.0 );
+
+    auto flight_params         = params;
+    flight_params.start_time_s = trajectory.time_s.front( );
+
+    auto const duration_s = trajectory.time_s.back( ) - trajectory.time_s.front( );
+    auto const samples
+        = static_cast< std::size_t >( std::floor( duration_s * params.sample_rate_hz ) ) + 1_UZ;
+
+    auto receiver = FlightReceiver{ field, flight_params };
+
+    auto const block_size   = std::max( params.block_size, 1_UZ );
+    auto       envelope     = std::vector< float32 >( block_size );
+    auto       ninety_hz    = std::vector< float32 >( block_size );
+    auto       one_fifty_hz = std::vector< float32 >( block_size );
+    auto       ddm          = std::vector< float32 >( block_size );
+
+    for ( auto block_start = 0_UZ; block_start < samples; block_start += block_size )
+    {
+        auto const count  = std::min( block_size, samples - block_start );
+        auto const output = ReceiverOutput{
+            .envelope     = std::span( envelope ).first( count ),
+            .ninety_hz    = std::span( ninety_hz ).first( count ),
+            .one_fifty_hz = std::span( one_fifty_hz ).first( count ),
+            .ddm          = std::span( ddm ).first( count ),
+        };
+
+        LTB_CHECK( receiver.process( trajectory, output ) );
+        on_block( output );
+    }
+
+    return utils::success( );
+}
+
+} // namespace ltb::ils
@@ -0,0 +1,167 @@
+
+// project
+#include "ltb/ils/flight_receiver.hpp"
+
+// external
+#include <gtest/gtest.h>
+
+// standard
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+auto const field_params = ils::FieldParams{
+    .antenna_pairs     = 6,
+    .antenna_spacing_m = 1.3F,
+    .summation         = ils::Summation::Phasor,
+};
+
+/// \brief Storage for a whole run of receiver samples.
+struct Samples
+{
+    std::vector< float32 > envelope;
+    std::vector< float32 > ninety_hz;
+    std::vector< float32 > one_fifty_hz;
+    std::vector< float32 > ddm;
+
+    explicit Samples( std::size_t const count )
+        : envelope( count )
+        , ninety_hz( count )
+        , one_fifty_hz( count )
+        , ddm( count )
+    {
+    }
+
+    auto output( std::size_t const offset, std::size_t const count ) -> ils::ReceiverOutput
+    {
+        return {
+            .envelope     = std::span( envelope ).subspan( offset, count ),
+            .ninety_hz    = std::span( ninety_hz ).subspan( offset, count ),
+            .one_fifty_hz = std::span( one_fifty_hz ).subspan( offset, count ),
+            .ddm          = std::span( ddm ).subspan( offset, count ),
+        };
+    }
+};
+
+TEST( FlightReceiverTests, StationaryReceiverMatchesFieldDdm )
+{
+    auto const params = ils::ReceiverParams{ .sample_rate_hz = 12'000.0 };
+
+    for ( auto const y_m : { 0.0F, 4.0F, -7.0F, 10.0F } )
+    {
+        auto const time_s = std::vector< float64 >{ 0.0 };
+        auto const x_m    = std::vector< float32 >{ 1'000.0F };
+        auto const y      = std::vector< float32 >{ y_m };
+        auto const z_m    = std::vector< float32 >{ 0.0F };
+
+        auto receiver = ils::FlightReceiver{ field_params, params };
+
+        // Two 30 Hz periods, so the second is fully settled.
+        auto samples = Samples{ 800 };
+        ASSERT_TRUE( receiver.process(
+            { .time_s = time_s, .x_m = x_m, .y_m = y, .z_m = z_m },
+            samples.output( 0, 800 )
+        ) );
+
+        auto const expected = ils::FieldEvaluator{ field_params }.evaluate_point(
+            glm::vec2( 1'000.0F, y_m )
+        );
+
+        for ( auto i = 400_UZ; i < 800_UZ; ++i )
+        {
+            EXPECT_NEAR( samples.ddm[ i ], expected.x, 2.0e-3F ) << y_m;
+            EXPECT_NEAR(
+                ( samples.ninety_hz[ i ] + samples.one_fifty_hz[ i ] ) * 0.5F,
+                params.modulation_depth,
+                2.0e-3F
+            );
+        }
+    }
+}
+
+TEST( FlightReceiverTests, ChunkedProcessingMatchesSingleCall )
+{
+    // A crossing of the course line 2 km out.
+    auto const time_s = std::vector< float64 >{ 0.0, 1.0 };
+    auto const x_m    = std::vector< float32 >{ 2'000.0F, 2'000.0F };
+    auto const y_m    = std::vector< float32 >{ -60.0F, 60.0F };
+    auto const z_m    = std::vector< float32 >{ 100.0F, 100.0F };
+    auto const path   = ils::TrajectoryView{ .time_s = time_s, .x_m = x_m, .y_m = y_m, .z_m = z_m };
+
+    auto const params = ils::ReceiverParams{ .block_size = 1'000 };
+    auto const count  = 48'001_UZ;
+
+    auto whole = Samples{ count };
+    {
+        auto receiver = ils::FlightReceiver{ field_params, params };
+        ASSERT_TRUE( receiver.process( path, whole.output( 0, count ) ) );
+        EXPECT_EQ( receiver.sample_count( ), count );
+    }
+
+    auto chunked = Samples{ count };
+    {
+        auto receiver = ils::FlightReceiver{ field_params, params };
+        auto offset   = 0_UZ;
+        for ( auto const chunk : { 1_UZ, 31_UZ, 4'000_UZ, 777_UZ, 20'000_UZ } )
+        {
+            ASSERT_TRUE( receiver.process( path, chunked.output( offset, chunk ) ) );
+            offset += chunk;
+        }
+        ASSERT_TRUE( receiver.process( path, chunked.output( offset, count - offset ) ) );
+    }
+
+    EXPECT_EQ( whole.envelope, chunked.envelope );
+    EXPECT_EQ( whole.ddm, chunked.ddm );
+
+    // Flying from the 150 Hz side to the 90 Hz side flips the DDM.
+    EXPECT_LT( whole.ddm[ 2'000 ] * whole.ddm[ count - 1 ], 0.0F );
+}
+
+TEST( FlightReceiverTests, SimulateFlightStreamsEverySample )
+{
+    auto const time_s = std::vector< float64 >{ 10.0, 10.5 };
+    auto const x_m    = std::vector< float32 >{ 3'000.0F, 2'965.0F };
+    auto const y_m    = std::vector< float32 >{ 5.0F, 5.0F };
+    auto const z_m    = std::vector< float32 >{ 150.0F, 148.0F };
+
+    auto blocks  = 0_UZ;
+    auto samples = 0_UZ;
+    ASSERT_TRUE( ils::simulate_flight(
+        field_params,
+        { .sample_rate_hz = 24'000.0, .block_size = 5'000 },
+        { .time_s = time_s, .x_m = x_m, .y_m = y_m, .z_m = z_m },
+        [ & ]( ils::ReceiverOutput const& output )
+        {
+            ++blocks;
+            samples += output.ddm.size( );
+        }
+    ) );
+
+    EXPECT_EQ( samples, 12'001_UZ );
+    EXPECT_EQ( blocks, 3_UZ );
+}
+
+TEST( FlightReceiverTests, RejectsInvalidInput )
+{
+    auto const time_s = std::vector< float64 >{ 0.0 };
+    auto const pos_m  = std::vector< float32 >{ 0.0F };
+    auto       out    = Samples{ 10 };
+
+    auto receiver = ils::FlightReceiver{ field_params, { .sample_rate_hz = 44'000.0 } };
+    EXPECT_FALSE( receiver.process(
+        { .time_s = time_s, .x_m = pos_m, .y_m = pos_m, .z_m = pos_m },
+        out.output( 0, 10 )
+    ) );
+
+    receiver = ils::FlightReceiver{ field_params, { } };
+    EXPECT_FALSE( receiver.process(
+        { .time_s = time_s, .x_m = pos_m, .y_m = { }, .z_m = pos_m },
+        out.output( 0, 10 )
+    ) );
+}
+
+} // namespace
+} // namespace ltb
@@ -0,0 +1,202 @@
+#include "ltb/ils/glide_slope.hpp"
+
+// project
+#include "ltb/ils/constants.hpp"
+#include "ltb/ils/excitation.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <execution>
+#include <vector>
+
+namespace ltb::ils
+{
+namespace
+{
+
+using Consts = Constants< float32 >;
+
+constexpr auto points_per_block = 1024_UZ;
+
+/// \brief The SBO feed relative to the CSB feed. Over a perfect ground the SBO/CSB ratio
+///        at elevation e is `2 cos(x)` with `x = (pi/2) sin(e) / sin(path)`, so the DDM
+///        is `4 a cos(x)`. It is negative below the path, where 150 Hz predominates.
+auto sbo_amplitude( GlideSlopeParams const& params ) -> float32
+{
+    auto const edge_rad
+        = ( 1.0F - Consts::glide_path_sector_fraction( ) ) * params.glide_path_rad;
+    auto const x
+        = glm::half_pi< float32 >( ) * std::sin( edge_rad ) / std::sin( params.glide_path_rad );
+    return -Consts::glide_path_sector_ddm( ) / ( 4.0F * std::cos( x ) );
+}
+
+/// \brief The mast, its two antennas and their ground images, in the order
+///        CSB, CSB image, SBO, SBO image.
+struct Mast
+{
+    glm::vec3                  foot_m    = { };
+    std::array< float32, 4 >   heights_m = { };
+    std::array< glm::vec2, 4 > feeds     = { };
+};
+
+auto make_mast( GlideSlopeParams const& params ) -> Mast
+{
+    auto const height_m = csb_antenna_height_m( params );
+    auto const sbo      = sbo_amplitude( params );
+
+    return {
+        .foot_m    = glm::vec3( params.mast_position_m, 0.0F ),
+        .heights_m = { height_m, -height_m, 2.0F * height_m, -2.0F * height_m },
+        .feeds     = {
+            glm::vec2( 1.0F, 0.0F ),
+            params.ground_coefficient,
+            glm::vec2( sbo, 0.0F ),
+            params.ground_coefficient * sbo,
+        },
+    };
+}
+
+/// \brief The received CSB (xy) and SBO (zw) phasors at \p position.
+///
+/// Like the localizer, each phase is the path difference from the foot of the mast,
+/// computed without cancellation. The phase shared by every source is dropped since
+/// it rotates the CSB and SBO equally.
+auto mast_phasors( Mast const& mast, glm::vec3 const position ) -> glm::vec4
+{
+    auto const to_foot     = position - mast.foot_m;
+    auto const horizontal2 = ( to_foot.x * to_foot.x ) + ( to_foot.y * to_foot.y );
+    auto const reference_m = std::sqrt( horizontal2 + ( to_foot.z * to_foot.z ) );
+
+    auto values = std::array< glm::vec2, 4 >{ };
+    for ( auto i = 0_UZ; i < values.size( ); ++i )
+    {
+        auto const height_m = mast.heights_m[ i ];
+        auto const dz       = to_foot.z - height_m;
+        auto const dist_m   = std::sqrt( horizontal2 + ( dz * dz ) );
+
+        // |p - a| - |p - f| == (a - f)·(a + f - 2p) / (|p - a| + |p - f|)
+        auto const path_difference_m
+            = height_m * ( height_m - ( 2.0F * to_foot.z ) ) / ( dist_m + reference_m );
+
+        auto const cycles = Consts::glide_slope_frequency_mhz( ) * path_difference_m
+                          / Consts::speed_of_light_m_us( );
+        auto const radians   = cycles * glm::two_pi< float32 >( );
+        auto const intensity = Consts::antenna_power( ) / ( dist_m * dist_m );
+        auto const value = glm::vec2( std::cos( radians ), std::sin( radians ) ) * intensity;
+
+        auto const feed = mast.feeds[ i ];
+        values[ i ]     = { ( value.x * feed.x ) - ( value.y * feed.y ),
+                            ( value.x * feed.y ) + ( value.y * feed.x ) };
+    }
+
+    auto const csb = values[ 0 ] + values[ 1 ];
+    auto const sbo = values[ 2 ] + values[ 3 ];
+    return { csb.x, csb.y, sbo.x, sbo.y };
+}
+
+} // namespace
+
+auto csb_antenna_height_m( GlideSlopeParams const& params ) -> float32
+{
+    auto const wavelength_m
+        = Consts::speed_of_light_m_us( ) / Consts::glide_slope_frequency_mhz( );
+    return wavelength_m / ( 4.0F * std::sin( params.glide_path_rad ) );
+}
+
+GlideSlopeEvaluator::GlideSlopeEvaluator( GlideSlopeParams params )
+    : params_( params )
+{
+}
+
+auto GlideSlopeEvaluator::set_params( GlideSlopeParams params ) -> void
+{
+    params_ = params;
+}
+
+auto GlideSlopeEvaluator::params( ) const -> GlideSlopeParams const&
+{
+    return params_;
+}
+
+auto GlideSlopeEvaluator::evaluate_points( PointsView const points, FieldOutput const output ) const
+    -> utils::Result< void >
+{
+    LTB_CHECK_VALID(
+        ( params_.glide_path_rad > 0.0F )
+            && ( params_.glide_path_rad < glm::half_pi< float32 >( ) ),
+        "Glide path angle must be between 0 and 90 degrees"
+    );
+
+    auto const total_size = points.x_m.size( );
+
+    if ( ( points.y_m.size( ) != total_size ) || ( points.z_m.size( ) != total_size )
+         || ( output.csb.size( ) != total_size ) || ( output.sbo.size( ) != total_size ) )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "Point output size mismatch. Got x: {}, y: {}, z: {}, csb: {}, sbo: {}",
+            total_size,
+            points.y_m.size( ),
+            points.z_m.size( ),
+            output.csb.size( ),
+            output.sbo.size( )
+        );
+    }
+
+    auto const write_ddm = !output.ddm.empty( );
+    if ( write_ddm )
+    {
+        LTB_CHECK_VALID( output.ddm.size( ) == total_size );
+    }
+
+    auto const mast = make_mast( params_ );
+
+    auto block_starts = std::vector< std::size_t >{ };
+    for ( auto i = 0_UZ; i < total_size; i += points_per_block )
+    {
+        block_starts.push_back( i );
+    }
+
+    std::for_each(
+        std::execution::par,
+        block_starts.begin( ),
+        block_starts.end( ),
+        [ & ]( std::size_t const block_start )
+        {
+            auto const block_end = std::min( block_start + points_per_block, total_size );
+            for ( auto i = block_start; i < block_end; ++i )
+            {
+                auto const phasors = mast_phasors(
+                    mast,
+                    { points.x_m[ i ], points.y_m[ i ], points.z_m[ i ] }
+                );
+                auto const csb = glm::vec2( phasors.x, phasors.y );
+                auto const sbo = glm::vec2( phasors.z, phasors.w );
+
+                output.csb[ i ] = glm::length( csb );
+                output.sbo[ i ] = glm::length( sbo );
+                if ( write_ddm )
+                {
+                    output.ddm[ i ] = ddm( csb, sbo );
+                }
+            }
+        }
+    );
+
+    return utils::success( );
+}
+
+auto GlideSlopeEvaluator::evaluate_point( glm::vec3 const position_m ) const -> glm::vec3
+{
+    auto const phasors = mast_phasors( make_mast( params_ ), position_m );
+    auto const csb     = glm::vec2( phasors.x, phasors.y );
+    auto const sbo     = glm::vec2( phasors.z, phasors.w );
+    return { ddm( csb, sbo ), glm::length( csb ), glm::length( sbo ) };
+}
+
+} // namespace ltb::ils
@@ -0,0 +1,114 @@
+
+// project
+#include "ltb/ils/constants.hpp"
+#include "ltb/ils/glide_slope.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+#include <gtest/gtest.h>
+
+// standard
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+using Consts = ils::Constants< float32 >;
+
+auto const params = ils::GlideSlopeParams{ };
+
+/// \brief A point \p range_m from the mast along the approach, at \p elevation_rad.
+auto approach_point( float32 const range_m, float32 const elevation_rad ) -> glm::vec3
+{
+    return {
+        params.mast_position_m.x + ( range_m * std::cos( elevation_rad ) ),
+        params.mast_position_m.y,
+        range_m * std::sin( elevation_rad ),
+    };
+}
+
+TEST( GlideSlopeTests, AntennaHeightsPutTheNullOnThePath )
+{
+    // λ / (4 sin 3°) for 334.4 MHz.
+    EXPECT_NEAR( ils::csb_antenna_height_m( params ), 4.282F, 1.0e-3F );
+
+    auto const evaluator = ils::GlideSlopeEvaluator{ params };
+
+    for ( auto const range_m : { 1'000.0F, 5'000.0F, 15'000.0F } )
+    {
+        auto const on_path
+            = evaluator.evaluate_point( approach_point( range_m, params.glide_path_rad ) );
+        EXPECT_NEAR( on_path.x, 0.0F, 2.0e-3F ) << range_m;
+        EXPECT_LT( on_path.z, on_path.y * 1.0e-2F ) << range_m;
+    }
+}
+
+TEST( GlideSlopeTests, FullScaleAtTheSectorEdges )
+{
+    auto const evaluator = ils::GlideSlopeEvaluator{ params };
+    auto const sector    = Consts::glide_path_sector_fraction( ) * params.glide_path_rad;
+
+    auto const below = evaluator.evaluate_point(
+        approach_point( 8'000.0F, params.glide_path_rad - sector )
+    );
+    auto const above = evaluator.evaluate_point(
+        approach_point( 8'000.0F, params.glide_path_rad + sector )
+    );
+
+    // 150 Hz predominates below the path, 90 Hz above it.
+    EXPECT_NEAR( below.x, -Consts::glide_path_sector_ddm( ), 2.0e-3F );
+    EXPECT_NEAR( above.x, Consts::glide_path_sector_ddm( ), 1.0e-2F );
+
+    // The DDM grows monotonically through the sector.
+    auto previous = -1.0F;
+    for ( auto step = -10; step <= 10; ++step )
+    {
+        auto const elevation
+            = params.glide_path_rad + ( sector * static_cast< float32 >( step ) / 10.0F );
+        auto const signal = evaluator.evaluate_point( approach_point( 8'000.0F, elevation ) );
+        EXPECT_GT( signal.x, previous ) << step;
+        previous = signal.x;
+    }
+}
+
+TEST( GlideSlopeTests, BatchedPointsMatchSinglePoints )
+{
+    auto const evaluator = ils::GlideSlopeEvaluator{ { .mast_position_m = { 2'500.0F, -150.0F } } };
+
+    auto x_m = std::vector< float32 >{ };
+    auto y_m = std::vector< float32 >{ };
+    auto z_m = std::vector< float32 >{ };
+    for ( auto i = 0; i < 3'000; ++i )
+    {
+        x_m.push_back( 2'600.0F + ( static_cast< float32 >( i ) * 5.0F ) );
+        y_m.push_back( static_cast< float32 >( ( i % 41 ) - 20 ) * 15.0F );
+        z_m.push_back( static_cast< float32 >( i % 97 ) * 8.0F );
+    }
+
+    auto csb = std::vector< float32 >( x_m.size( ) );
+    auto sbo = std::vector< float32 >( x_m.size( ) );
+    auto ddm = std::vector< float32 >( x_m.size( ) );
+    ASSERT_TRUE( evaluator.evaluate_points(
+        { .x_m = x_m, .y_m = y_m, .z_m = z_m },
+        { .csb = csb, .sbo = sbo, .ddm = ddm }
+    ) );
+
+    for ( auto i = 0_UZ; i < x_m.size( ); ++i )
+    {
+        auto const expected = evaluator.evaluate_point( { x_m[ i ], y_m[ i ], z_m[ i ] } );
+        EXPECT_EQ( ddm[ i ], expected.x );
+        EXPECT_EQ( csb[ i ], expected.y );
+        EXPECT_EQ( sbo[ i ], expected.z );
+    }
+
+    // Heights are required.
+    EXPECT_FALSE(
+        evaluator.evaluate_points( { .x_m = x_m, .y_m = y_m }, { .csb = csb, .sbo = sbo } )
+    );
+}
+
+} // namespace
+} // namespace ltb
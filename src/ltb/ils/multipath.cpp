@@ -0,0 +1,37 @@
+#include "ltb/ils/multipath.hpp"
+
+namespace ltb::ils
+{
+
+auto ground_plane( glm::vec2 const coefficient ) -> Reflector
+{
+    return { .coefficient = coefficient };
+}
+
+auto vertical_wall(
+    glm::vec2 const start_m,
+    glm::vec2 const end_m,
+    float32 const   height_m,
+    glm::vec2 const coefficient
+) -> Reflector
+{
+    auto const along     = end_m - start_m;
+    auto const direction = glm::normalize( along );
+    auto const center    = ( start_m + end_m ) * 0.5F;
+
+    return {
+        .center_m    = glm::vec3( center, height_m * 0.5F ),
+        .normal      = glm::vec3( -direction.y, direction.x, 0.0F ),
+        .tangent     = glm::vec3( direction, 0.0F ),
+        .half_size_m = glm::vec2( glm::length( along ), height_m ) * 0.5F,
+        .coefficient = coefficient,
+    };
+}
+
+auto mirror( glm::vec3 const point, Reflector const& reflector ) -> glm::vec3
+{
+    auto const distance = glm::dot( point - reflector.center_m, reflector.normal );
+    return point - ( reflector.normal * ( 2.0F * distance ) );
+}
+
+} // namespace ltb::ils
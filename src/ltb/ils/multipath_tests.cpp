@@ -0,0 +1,200 @@
+
+// project
+#include "ltb/ils/constants.hpp"
+#include "ltb/ils/course_analysis.hpp"
+#include "ltb/ils/field_evaluator.hpp"
+#include "ltb/ils/multipath.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+#include <gtest/gtest.h>
+
+// standard
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+/// \brief The phasor-summed (DDM, CSB, SBO) with each reflector's image of every
+///        antenna added explicitly, computed in float64. Every image is assumed visible.
+auto reference_signal( ils::FieldParams const& params, glm::dvec3 const position ) -> glm::dvec3
+{
+    using Consts = ils::Constants< float64 >;
+
+    auto const excitations = ils::default_excitations( params.antenna_pairs );
+    auto const spacing     = static_cast< float64 >( params.antenna_spacing_m );
+    auto const min_pos     = ( static_cast< float64 >( params.antenna_pairs ) - 0.5 ) * spacing;
+
+    auto const cmul = []( glm::dvec2 const a, glm::dvec2 const b ) -> glm::dvec2
+    { return { ( a.x * b.x ) - ( a.y * b.y ), ( a.x * b.y ) + ( a.y * b.x ) }; };
+
+    auto const phasor = [ & ]( glm::dvec3 const source ) -> glm::dvec2
+    {
+        auto const dist = glm::distance( position, source );
+        auto const cycles
+            = Consts::localizer_frequency_mhz( ) * dist / Consts::speed_of_light_m_us( );
+        auto const radians   = glm::two_pi< float64 >( ) * cycles;
+        auto const intensity = Consts::antenna_power( ) / ( dist * dist );
+        return glm::dvec2( std::cos( radians ), std::sin( radians ) ) * intensity;
+    };
+
+    auto csb = glm::dvec2( 0.0 );
+    auto sbo = glm::dvec2( 0.0 );
+    for ( auto i = 0_UZ; i < excitations.size( ); ++i )
+    {
+        auto const antenna = glm::vec3(
+            0.0F,
+            static_cast< float32 >( -min_pos + ( spacing * static_cast< float64 >( i ) ) ),
+            params.antenna_height_m
+        );
+
+        auto value = phasor( glm::dvec3( antenna ) );
+        for ( auto const& reflector : params.reflectors )
+        {
+            value += cmul(
+                phasor( glm::dvec3( ils::mirror( antenna, reflector ) ) ),
+                glm::dvec2( reflector.coefficient )
+            );
+        }
+
+        auto const feed = glm::dvec4( ils::excitation_phasors( excitations[ i ] ) );
+        csb += cmul( value, glm::dvec2( feed.x, feed.y ) );
+        sbo += cmul( value, glm::dvec2( feed.z, feed.w ) );
+    }
+
+    auto const ddm = 2.0 * glm::dot( sbo, csb ) / glm::dot( csb, csb );
+    return { ddm, glm::length( csb ), glm::length( sbo ) };
+}
+
+TEST( MultipathTests, VerticalWallGeometry )
+{
+    auto const wall = ils::vertical_wall( { 100.0F, 50.0F }, { 300.0F, 50.0F }, 20.0F, { } );
+
+    EXPECT_EQ( wall.center_m, glm::vec3( 200.0F, 50.0F, 10.0F ) );
+    EXPECT_EQ( wall.half_size_m, glm::vec2( 100.0F, 10.0F ) );
+
+    // Facing left of the start-to-end direction.
+    EXPECT_EQ( wall.normal, glm::vec3( 0.0F, 1.0F, 0.0F ) );
+    EXPECT_EQ( ils::mirror( { 0.0F, 10.0F, 3.0F }, wall ), glm::vec3( 0.0F, 90.0F, 3.0F ) );
+}
+
+TEST( MultipathTests, GroundImageMatchesTwoRayModel )
+{
+    auto const params = ils::FieldParams{
+        .antenna_pairs     = 6,
+        .antenna_spacing_m = 1.3F,
+        .summation         = ils::Summation::Phasor,
+        .antenna_height_m  = 3.0F,
+        .receiver_height_m = 15.0F,
+        .reflectors        = { ils::ground_plane( { -0.8F, 0.1F } ) },
+    };
+    auto const evaluator = ils::FieldEvaluator{ params };
+
+    for ( auto const range_m : { 200.0F, 1'000.0F, 5'000.0F } )
+    {
+        for ( auto step = -10; step <= 10; ++step )
+        {
+            auto const angle    = static_cast< float32 >( step ) * 0.01F;
+            auto const position = glm::vec3(
+                std::cos( angle ) * range_m,
+                std::sin( angle ) * range_m,
+                params.receiver_height_m
+            );
+
+            auto const actual   = evaluator.evaluate_point( position );
+            auto const expected = reference_signal( params, glm::dvec3( position ) );
+
+            EXPECT_NEAR( actual.x, expected.x, 1.0e-3 ) << range_m << " m, " << angle << " rad";
+            EXPECT_NEAR( actual.y, expected.y, expected.y * 1.0e-3 );
+            EXPECT_NEAR( actual.z, expected.z, expected.y * 1.0e-3 );
+        }
+    }
+}
+
+TEST( MultipathTests, FiniteWallOnlyReflectsOntoItsShadow )
+{
+    auto params = ils::FieldParams{
+        .antenna_pairs     = 4,
+        .antenna_spacing_m = 2.0F,
+        .summation         = ils::Summation::Phasor,
+        .antenna_height_m  = 2.0F,
+        .receiver_height_m = 2.0F,
+    };
+    auto const direct = ils::FieldEvaluator{ params };
+
+    // The wall's specular points along y = 5 cover x in roughly [410, 535] for every antenna,
+    // and none of them for x below 355 or above 615.
+    params.reflectors = { ils::vertical_wall( { 300.0F, 50.0F }, { 200.0F, 50.0F }, 10.0F, { } ) };
+    params.reflectors.front( ).coefficient = { -0.5F, 0.0F };
+    auto const reflected                   = ils::FieldEvaluator{ params };
+
+    for ( auto const x_m : { 150.0F, 300.0F, 450.0F, 500.0F, 700.0F } )
+    {
+        auto const position  = glm::vec2( x_m, 5.0F );
+        auto const in_shadow = ( x_m > 400.0F ) && ( x_m < 600.0F );
+
+        auto const with_wall    = reflected.evaluate_point( position );
+        auto const without_wall = direct.evaluate_point( position );
+
+        if ( in_shadow )
+        {
+            EXPECT_GT( std::abs( with_wall.y - without_wall.y ), without_wall.y * 1.0e-2F ) << x_m;
+        }
+        else
+        {
+            EXPECT_EQ( with_wall, without_wall ) << x_m;
+        }
+    }
+
+    // Receivers behind the wall never see it.
+    EXPECT_EQ(
+        reflected.evaluate_point( glm::vec2( 500.0F, 80.0F ) ),
+        direct.evaluate_point( glm::vec2( 500.0F, 80.0F ) )
+    );
+}
+
+TEST( MultipathTests, BatchedPointsMatchSinglePoints )
+{
+    auto const params = ils::FieldParams{
+        .antenna_pairs     = 3,
+        .antenna_spacing_m = 2.0F,
+        .summation         = ils::Summation::Phasor,
+        .antenna_height_m  = 2.0F,
+        .receiver_height_m = 4.0F,
+        .reflectors        = {
+            ils::ground_plane( { -0.9F, 0.0F } ),
+            ils::vertical_wall( { 700.0F, 60.0F }, { 300.0F, 80.0F }, 25.0F, { -0.6F, 0.2F } ),
+            ils::vertical_wall( { 200.0F, -60.0F }, { 400.0F, -90.0F }, 15.0F, { 0.3F, -0.4F } ),
+        },
+    };
+    auto const evaluator = ils::FieldEvaluator{ params };
+
+    auto const points = ils::arc_points(
+        ils::linspace( { .min = 300.0F, .max = 1'500.0F }, 7 ),
+        ils::linspace( { .min = -0.3F, .max = 0.3F }, 301 )
+    );
+    auto const count = points.x_m.size( );
+
+    auto csb = std::vector< float32 >( count );
+    auto sbo = std::vector< float32 >( count );
+    auto ddm = std::vector< float32 >( count );
+    ASSERT_TRUE(
+        evaluator.evaluate_points( points.view( ), { .csb = csb, .sbo = sbo, .ddm = ddm } )
+    );
+
+    for ( auto i = 0_UZ; i < count; ++i )
+    {
+        auto const expected
+            = evaluator.evaluate_point( glm::vec2( points.x_m[ i ], points.y_m[ i ] ) );
+
+        EXPECT_NEAR( ddm[ i ], expected.x, 1.0e-5F );
+        EXPECT_NEAR( csb[ i ], expected.y, expected.y * 1.0e-5F );
+        EXPECT_NEAR( sbo[ i ], expected.z, expected.y * 1.0e-5F );
+    }
+}
+
+} // namespace
+} // namespace ltb
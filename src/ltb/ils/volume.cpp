@@ -0,0 +1,355 @@
+#include "ltb/ils/volume.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// standard
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ltb::ils
+{
+namespace
+{
+
+// Voxel grids are evaluated in batches of whole layers holding about this many voxels,
+// enough for every thread to get several blocks.
+constexpr auto voxels_per_batch = 65'536_UZ;
+
+auto layer_size( VoxelGrid const& grid ) -> std::size_t
+{
+    return static_cast< std::size_t >( grid.size.x ) * static_cast< std::size_t >( grid.size.y );
+}
+
+auto check_output_sizes( VolumeOutput const& output, std::size_t const size )
+    -> utils::Result< void >
+{
+    for ( auto const values : {
+              output.localizer_csb,
+              output.localizer_ddm,
+              output.glide_slope_csb,
+              output.glide_slope_ddm,
+          } )
+    {
+        if ( !values.empty( ) && ( values.size( ) != size ) )
+        {
+            return LTB_MAKE_UNEXPECTED_ERROR(
+                "Volume output size mismatch. Expected {}, got {}",
+                size,
+                values.size( )
+            );
+        }
+    }
+    return utils::success( );
+}
+
+auto output_subspan( VolumeOutput const& output, std::size_t const offset, std::size_t const count )
+    -> VolumeOutput
+{
+    auto const sub = [ & ]( std::span< float32 > const values )
+    { return values.empty( ) ? values : values.subspan( offset, count ); };
+
+    return {
+        .localizer_csb   = sub( output.localizer_csb ),
+        .localizer_ddm   = sub( output.localizer_ddm ),
+        .glide_slope_csb = sub( output.glide_slope_csb ),
+        .glide_slope_ddm = sub( output.glide_slope_ddm ),
+    };
+}
+
+/// \brief Call \p fn with the points of each batch of layers and the index of its first voxel.
+template < typename Fn >
+auto for_each_batch( VoxelGrid const& grid, Fn&& fn ) -> utils::Result< void >
+{
+    LTB_CHECK_VALID( ( grid.size.x >= 0 ) && ( grid.size.y >= 0 ) && ( grid.size.z >= 0 ) );
+
+    auto const layer = layer_size( grid );
+    if ( 0_UZ == layer )
+    {
+        return utils::success( );
+    }
+
+    auto const layers_per_batch
+        = static_cast< int32 >( std::max( 1_UZ, voxels_per_batch / layer ) );
+
+    for ( auto first = 0; first < grid.size.z; first += layers_per_batch )
+    {
+        auto const count  = std::min( layers_per_batch, grid.size.z - first );
+        auto const points = layer_points( grid, first, count );
+        LTB_CHECK( fn( points, static_cast< std::size_t >( first ) * layer ) );
+    }
+    return utils::success( );
+}
+
+} // namespace
+
+auto voxel_count( VoxelGrid const& grid ) -> std::size_t
+{
+    return layer_size( grid ) * static_cast< std::size_t >( std::max( grid.size.z, 0 ) );
+}
+
+auto layer_points( VoxelGrid const& grid, int32 const first_layer, int32 const layer_count )
+    -> Points
+{
+    auto const voxel_size = math::dimensions( grid.bounds_m ) / glm::vec3( grid.size );
+    auto const count
+        = layer_size( grid ) * static_cast< std::size_t >( std::max( layer_count, 0 ) );
+
+    auto points = Points{ };
+    points.x_m.reserve( count );
+    points.y_m.reserve( count );
+    points.z_m.reserve( count );
+
+    for ( auto z = first_layer; z < first_layer + layer_count; ++z )
+    {
+        for ( auto y = 0; y < grid.size.y; ++y )
+        {
+            for ( auto x = 0; x < grid.size.x; ++x )
+            {
+                auto const center
+                    = grid.bounds_m.min + ( ( glm::vec3( x, y, z ) + 0.5F ) * voxel_size );
+                points.x_m.push_back( center.x );
+                points.y_m.push_back( center.y );
+                points.z_m.push_back( center.z );
+            }
+        }
+    }
+    return points;
+}
+
+auto slice_points( Slice const& slice ) -> Points
+{
+    auto const count = static_cast< std::size_t >( std::max( slice.size.x, 0 ) )
+                     * static_cast< std::size_t >( std::max( slice.size.y, 0 ) );
+
+    auto points = Points{ };
+    points.x_m.reserve( count );
+    points.y_m.reserve( count );
+    points.z_m.reserve( count );
+
+    for ( auto v = 0; v < slice.size.y; ++v )
+    {
+        for ( auto u = 0; u < slice.size.x; ++u )
+        {
+            auto const uv = ( glm::vec2( u, v ) + 0.5F ) / glm::vec2( slice.size );
+            auto const position
+                = slice.corner_m + ( uv.x * slice.u_extent_m ) + ( uv.y * slice.v_extent_m );
+            points.x_m.push_back( position.x );
+            points.y_m.push_back( position.y );
+            points.z_m.push_back( position.z );
+        }
+    }
+    return points;
+}
+
+VolumeEvaluator::VolumeEvaluator( VolumeParams params )
+{
+    set_params( std::move( params ) );
+}
+
+auto VolumeEvaluator::set_params( VolumeParams params ) -> void
+{
+    params_                     = std::move( params );
+    params_.localizer.summation = Summation::Phasor;
+    localizer_.set_params( params_.localizer );
+    glide_slope_.set_params( params_.glide_slope );
+}
+
+auto VolumeEvaluator::params( ) const -> VolumeParams const&
+{
+    return params_;
+}
+
+auto VolumeEvaluator::evaluate_points( PointsView const points, VolumeOutput const output ) const
+    -> utils::Result< void >
+{
+    auto const size = points.x_m.size( );
+    LTB_CHECK_VALID( ( points.y_m.size( ) == size ) && ( points.z_m.size( ) == size ) );
+    LTB_CHECK( check_output_sizes( output, size ) );
+
+    // The evaluators always write the CSB and SBO, so unrequested values go to scratch.
+    auto scratch     = std::vector< float32 >{ };
+    auto scratch_csb = std::vector< float32 >{ };
+
+    if ( !output.localizer_csb.empty( ) || !output.localizer_ddm.empty( ) )
+    {
+        scratch.resize( size );
+        if ( output.localizer_csb.empty( ) )
+        {
+            scratch_csb.resize( size );
+        }
+        LTB_CHECK( localizer_.evaluate_points(
+            points,
+            {
+                .csb = output.localizer_csb.empty( ) ? scratch_csb : output.localizer_csb,
+                .sbo = scratch,
+                .ddm = output.localizer_ddm,
+            }
+        ) );
+    }
+
+    if ( !output.glide_slope_csb.empty( ) || !output.glide_slope_ddm.empty( ) )
+    {
+        scratch.resize( size );
+        if ( output.glide_slope_csb.empty( ) )
+        {
+            scratch_csb.resize( size );
+        }
+        LTB_CHECK( glide_slope_.evaluate_points(
+            points,
+            {
+                .csb = output.glide_slope_csb.empty( ) ? scratch_csb : output.glide_slope_csb,
+                .sbo = scratch,
+                .ddm = output.glide_slope_ddm,
+            }
+        ) );
+    }
+
+    return utils::success( );
+}
+
+auto VolumeEvaluator::evaluate( VoxelGrid const& grid, VolumeOutput const output ) const
+    -> utils::Result< void >
+{
+    LTB_CHECK( check_output_sizes( output, voxel_count( grid ) ) );
+
+    return for_each_batch(
+        grid,
+        [ & ]( Points const& points, std::size_t const first_voxel ) -> utils::Result< void >
+        {
+            return evaluate_points(
+                points.view( ),
+                output_subspan( output, first_voxel, points.x_m.size( ) )
+            );
+        }
+    );
+}
+
+auto VolumeEvaluator::evaluate( Slice const& slice, VolumeOutput const output ) const
+    -> utils::Result< void >
+{
+    auto const points = slice_points( slice );
+    return evaluate_points( points.view( ), output );
+}
+
+auto check_coverage(
+    VolumeEvaluator const&      evaluator,
+    VoxelGrid const&            grid,
+    CoverageRequirements const& requirements
+) -> utils::Result< CoverageReport >
+{
+    auto report = CoverageReport{ .voxel_count = voxel_count( grid ) };
+
+    auto localizer_csb   = std::vector< float32 >{ };
+    auto glide_slope_csb = std::vector< float32 >{ };
+
+    LTB_CHECK( for_each_batch(
+        grid,
+        [ & ]( Points const& points, std::size_t ) -> utils::Result< void >
+        {
+            auto const size = points.x_m.size( );
+            localizer_csb.resize( size );
+            glide_slope_csb.resize( size );
+
+            LTB_CHECK( evaluator.evaluate_points(
+                points.view( ),
+                { .localizer_csb = localizer_csb, .glide_slope_csb = glide_slope_csb }
+            ) );
+
+            for ( auto i = 0_UZ; i < size; ++i )
+            {
+                auto const localizer   = localizer_csb[ i ] >= requirements.localizer_min_csb;
+                auto const glide_slope = glide_slope_csb[ i ] >= requirements.glide_slope_min_csb;
+
+                report.localizer_covered += localizer ? 1_UZ : 0_UZ;
+                report.glide_slope_covered += glide_slope ? 1_UZ : 0_UZ;
+                report.both_covered += ( localizer && glide_slope ) ? 1_UZ : 0_UZ;
+
+                report.localizer_min_csb = std::min( report.localizer_min_csb, localizer_csb[ i ] );
+                report.glide_slope_min_csb
+                    = std::min( report.glide_slope_min_csb, glide_slope_csb[ i ] );
+            }
+            return utils::success( );
+        }
+    ) );
+
+    return report;
+}
+
+auto ddm_color( float32 const ddm, float32 const full_scale_ddm ) -> glm::vec3
+{
+    constexpr auto ninety_hz    = glm::vec3( 1.0F, 0.85F, 0.1F );
+    constexpr auto one_fifty_hz = glm::vec3( 0.1F, 0.35F, 1.0F );
+    constexpr auto on_path      = glm::vec3( 1.0F );
+
+    auto const t    = std::clamp( ddm / full_scale_ddm, -1.0F, 1.0F );
+    auto const edge = ( t >= 0.0F ) ? ninety_hz : one_fifty_hz;
+    return on_path + ( std::abs( t ) * ( edge - on_path ) );
+}
+
+auto point_cloud( PointsView const points, std::span< glm::vec3 const > const colors )
+    -> utils::Result< math::Mesh3 >
+{
+    auto const size = points.x_m.size( );
+    LTB_CHECK_VALID(
+        ( points.y_m.size( ) == size ) && ( points.z_m.size( ) == size )
+            && ( colors.size( ) == size ),
+        "Point cloud positions and colors must be the same size"
+    );
+
+    auto mesh = math::Mesh3{ .format = math::MeshFormat::Points };
+    mesh.positions.reserve( size );
+    for ( auto i = 0_UZ; i < size; ++i )
+    {
+        mesh.positions.emplace_back( points.x_m[ i ], points.y_m[ i ], points.z_m[ i ] );
+    }
+    mesh.vertex_colors.assign( colors.begin( ), colors.end( ) );
+    return mesh;
+}
+
+auto slice_mesh( Slice const& slice, std::span< glm::vec3 const > const colors )
+    -> utils::Result< math::Mesh3 >
+{
+    auto const points = slice_points( slice );
+    LTB_CHECK_VALID(
+        colors.size( ) == points.x_m.size( ),
+        "Slice colors must hold one color per sample"
+    );
+
+    auto mesh = math::Mesh3{ };
+    LTB_CHECK( mesh, point_cloud( points.view( ), colors ) );
+    mesh.format = math::MeshFormat::Triangles;
+
+    auto const normal = glm::normalize( glm::cross( slice.u_extent_m, slice.v_extent_m ) );
+    mesh.normals.assign( mesh.positions.size( ), normal );
+
+    mesh.uvs.reserve( mesh.positions.size( ) );
+    for ( auto v = 0; v < slice.size.y; ++v )
+    {
+        for ( auto u = 0; u < slice.size.x; ++u )
+        {
+            mesh.uvs.push_back( ( glm::vec2( u, v ) + 0.5F ) / glm::vec2( slice.size ) );
+        }
+    }
+
+    auto const width = static_cast< uint32 >( slice.size.x );
+    for ( auto v = 1U; v < static_cast< uint32 >( slice.size.y ); ++v )
+    {
+        for ( auto u = 1U; u < width; ++u )
+        {
+            auto const top_right    = ( v * width ) + u;
+            auto const top_left     = top_right - 1U;
+            auto const bottom_right = top_right - width;
+            auto const bottom_left  = bottom_right - 1U;
+
+            mesh.indices.insert(
+                mesh.indices.end( ),
+                { bottom_left, bottom_right, top_right, bottom_left, top_right, top_left }
+            );
+        }
+    }
+    return mesh;
+}
+
+} // namespace ltb::ils
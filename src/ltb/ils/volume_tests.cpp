@@ -0,0 +1,175 @@
+
+// project
+#include "ltb/ils/volume.hpp"
+
+// external
+#include <gtest/gtest.h>
+
+// standard
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+auto const volume_params = ils::VolumeParams{
+    .localizer = {
+        .antenna_pairs     = 6,
+        .antenna_spacing_m = 1.3F,
+        .antenna_height_m  = 3.0F,
+        .reflectors        = { ils::ground_plane( { -1.0F, 0.0F } ) },
+    },
+};
+
+TEST( VolumeTests, GridMatchesPointEvaluation )
+{
+    // Large enough layers that the grid is split into several batches.
+    auto const grid = ils::VoxelGrid{
+        .bounds_m = { .min = { 500.0F, -400.0F, 0.0F }, .max = { 8'500.0F, 400.0F, 600.0F } },
+        .size     = { 200, 100, 7 },
+    };
+    auto const count     = ils::voxel_count( grid );
+    auto const evaluator = ils::VolumeEvaluator{ volume_params };
+
+    auto localizer_ddm   = std::vector< float32 >( count );
+    auto glide_slope_csb = std::vector< float32 >( count );
+    auto glide_slope_ddm = std::vector< float32 >( count );
+    ASSERT_TRUE( evaluator.evaluate(
+        grid,
+        {
+            .localizer_ddm   = localizer_ddm,
+            .glide_slope_csb = glide_slope_csb,
+            .glide_slope_ddm = glide_slope_ddm,
+        }
+    ) );
+
+    auto const points = ils::layer_points( grid, 0, grid.size.z );
+    ASSERT_EQ( points.x_m.size( ), count );
+
+    auto const localizer   = ils::FieldEvaluator{ evaluator.params( ).localizer };
+    auto const glide_slope = ils::GlideSlopeEvaluator{ volume_params.glide_slope };
+
+    for ( auto i = 0_UZ; i < count; i += 997_UZ )
+    {
+        auto const position = glm::vec3( points.x_m[ i ], points.y_m[ i ], points.z_m[ i ] );
+        EXPECT_NEAR( localizer_ddm[ i ], localizer.evaluate_point( position ).x, 1.0e-5F );
+        EXPECT_EQ( glide_slope_csb[ i ], glide_slope.evaluate_point( position ).y );
+        EXPECT_EQ( glide_slope_ddm[ i ], glide_slope.evaluate_point( position ).x );
+    }
+
+    // The last voxel is centered half a voxel inside the far corner.
+    EXPECT_EQ(
+        glm::vec3( points.x_m.back( ), points.y_m.back( ), points.z_m.back( ) ),
+        glm::vec3( 8'480.0F, 396.0F, 600.0F - ( 300.0F / 7.0F ) )
+    );
+}
+
+TEST( VolumeTests, VerticalSliceShowsTheGlidePath )
+{
+    // The vertical plane through the glide slope mast, along the approach.
+    auto const& mast  = volume_params.glide_slope.mast_position_m;
+    auto const  slice = ils::Slice{
+        .corner_m   = { mast.x + 2'000.0F, mast.y, 0.0F },
+        .u_extent_m = { 6'000.0F, 0.0F, 0.0F },
+        .v_extent_m = { 0.0F, 0.0F, 800.0F },
+        .size       = { 30, 200 },
+    };
+    auto const evaluator = ils::VolumeEvaluator{ volume_params };
+
+    auto ddm = std::vector< float32 >( 30 * 200 );
+    ASSERT_TRUE( evaluator.evaluate( slice, { .glide_slope_ddm = ddm } ) );
+
+    auto const points = ils::slice_points( slice );
+
+    // Every column crosses from fly-up to fly-down once, near the glide path.
+    for ( auto u = 0_UZ; u < 30_UZ; ++u )
+    {
+        auto crossings = std::vector< float32 >{ };
+        for ( auto v = 1_UZ; v < 120_UZ; ++v )
+        {
+            auto const below = ddm[ ( ( v - 1_UZ ) * 30_UZ ) + u ];
+            auto const above = ddm[ ( v * 30_UZ ) + u ];
+            if ( ( below < 0.0F ) && ( above >= 0.0F ) )
+            {
+                crossings.push_back( points.z_m[ ( v * 30_UZ ) + u ] );
+            }
+        }
+
+        auto const range_m = points.x_m[ u ] - mast.x;
+        ASSERT_EQ( crossings.size( ), 1_UZ ) << range_m;
+        EXPECT_NEAR(
+            crossings.front( ),
+            range_m * std::tan( volume_params.glide_slope.glide_path_rad ),
+            8.0F
+        ) << range_m;
+    }
+
+    auto colors = std::vector< glm::vec3 >( ddm.size( ) );
+    for ( auto i = 0_UZ; i < ddm.size( ); ++i )
+    {
+        colors[ i ] = ils::ddm_color( ddm[ i ], 0.0875F );
+    }
+
+    auto const mesh = ils::slice_mesh( slice, colors );
+    ASSERT_TRUE( mesh );
+    EXPECT_EQ( mesh->positions.size( ), ddm.size( ) );
+    EXPECT_EQ( mesh->vertex_colors.size( ), ddm.size( ) );
+    EXPECT_EQ( mesh->uvs.size( ), ddm.size( ) );
+    EXPECT_EQ( mesh->indices.size( ), 29_UZ * 199_UZ * 6_UZ );
+    EXPECT_EQ( mesh->normals.front( ), glm::vec3( 0.0F, -1.0F, 0.0F ) );
+
+    EXPECT_FALSE( ils::slice_mesh( slice, std::span( colors ).first( 10 ) ) );
+}
+
+TEST( VolumeTests, CoverageCountsMatchTheEvaluatedVolume )
+{
+    auto const grid = ils::VoxelGrid{
+        .bounds_m = {
+            .min = { 1'000.0F, -2'000.0F, 10.0F },
+            .max = { 40'000.0F, 2'000.0F, 3'000.0F },
+        },
+        .size     = { 60, 20, 10 },
+    };
+    auto const count        = ils::voxel_count( grid );
+    auto const evaluator    = ils::VolumeEvaluator{ volume_params };
+    auto const requirements = ils::CoverageRequirements{
+        .localizer_min_csb   = 1.0e-4F,
+        .glide_slope_min_csb = 1.0e-4F,
+    };
+
+    auto localizer_csb   = std::vector< float32 >( count );
+    auto glide_slope_csb = std::vector< float32 >( count );
+    ASSERT_TRUE( evaluator.evaluate(
+        grid,
+        { .localizer_csb = localizer_csb, .glide_slope_csb = glide_slope_csb }
+    ) );
+
+    auto expected = ils::CoverageReport{ .voxel_count = count };
+    for ( auto i = 0_UZ; i < count; ++i )
+    {
+        auto const localizer   = localizer_csb[ i ] >= requirements.localizer_min_csb;
+        auto const glide_slope = glide_slope_csb[ i ] >= requirements.glide_slope_min_csb;
+        expected.localizer_covered += localizer ? 1_UZ : 0_UZ;
+        expected.glide_slope_covered += glide_slope ? 1_UZ : 0_UZ;
+        expected.both_covered += ( localizer && glide_slope ) ? 1_UZ : 0_UZ;
+    }
+
+    auto const report = ils::check_coverage( evaluator, grid, requirements );
+    ASSERT_TRUE( report );
+    EXPECT_EQ( report->voxel_count, count );
+    EXPECT_EQ( report->localizer_covered, expected.localizer_covered );
+    EXPECT_EQ( report->glide_slope_covered, expected.glide_slope_covered );
+    EXPECT_EQ( report->both_covered, expected.both_covered );
+
+    // Neither signal reaches the whole volume at this threshold.
+    EXPECT_GT( report->both_covered, 0_UZ );
+    EXPECT_LT( report->both_covered, count );
+    EXPECT_EQ( report->localizer_min_csb, *std::ranges::min_element( localizer_csb ) );
+    EXPECT_EQ( report->glide_slope_min_csb, *std::ranges::min_element( glide_slope_csb ) );
+}
+
+} // namespace
+} // namespace ltb
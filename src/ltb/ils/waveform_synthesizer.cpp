@@ -0,0 +1,101 @@
+#include "ltb/ils/waveform_synthesizer.hpp"
+
+// project
+#include "ltb/dsp/oscillator.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// standard
+#include <algorithm>
+
+namespace ltb::ils
+{
+namespace
+{
+
+auto resize_waves( TransmittedWaves& waves, std::size_t const sample_count ) -> void
+{
+    for ( auto* const wave : {
+              &waves.carrier,
+              &waves.ninety_hz,
+              &waves.one_fifty_hz,
+              &waves.csb_audio,
+              &waves.csb_modulated,
+              &waves.csb_signal,
+              &waves.sbo_audio,
+              &waves.sbo_modulated,
+              &waves.sbo_shifted,
+          } )
+    {
+        wave->resize( sample_count );
+    }
+}
+
+} // namespace
+
+auto WaveformSynthesizer::update( WaveformParams const& params ) -> bool
+{
+    if ( params_ == params )
+    {
+        return false;
+    }
+    params_ = params;
+
+    auto const sample_count = params.sample_count;
+    resize_waves( waves_, sample_count );
+
+    if ( 0_UZ == sample_count )
+    {
+        return true;
+    }
+
+    auto const step  = dimensions( params.window ) / static_cast< float64 >( sample_count );
+    auto const depth = static_cast< float32 >( params.modulation_depth );
+
+    auto carrier      = dsp::Oscillator{ params.carrier_frequency, params.window.min, step };
+    auto ninety_hz    = dsp::Oscillator{ params.ninety_hz_frequency, params.window.min, step };
+    auto one_fifty_hz = dsp::Oscillator{ params.one_fifty_hz_frequency, params.window.min, step };
+
+    constexpr auto reseed_interval = dsp::Oscillator::reseed_interval;
+
+    for ( auto block_start = 0_UZ; block_start < sample_count; block_start += reseed_interval )
+    {
+        carrier.reseed( block_start );
+        ninety_hz.reseed( block_start );
+        one_fifty_hz.reseed( block_start );
+
+        auto const block_end = std::min( block_start + reseed_interval, sample_count );
+        for ( auto i = block_start; i < block_end; ++i )
+        {
+            auto const carrier_phasor = carrier.phasor( );
+
+            auto const carrier_wave = static_cast< float32 >( carrier_phasor.y );
+            // sin(θ + π/2) == cos(θ)
+            auto const shifted_carrier_wave = static_cast< float32 >( carrier_phasor.x );
+
+            waves_.carrier[ i ]      = carrier_wave;
+            waves_.ninety_hz[ i ]    = static_cast< float32 >( ninety_hz.phasor( ).y );
+            waves_.one_fifty_hz[ i ] = static_cast< float32 >( one_fifty_hz.phasor( ).y );
+
+            waves_.csb_audio[ i ]     = waves_.ninety_hz[ i ] + waves_.one_fifty_hz[ i ];
+            waves_.csb_modulated[ i ] = carrier_wave * waves_.csb_audio[ i ] * depth;
+            waves_.csb_signal[ i ]    = waves_.csb_modulated[ i ] + carrier_wave;
+
+            waves_.sbo_audio[ i ]     = waves_.ninety_hz[ i ] - waves_.one_fifty_hz[ i ];
+            waves_.sbo_modulated[ i ] = carrier_wave * waves_.sbo_audio[ i ] * depth;
+            waves_.sbo_shifted[ i ]   = shifted_carrier_wave * waves_.sbo_audio[ i ] * depth;
+
+            carrier.advance( );
+            ninety_hz.advance( );
+            one_fifty_hz.advance( );
+        }
+    }
+
+    return true;
+}
+
+auto WaveformSynthesizer::waves( ) const -> TransmittedWaves const&
+{
+    return waves_;
+}
+
+} // namespace ltb::ils
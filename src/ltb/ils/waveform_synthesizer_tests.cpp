@@ -0,0 +1,91 @@
+
+// project
+#include "ltb/ils/waveform_synthesizer.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+#include <gtest/gtest.h>
+
+// standard
+#include <cmath>
+
+namespace ltb
+{
+namespace
+{
+
+/// \brief The phase (radians) the original per-sample loop in `IlsApp` used.
+auto reference_radians(
+    ils::WaveformParams const& params,
+    float64 const              frequency,
+    std::size_t const          i
+) -> float64
+{
+    auto const t  = static_cast< float64 >( i ) / static_cast< float64 >( params.sample_count );
+    auto const us = params.window.min + ( t * dimensions( params.window ) );
+    return glm::two_pi< float64 >( ) * frequency * us;
+}
+
+auto reference_sin(
+    ils::WaveformParams const& params,
+    float64 const              frequency,
+    std::size_t const          i
+) -> float32
+{
+    return static_cast< float32 >( std::sin( reference_radians( params, frequency, i ) ) );
+}
+
+TEST( WaveformSynthesizerTests, MatchesDirectEvaluation )
+{
+    auto const params = ils::WaveformParams{
+        .window       = { .min = 0.25, .max = 4.0 },
+        .sample_count = 10'000,
+    };
+
+    auto synthesizer = ils::WaveformSynthesizer{ };
+    ASSERT_TRUE( synthesizer.update( params ) );
+
+    auto const& waves = synthesizer.waves( );
+    ASSERT_EQ( waves.sbo_shifted.size( ), params.sample_count );
+
+    for ( auto i = 0_UZ; i < params.sample_count; ++i )
+    {
+        auto const carrier   = reference_sin( params, params.carrier_frequency, i );
+        auto const ninety    = reference_sin( params, params.ninety_hz_frequency, i );
+        auto const one_fifty = reference_sin( params, params.one_fifty_hz_frequency, i );
+        auto const shifted   = static_cast< float32 >( std::sin(
+            glm::half_pi< float64 >( ) + reference_radians( params, params.carrier_frequency, i )
+        ) );
+
+        auto const csb_signal  = carrier + ( carrier * ( ninety + one_fifty ) * 0.2F );
+        auto const sbo_shifted = shifted * ( ninety - one_fifty ) * 0.2F;
+
+        EXPECT_NEAR( waves.carrier[ i ], carrier, 1.0e-6F );
+        EXPECT_NEAR( waves.ninety_hz[ i ], ninety, 1.0e-6F );
+        EXPECT_NEAR( waves.one_fifty_hz[ i ], one_fifty, 1.0e-6F );
+        EXPECT_NEAR( waves.csb_signal[ i ], csb_signal, 1.0e-5F );
+        EXPECT_NEAR( waves.sbo_shifted[ i ], sbo_shifted, 1.0e-5F );
+    }
+}
+
+TEST( WaveformSynthesizerTests, OnlyUpdatesOnChange )
+{
+    auto synthesizer = ils::WaveformSynthesizer{ };
+    auto params      = ils::WaveformParams{ };
+
+    EXPECT_TRUE( synthesizer.update( params ) );
+    EXPECT_FALSE( synthesizer.update( params ) );
+
+    auto const* const data = synthesizer.waves( ).carrier.data( );
+
+    params.carrier_frequency = 20.0;
+    EXPECT_TRUE( synthesizer.update( params ) );
+    EXPECT_FALSE( synthesizer.update( params ) );
+
+    // Same-size updates reuse the existing buffers.
+    EXPECT_EQ( synthesizer.waves( ).carrier.data( ), data );
+}
+
+} // namespace
+} // namespace ltb
@@ -45,6 +45,19 @@ auto Framebuffer::blit(
     GLbitfield const                                 mask,
     GLenum const                                     filter
 ) -> void
+{
+    blit( read_framebuffer, draw_framebuffer, viewport, viewport, attachments, mask, filter );
+}
+
+auto Framebuffer::blit(
+    Bound< Framebuffer, GL_READ_FRAMEBUFFER > const& read_framebuffer,
+    Bound< Framebuffer, GL_DRAW_FRAMEBUFFER > const& draw_framebuffer,
+    math::Range2Di const&                            read_viewport,
+    math::Range2Di const&                            draw_viewport,
+    std::vector< FramebufferAttachmentPair > const&  attachments,
+    GLbitfield const                                 mask,
+    GLenum const                                     filter
+) -> void
 {
     // These need to be bound, but nothing has to be done with them
     utils::ignore( read_framebuffer, draw_framebuffer );
@@ -63,14 +76,14 @@ auto Framebuffer::blit(
 
         // Copy from one buffer to the other
         glBlitFramebuffer(
-            viewport.min.x,
-            viewport.min.y,
-            viewport.max.x,
-            viewport.max.y,
-            viewport.min.x,
-            viewport.min.y,
-            viewport.max.x,
-            viewport.max.y,
+            read_viewport.min.x,
+            read_viewport.min.y,
+            read_viewport.max.x,
+            read_viewport.max.y,
+            draw_viewport.min.x,
+            draw_viewport.min.y,
+            draw_viewport.max.x,
+            draw_viewport.max.y,
             mask,
             filter
         );
@@ -0,0 +1,192 @@
+#include "ltb/utils/mapped_file.hpp"
+
+// project
+#include "ltb/utils/ignore.hpp"
+
+// standard
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ltb::utils
+{
+
+MappedFile::~MappedFile( )
+{
+    close( );
+}
+
+#ifdef _WIN32
+
+auto MappedFile::open( std::filesystem::path const& path ) -> Result< MappedFile >
+{
+    auto* const file = CreateFileW(
+        path.c_str( ),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr
+    );
+    if ( INVALID_HANDLE_VALUE == file )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "Failed to open '{}' (error {})",
+            path.string( ),
+            GetLastError( )
+        );
+    }
+
+    auto size = LARGE_INTEGER{ };
+    if ( !GetFileSizeEx( file, &size ) )
+    {
+        auto const error = GetLastError( );
+        CloseHandle( file );
+        return LTB_MAKE_UNEXPECTED_ERROR( "Failed to size '{}' (error {})", path.string( ), error );
+    }
+
+    auto mapped = MappedFile{ };
+    if ( 0 == size.QuadPart )
+    {
+        CloseHandle( file );
+        return mapped;
+    }
+
+    // The view keeps the mapping alive once both handles are closed.
+    auto* const mapping = CreateFileMappingW( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+    auto const  error   = GetLastError( );
+    CloseHandle( file );
+    if ( nullptr == mapping )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR( "Failed to map '{}' (error {})", path.string( ), error );
+    }
+
+    auto* const view       = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+    auto const  view_error = GetLastError( );
+    CloseHandle( mapping );
+    if ( nullptr == view )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "Failed to map '{}' (error {})",
+            path.string( ),
+            view_error
+        );
+    }
+
+    mapped.data_ = static_cast< std::byte const* >( view );
+    mapped.size_ = static_cast< std::size_t >( size.QuadPart );
+    return mapped;
+}
+
+auto MappedFile::close( ) -> void
+{
+    if ( nullptr != data_ )
+    {
+        UnmapViewOfFile( data_ );
+    }
+    data_ = nullptr;
+    size_ = 0;
+}
+
+#else
+
+auto MappedFile::open( std::filesystem::path const& path ) -> Result< MappedFile >
+{
+    auto const file = ::open( path.c_str( ), O_RDONLY | O_CLOEXEC );
+    if ( file < 0 )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "Failed to open '{}': {}",
+            path.string( ),
+            std::strerror( errno )
+        );
+    }
+
+    struct stat status = { };
+    if ( 0 != ::fstat( file, &status ) )
+    {
+        auto const error = errno;
+        ::close( file );
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "Failed to size '{}': {}",
+            path.string( ),
+            std::strerror( error )
+        );
+    }
+
+    auto mapped = MappedFile{ };
+    if ( 0 == status.st_size )
+    {
+        ::close( file );
+        return mapped;
+    }
+
+    // The mapping stays valid after the descriptor is closed.
+    auto const size  = static_cast< std::size_t >( status.st_size );
+    auto*      view  = ::mmap( nullptr, size, PROT_READ, MAP_SHARED, file, 0 );
+    auto const error = errno;
+    ::close( file );
+
+    if ( MAP_FAILED == view )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "Failed to map '{}': {}",
+            path.string( ),
+            std::strerror( error )
+        );
+    }
+
+    // Readers seek around the file, so don't bother reading ahead.
+    utils::ignore( ::madvise( view, size, MADV_RANDOM ) );
+
+    mapped.data_ = static_cast< std::byte const* >( view );
+    mapped.size_ = size;
+    return mapped;
+}
+
+auto MappedFile::close( ) -> void
+{
+    if ( nullptr != data_ )
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        ::munmap( const_cast< std::byte* >( data_ ), size_ );
+    }
+    data_ = nullptr;
+    size_ = 0;
+}
+
+#endif
+
+MappedFile::MappedFile( MappedFile&& other ) noexcept
+    : data_( std::exchange( other.data_, nullptr ) )
+    , size_( std::exchange( other.size_, 0 ) )
+{
+}
+
+auto MappedFile::operator=( MappedFile&& other ) noexcept -> MappedFile&
+{
+    if ( this != &other )
+    {
+        close( );
+        data_ = std::exchange( other.data_, nullptr );
+        size_ = std::exchange( other.size_, 0 );
+    }
+    return *this;
+}
+
+auto MappedFile::bytes( ) const -> std::span< std::byte const >
+{
+    return { data_, size_ };
+}
+
+} // namespace ltb::utils
@@ -0,0 +1,72 @@
+// project
+#include "ltb/utils/ring_buffer.hpp"
+
+// external
+#include <gtest/gtest.h>
+
+// standard
+#include <numeric>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+TEST( RingBufferTests, WritesAndReadsAcrossTheWrap )
+{
+    auto ring = utils::RingBuffer< int32 >{ 5 };
+    EXPECT_TRUE( ring.empty( ) );
+
+    auto values = std::vector< int32 >( 8 );
+    std::iota( values.begin( ), values.end( ), 1 );
+
+    EXPECT_EQ( ring.write( std::span( values ).first( 4 ) ), 4_UZ );
+
+    auto out = std::vector< int32 >( 3 );
+    EXPECT_EQ( ring.read( out ), 3_UZ );
+    EXPECT_EQ( out, ( std::vector< int32 >{ 1, 2, 3 } ) );
+
+    // Only four fit, wrapping around the end of the storage.
+    EXPECT_EQ( ring.write( std::span( values ).subspan( 4 ) ), 4_UZ );
+    EXPECT_EQ( ring.size( ), 5_UZ );
+    EXPECT_EQ( ring.available( ), 0_UZ );
+    EXPECT_EQ( ring.write( values ), 0_UZ );
+
+    auto const contents = ring.contents( );
+    EXPECT_EQ( contents[ 0 ].size( ) + contents[ 1 ].size( ), 5_UZ );
+    EXPECT_EQ( contents[ 0 ].front( ), 4 );
+    EXPECT_EQ( contents[ 1 ].back( ), 8 );
+
+    out.resize( 10 );
+    EXPECT_EQ( ring.read( out ), 5_UZ );
+    out.resize( 5 );
+    EXPECT_EQ( out, ( std::vector< int32 >{ 4, 5, 6, 7, 8 } ) );
+    EXPECT_TRUE( ring.empty( ) );
+}
+
+TEST( RingBufferTests, OverwriteKeepsTheNewestValues )
+{
+    auto ring   = utils::RingBuffer< int32 >{ 4 };
+    auto values = std::vector< int32 >( 10 );
+    std::iota( values.begin( ), values.end( ), 0 );
+
+    ring.overwrite( std::span( values ).first( 3 ) );
+    ring.overwrite( std::span( values ).subspan( 3, 2 ) );
+
+    auto out = std::vector< int32 >( 4 );
+    auto copy = ring;
+    EXPECT_EQ( copy.read( out ), 4_UZ );
+    EXPECT_EQ( out, ( std::vector< int32 >{ 1, 2, 3, 4 } ) );
+
+    // Indexing sees the same order without consuming anything.
+    EXPECT_EQ( ring[ 0 ], 1 );
+    EXPECT_EQ( ring[ 3 ], 4 );
+
+    ring.overwrite( values );
+    EXPECT_EQ( ring.read( out ), 4_UZ );
+    EXPECT_EQ( out, ( std::vector< int32 >{ 6, 7, 8, 9 } ) );
+}
+
+} // namespace
+} // namespace ltb
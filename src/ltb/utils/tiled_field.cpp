@@ -0,0 +1,387 @@
+#include "ltb/utils/tiled_field.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// standard
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <string_view>
+
+namespace ltb::utils
+{
+namespace
+{
+
+static_assert( std::endian::native == std::endian::little, "Tiled fields are little-endian" );
+
+constexpr auto magic   = std::string_view{ "LTBTILED" };
+constexpr auto version = uint32{ 1 };
+
+/// \brief The header exactly as it is stored at the start of the file.
+struct FileHeader
+{
+    std::array< char, 8 > magic         = { };
+    uint32                version       = 0;
+    int32                 size_x        = 0;
+    int32                 size_y        = 0;
+    int32                 tile_x        = 0;
+    int32                 tile_y        = 0;
+    int32                 channel_count = 0;
+    float64               origin_x      = 0.0;
+    float64               origin_y      = 0.0;
+    float64               step_x        = 0.0;
+    float64               step_y        = 0.0;
+};
+
+constexpr auto header_size = sizeof( FileHeader );
+static_assert( 64 == header_size );
+
+auto to_file_header( TiledFieldLayout const& layout ) -> FileHeader
+{
+    auto header = FileHeader{
+        .version       = version,
+        .size_x        = layout.size_pixels.x,
+        .size_y        = layout.size_pixels.y,
+        .tile_x        = layout.tile_size.x,
+        .tile_y        = layout.tile_size.y,
+        .channel_count = layout.channel_count,
+        .origin_x      = layout.origin_m.x,
+        .origin_y      = layout.origin_m.y,
+        .step_x        = layout.pixel_step_m.x,
+        .step_y        = layout.pixel_step_m.y,
+    };
+    std::ranges::copy( magic, header.magic.begin( ) );
+    return header;
+}
+
+auto to_layout( FileHeader const& header ) -> TiledFieldLayout
+{
+    return {
+        .size_pixels   = { header.size_x, header.size_y },
+        .tile_size     = { header.tile_x, header.tile_y },
+        .channel_count = header.channel_count,
+        .origin_m      = { header.origin_x, header.origin_y },
+        .pixel_step_m  = { header.step_x, header.step_y },
+    };
+}
+
+auto check_layout( TiledFieldLayout const& layout ) -> Result< void >
+{
+    LTB_CHECK_VALID( ( layout.size_pixels.x >= 0 ) && ( layout.size_pixels.y >= 0 ) );
+    LTB_CHECK_VALID(
+        ( layout.tile_size.x > 0 ) && ( layout.tile_size.y > 0 ),
+        "Tiles must hold at least one pixel"
+    );
+    LTB_CHECK_VALID( layout.channel_count > 0, "Fields must have at least one channel" );
+    return success( );
+}
+
+auto plane_size( TiledFieldLayout const& layout ) -> std::size_t
+{
+    return total_size( layout.tile_size.x, layout.tile_size.y );
+}
+
+auto tile_offset( TiledFieldLayout const& layout, glm::ivec2 const tile ) -> std::size_t
+{
+    auto const tiles = tile_count( layout );
+    auto const index = array_index( tile.x, tile.y, tiles.x );
+    return header_size + ( index * tile_value_count( layout ) * sizeof( float32 ) );
+}
+
+auto tile_in_range( TiledFieldLayout const& layout, glm::ivec2 const tile ) -> bool
+{
+    auto const tiles = tile_count( layout );
+    return ( tile.x >= 0 ) && ( tile.y >= 0 ) && ( tile.x < tiles.x ) && ( tile.y < tiles.y );
+}
+
+} // namespace
+
+auto tile_count( TiledFieldLayout const& layout ) -> glm::ivec2
+{
+    return ( layout.size_pixels + layout.tile_size - 1 ) / layout.tile_size;
+}
+
+auto tile_value_count( TiledFieldLayout const& layout ) -> std::size_t
+{
+    return plane_size( layout ) * static_cast< std::size_t >( layout.channel_count );
+}
+
+auto tiled_field_file_size( TiledFieldLayout const& layout ) -> std::size_t
+{
+    auto const tiles = tile_count( layout );
+    return tile_offset( layout, { 0, tiles.y } );
+}
+
+auto TiledFieldWriter::create( std::filesystem::path const& path, TiledFieldLayout const& layout )
+    -> Result< TiledFieldWriter >
+{
+    LTB_CHECK( check_layout( layout ) );
+
+    auto writer    = TiledFieldWriter{ };
+    writer.layout_ = layout;
+    writer.file_.open( path, std::ios::binary | std::ios::out | std::ios::trunc );
+    if ( !writer.file_ )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR( "Failed to create '{}'", path.string( ) );
+    }
+
+    auto const header = to_file_header( layout );
+    writer.file_.write( reinterpret_cast< char const* >( &header ), sizeof( header ) );
+
+    // Size the file up front so tiles can be written in any order. Most file systems
+    // leave the unwritten tiles sparse.
+    auto const file_size = tiled_field_file_size( layout );
+    if ( file_size > header_size )
+    {
+        writer.file_.seekp( static_cast< std::streamoff >( file_size - 1_UZ ) );
+        writer.file_.put( '\0' );
+    }
+
+    if ( !writer.file_ )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "Failed to size '{}' to {} bytes",
+            path.string( ),
+            file_size
+        );
+    }
+
+    auto const tiles = tile_count( layout );
+    writer.written_.assign( total_size( tiles.x, tiles.y ), false );
+    writer.tile_.resize( tile_value_count( layout ) );
+
+    return writer;
+}
+
+auto TiledFieldWriter::layout( ) const -> TiledFieldLayout const&
+{
+    return layout_;
+}
+
+auto TiledFieldWriter::write_tile( glm::ivec2 const tile, std::span< float32 const > const values )
+    -> Result< void >
+{
+    LTB_CHECK_VALID( file_.is_open( ), "Tiled field writer is not open" );
+    LTB_CHECK_VALID( tile_in_range( layout_, tile ) );
+    if ( values.size( ) != tile_value_count( layout_ ) )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "Tile size mismatch. Expected {} values, got {}",
+            tile_value_count( layout_ ),
+            values.size( )
+        );
+    }
+
+    file_.seekp( static_cast< std::streamoff >( tile_offset( layout_, tile ) ) );
+    file_.write(
+        reinterpret_cast< char const* >( values.data( ) ),
+        static_cast< std::streamsize >( values.size_bytes( ) )
+    );
+    if ( !file_ )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR( "Failed to write tile ({}, {})", tile.x, tile.y );
+    }
+
+    written_[ array_index( tile.x, tile.y, tile_count( layout_ ).x ) ] = true;
+    return success( );
+}
+
+auto TiledFieldWriter::write_rows(
+    int32 const                                        first_row,
+    std::span< std::span< float32 const > const > const channels
+) -> Result< void >
+{
+    auto const& size = layout_.size_pixels;
+    auto const& tile = layout_.tile_size;
+
+    LTB_CHECK_VALID(
+        ( first_row >= 0 ) && ( first_row < size.y ) && ( 0 == first_row % tile.y ),
+        "Row bands must start on a tile boundary inside the field"
+    );
+    LTB_CHECK_VALID( static_cast< int32 >( channels.size( ) ) == layout_.channel_count );
+
+    auto const row_count  = std::min( tile.y, size.y - first_row );
+    auto const band_width = static_cast< std::size_t >( size.x );
+    for ( auto const& channel : channels )
+    {
+        if ( channel.size( ) != band_width * static_cast< std::size_t >( row_count ) )
+        {
+            return LTB_MAKE_UNEXPECTED_ERROR(
+                "Row band size mismatch. Expected {} values, got {}",
+                band_width * static_cast< std::size_t >( row_count ),
+                channel.size( )
+            );
+        }
+    }
+
+    auto const plane = plane_size( layout_ );
+
+    for ( auto tile_x = 0; tile_x < tile_count( layout_ ).x; ++tile_x )
+    {
+        auto const first_column = tile_x * tile.x;
+        auto const column_count = std::min( tile.x, size.x - first_column );
+
+        // Only the padding of the edge tiles needs clearing.
+        if ( ( column_count < tile.x ) || ( row_count < tile.y ) )
+        {
+            std::ranges::fill( tile_, 0.0F );
+        }
+
+        for ( auto c = 0_UZ; c < channels.size( ); ++c )
+        {
+            for ( auto row = 0; row < row_count; ++row )
+            {
+                auto const source = channels[ c ].subspan(
+                    array_index( first_column, row, size.x ),
+                    static_cast< std::size_t >( column_count )
+                );
+                auto const target = static_cast< std::ptrdiff_t >(
+                    ( c * plane ) + array_index( 0, row, tile.x )
+                );
+                std::ranges::copy( source, tile_.begin( ) + target );
+            }
+        }
+
+        LTB_CHECK( write_tile( { tile_x, first_row / tile.y }, tile_ ) );
+    }
+    return success( );
+}
+
+auto TiledFieldWriter::finish( ) -> Result< void >
+{
+    LTB_CHECK_VALID( file_.is_open( ), "Tiled field writer is not open" );
+
+    auto const missing = std::ranges::count( written_, false );
+    file_.close( );
+
+    if ( missing > 0 )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR( "{} tiles were never written", missing );
+    }
+    if ( !file_ )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR( "Failed to finish writing the tiled field" );
+    }
+    return success( );
+}
+
+auto TiledFieldReader::open( std::filesystem::path const& path ) -> Result< TiledFieldReader >
+{
+    auto reader = TiledFieldReader{ };
+    LTB_CHECK( reader.file_, MappedFile::open( path ) );
+
+    auto const bytes = reader.file_.bytes( );
+    if ( bytes.size( ) < header_size )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "'{}' is too small to be a tiled field",
+            path.string( )
+        );
+    }
+
+    auto header = FileHeader{ };
+    std::memcpy( &header, bytes.data( ), sizeof( header ) );
+
+    if ( ( std::string_view{ header.magic.data( ), header.magic.size( ) } != magic )
+         || ( version != header.version ) )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "'{}' is not a version {} tiled field",
+            path.string( ),
+            version
+        );
+    }
+
+    reader.layout_ = to_layout( header );
+    LTB_CHECK( check_layout( reader.layout_ ) );
+
+    if ( bytes.size( ) != tiled_field_file_size( reader.layout_ ) )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "'{}' holds {} bytes, but its layout needs {}",
+            path.string( ),
+            bytes.size( ),
+            tiled_field_file_size( reader.layout_ )
+        );
+    }
+
+    return reader;
+}
+
+auto TiledFieldReader::layout( ) const -> TiledFieldLayout const&
+{
+    return layout_;
+}
+
+auto TiledFieldReader::tile( glm::ivec2 const tile, int32 const channel ) const
+    -> std::span< float32 const >
+{
+    auto const plane  = plane_size( layout_ );
+    auto const offset = tile_offset( layout_, tile )
+                      + ( static_cast< std::size_t >( channel ) * plane * sizeof( float32 ) );
+
+    // The header is 64 bytes and the mapping is page aligned, so every plane is aligned.
+    return { reinterpret_cast< float32 const* >( file_.bytes( ).data( ) + offset ), plane };
+}
+
+auto TiledFieldReader::value( glm::ivec2 const pixel, int32 const channel ) const -> float32
+{
+    auto const local = pixel % layout_.tile_size;
+    return tile( pixel / layout_.tile_size, channel )[ array_index(
+        local.x,
+        local.y,
+        layout_.tile_size.x
+    ) ];
+}
+
+auto TiledFieldReader::read(
+    math::Range2Di const&      region,
+    int32 const                channel,
+    std::span< float32 > const values
+) const -> Result< void >
+{
+    LTB_CHECK_VALID( ( channel >= 0 ) && ( channel < layout_.channel_count ) );
+    LTB_CHECK_VALID( ( region.min.x >= 0 ) && ( region.min.y >= 0 ) );
+    LTB_CHECK_VALID( ( region.min.x <= region.max.x ) && ( region.min.y <= region.max.y ) );
+    LTB_CHECK_VALID(
+        ( region.max.x <= layout_.size_pixels.x ) && ( region.max.y <= layout_.size_pixels.y )
+    );
+
+    auto const region_size = math::dimensions( region );
+    if ( values.size( ) != total_size( region_size.x, region_size.y ) )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "Region size mismatch. Expected {} values, got {}",
+            total_size( region_size.x, region_size.y ),
+            values.size( )
+        );
+    }
+
+    auto const& tile_size = layout_.tile_size;
+    auto        output    = values.begin( );
+
+    for ( auto y = region.min.y; y < region.max.y; ++y )
+    {
+        // Each row is copied one contiguous tile row at a time.
+        for ( auto x = region.min.x; x < region.max.x; )
+        {
+            auto const tile_index = glm::ivec2( x, y ) / tile_size;
+            auto const local      = glm::ivec2( x, y ) % tile_size;
+            auto const count      = std::min( tile_size.x - local.x, region.max.x - x );
+
+            auto const source = tile( tile_index, channel )
+                                    .subspan(
+                                        array_index( local.x, local.y, tile_size.x ),
+                                        static_cast< std::size_t >( count )
+                                    );
+            output = std::ranges::copy( source, output ).out;
+            x += count;
+        }
+    }
+    return success( );
+}
+
+} // namespace ltb::utils
@@ -0,0 +1,182 @@
+// project
+#include "ltb/utils/size_utils.hpp"
+#include "ltb/utils/tiled_field.hpp"
+
+// external
+#include <gtest/gtest.h>
+
+// standard
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+auto temp_path( std::string const& name ) -> std::filesystem::path
+{
+    return std::filesystem::temp_directory_path( ) / ( "ltb_tiled_field_" + name + ".bin" );
+}
+
+// A value unique to every pixel and channel.
+auto expected_value( int32 const x, int32 const y, int32 const channel ) -> float32
+{
+    return static_cast< float32 >( ( channel * 1'000'000 ) + ( y * 1'000 ) + x );
+}
+
+TEST( TiledFieldTests, RowBandsRoundTrip )
+{
+    auto const path   = temp_path( "round_trip" );
+    auto const layout = utils::TiledFieldLayout{
+        .size_pixels   = { 70, 45 },
+        .tile_size     = { 16, 8 },
+        .channel_count = 2,
+        .origin_m      = { 0.5, -10.0 },
+        .pixel_step_m  = { 2.0, -2.0 },
+    };
+
+    {
+        auto writer = utils::TiledFieldWriter::create( path, layout );
+        ASSERT_TRUE( writer ) << writer.error( ).debug_error_message( );
+
+        for ( auto first_row = 0; first_row < layout.size_pixels.y; first_row += 8 )
+        {
+            auto const rows  = std::min( 8, layout.size_pixels.y - first_row );
+            auto       bands = std::array< std::vector< float32 >, 2 >{ };
+            for ( auto c = 0; c < 2; ++c )
+            {
+                for ( auto y = first_row; y < first_row + rows; ++y )
+                {
+                    for ( auto x = 0; x < layout.size_pixels.x; ++x )
+                    {
+                        bands[ static_cast< std::size_t >( c ) ].push_back(
+                            expected_value( x, y, c )
+                        );
+                    }
+                }
+            }
+            auto const channels = std::array< std::span< float32 const >, 2 >{
+                bands[ 0 ],
+                bands[ 1 ],
+            };
+            ASSERT_TRUE( writer->write_rows( first_row, channels ) );
+        }
+        ASSERT_TRUE( writer->finish( ) );
+    }
+
+    EXPECT_EQ( std::filesystem::file_size( path ), utils::tiled_field_file_size( layout ) );
+
+    auto const reader = utils::TiledFieldReader::open( path );
+    ASSERT_TRUE( reader ) << reader.error( ).debug_error_message( );
+    EXPECT_EQ( reader->layout( ), layout );
+
+    for ( auto y = 0; y < layout.size_pixels.y; ++y )
+    {
+        for ( auto x = 0; x < layout.size_pixels.x; ++x )
+        {
+            ASSERT_EQ( reader->value( { x, y }, 1 ), expected_value( x, y, 1 ) ) << x << ", " << y;
+        }
+    }
+
+    // The top right tile is padded with zeros.
+    auto const corner = reader->tile( { 4, 5 }, 0 );
+    EXPECT_EQ( corner[ 0 ], expected_value( 64, 40, 0 ) );
+    EXPECT_EQ( corner[ utils::array_index( 6, 0, 16 ) ], 0.0F );
+    EXPECT_EQ( corner[ utils::array_index( 0, 5, 16 ) ], 0.0F );
+
+    // A region spanning several tiles in both directions.
+    auto const region = math::Range2Di{ .min = { 5, 3 }, .max = { 50, 30 } };
+    auto       values = std::vector< float32 >( 45 * 27 );
+    ASSERT_TRUE( reader->read( region, 0, values ) );
+    for ( auto y = region.min.y; y < region.max.y; ++y )
+    {
+        for ( auto x = region.min.x; x < region.max.x; ++x )
+        {
+            auto const index = utils::array_index( x - region.min.x, y - region.min.y, 45 );
+            ASSERT_EQ( values[ index ], expected_value( x, y, 0 ) ) << x << ", " << y;
+        }
+    }
+
+    EXPECT_FALSE( reader->read( region, 2, values ) );
+    EXPECT_FALSE( reader->read( { .min = { 0, 0 }, .max = { 71, 1 } }, 0, values ) );
+    EXPECT_FALSE( reader->read( region, 0, std::span( values ).first( 10 ) ) );
+
+    std::filesystem::remove( path );
+}
+
+TEST( TiledFieldTests, TilesCanBeWrittenInAnyOrder )
+{
+    auto const path   = temp_path( "any_order" );
+    auto const layout = utils::TiledFieldLayout{ .size_pixels = { 8, 8 }, .tile_size = { 4, 4 } };
+
+    auto writer = utils::TiledFieldWriter::create( path, layout );
+    ASSERT_TRUE( writer );
+
+    auto const write = [ & ]( glm::ivec2 const tile )
+    {
+        auto values = std::vector< float32 >( 16 );
+        for ( auto i = 0_UZ; i < values.size( ); ++i )
+        {
+            auto const index = static_cast< int32 >( i );
+            auto const pixel = ( tile * 4 ) + glm::ivec2( index % 4, index / 4 );
+            values[ i ]      = expected_value( pixel.x, pixel.y, 0 );
+        }
+        return writer->write_tile( tile, values );
+    };
+
+    ASSERT_TRUE( write( { 1, 1 } ) );
+    ASSERT_TRUE( write( { 0, 0 } ) );
+    ASSERT_TRUE( write( { 1, 0 } ) );
+    EXPECT_FALSE( write( { 2, 0 } ) );
+    EXPECT_FALSE( writer->write_tile( { 0, 1 }, std::vector< float32 >( 15 ) ) );
+
+    // One tile is still missing.
+    EXPECT_FALSE( writer->finish( ) );
+
+    writer = utils::TiledFieldWriter::create( path, layout );
+    ASSERT_TRUE( writer );
+    for ( auto const tile : { glm::ivec2{ 0, 1 }, { 1, 1 }, { 1, 0 }, { 0, 0 } } )
+    {
+        ASSERT_TRUE( write( tile ) );
+    }
+    ASSERT_TRUE( writer->finish( ) );
+
+    auto const reader = utils::TiledFieldReader::open( path );
+    ASSERT_TRUE( reader );
+    EXPECT_EQ( reader->value( { 2, 6 }, 0 ), expected_value( 2, 6, 0 ) );
+    EXPECT_EQ( reader->value( { 7, 3 }, 0 ), expected_value( 7, 3, 0 ) );
+
+    std::filesystem::remove( path );
+}
+
+TEST( TiledFieldTests, OpenRejectsOtherFiles )
+{
+    auto const path = temp_path( "invalid" );
+
+    EXPECT_FALSE( utils::TiledFieldReader::open( path ) );
+
+    {
+        auto file = std::ofstream( path, std::ios::binary );
+        file << "Not a tiled field";
+    }
+    EXPECT_FALSE( utils::TiledFieldReader::open( path ) );
+
+    // A valid header with the tiles cut off.
+    auto const layout = utils::TiledFieldLayout{ .size_pixels = { 8, 8 }, .tile_size = { 4, 4 } };
+    {
+        auto writer = utils::TiledFieldWriter::create( path, layout );
+        ASSERT_TRUE( writer );
+    }
+    std::filesystem::resize_file( path, utils::tiled_field_file_size( layout ) - 4_UZ );
+    EXPECT_FALSE( utils::TiledFieldReader::open( path ) );
+
+    EXPECT_FALSE( utils::TiledFieldWriter::create( path, { .tile_size = { 0, 4 } } ) );
+
+    std::filesystem::remove( path );
+}
+
+} // namespace
+} // namespace ltb
@@ -0,0 +1,212 @@
+#include "ltb/vor/bearing_receiver.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+#include "ltb/vor/constants.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace ltb::vor
+{
+namespace
+{
+
+using Consts = Constants< float64 >;
+
+constexpr auto composite_channel     = 0_UZ;
+constexpr auto discriminator_channel = 1_UZ;
+
+constexpr auto mean_tone       = 0_UZ;
+constexpr auto navigation_tone = 1_UZ;
+
+/// \brief Samples mixed down and filtered together.
+constexpr auto block_size = 256_UZ;
+
+/// \brief \p angle wrapped to [0, 2π).
+auto wrap_angle( float64 const angle ) -> float64
+{
+    auto const wrapped = std::fmod( angle, glm::two_pi< float64 >( ) );
+    return ( wrapped < 0.0 ) ? ( wrapped + glm::two_pi< float64 >( ) ) : wrapped;
+}
+
+auto phase( glm::dvec2 const value ) -> float64
+{
+    return std::atan2( value.y, value.x );
+}
+
+} // namespace
+
+BearingReceiver::BearingReceiver( BearingReceiverParams params )
+    : params_( params )
+    , subcarrier_filter_(
+          dsp::low_pass_fir(
+              params_.subcarrier_filter_taps,
+              params_.subcarrier_cutoff_hz,
+              params_.sample_rate_hz
+          ),
+          2
+      )
+    , tones_( {
+          .sample_rate_hz = params_.sample_rate_hz,
+          .window_hz      = Consts::navigation_frequency_hz( ),
+          .tones_hz       = { 0.0, Consts::navigation_frequency_hz( ) },
+          .channel_count  = 2,
+          .start_time_s   = params_.start_time_s,
+      } )
+{
+    auto const step = 1.0 / params_.sample_rate_hz;
+    subcarrier_ = dsp::Oscillator{ Consts::subcarrier_frequency_hz( ), params_.start_time_s, step };
+
+    // The filter delays by (taps - 1) / 2 samples and the discriminator, which compares
+    // consecutive samples, by another half.
+    auto const taps      = static_cast< float64 >( subcarrier_filter_.taps( ).size( ) );
+    auto const delay_s   = taps * 0.5 * step;
+    reference_delay_rad_ = glm::two_pi< float64 >( ) * Consts::navigation_frequency_hz( ) * delay_s;
+}
+
+auto BearingReceiver::params( ) const -> BearingReceiverParams const&
+{
+    return params_;
+}
+
+auto BearingReceiver::sample_count( ) const -> std::size_t
+{
+    return sample_count_;
+}
+
+auto BearingReceiver::process(
+    std::span< float32 const > const composite,
+    BearingOutput const              output
+) -> utils::Result< void >
+{
+    LTB_CHECK_VALID(
+        tones_.window_size( ) > 0_UZ,
+        "The sample rate must be a positive multiple of 30 Hz"
+    );
+    auto const highest_hz = Consts::subcarrier_frequency_hz( ) + params_.subcarrier_cutoff_hz;
+    LTB_CHECK_VALID(
+        ( params_.subcarrier_cutoff_hz > Consts::subcarrier_deviation_hz( ) )
+            && ( params_.sample_rate_hz > ( 2.0 * highest_hz ) ),
+        "The subcarrier filter must pass the deviation and fit below the Nyquist frequency"
+    );
+    auto const taps = subcarrier_filter_.taps( ).size( );
+    LTB_CHECK_VALID(
+        ( taps >= 3_UZ ) && ( 1_UZ == ( taps % 2_UZ ) ),
+        "The subcarrier filter needs an odd number of taps, at least 3"
+    );
+
+    auto const samples = composite.size( );
+    if ( ( output.bearing_rad.size( ) != samples ) || ( output.variable_depth.size( ) != samples )
+         || ( output.deviation_hz.size( ) != samples ) )
+    {
+        return LTB_MAKE_UNEXPECTED_ERROR(
+            "Bearing output size mismatch. Got composite: {}, bearing: {}, depth: {}, "
+            "deviation: {}",
+            samples,
+            output.bearing_rad.size( ),
+            output.variable_depth.size( ),
+            output.deviation_hz.size( )
+        );
+    }
+
+    // x e^(-iΩt) moves the subcarrier to 0 Hz, as two channels: real and imaginary.
+    auto baseband = std::array< float32, 2_UZ * block_size >{ };
+
+    for ( auto start = 0_UZ; start < samples; start += block_size )
+    {
+        auto const count = std::min( block_size, samples - start );
+        auto const mixed = std::span( baseband ).first( 2_UZ * count );
+
+        for ( auto i = 0_UZ; i < count; ++i )
+        {
+            auto const sample = sample_count_ + start + i;
+            if ( 0_UZ == ( sample % dsp::Oscillator::reseed_interval ) )
+            {
+                subcarrier_.reseed( sample );
+            }
+
+            auto const subcarrier = subcarrier_.phasor( );
+            auto const x          = composite[ start + i ];
+
+            mixed[ 2_UZ * i ]            = x * static_cast< float32 >( subcarrier.x );
+            mixed[ ( 2_UZ * i ) + 1_UZ ] = -x * static_cast< float32 >( subcarrier.y );
+
+            subcarrier_.advance( );
+        }
+
+        LTB_CHECK( subcarrier_filter_.process( mixed, mixed ) );
+
+        for ( auto i = 0_UZ; i < count; ++i )
+        {
+            auto const filtered     = glm::dvec2( mixed[ 2_UZ * i ], mixed[ ( 2_UZ * i ) + 1_UZ ] );
+            auto const frequency_hz = discriminate( filtered );
+
+            auto const frame
+                = std::array{ composite[ start + i ], static_cast< float32 >( frequency_hz ) };
+            tones_.push( frame );
+
+            auto const mean      = tones_.value( mean_tone, composite_channel ).x;
+            auto const variable  = tones_.value( navigation_tone, composite_channel );
+            auto const reference = tones_.value( navigation_tone, discriminator_channel );
+
+            auto const reference_rad = phase( reference ) + reference_delay_rad_;
+            auto const index         = start + i;
+
+            output.bearing_rad[ index ]
+                = static_cast< float32 >( wrap_angle( reference_rad - phase( variable ) ) );
+            output.variable_depth[ index ]
+                = ( mean > 0.0 ) ? static_cast< float32 >( glm::length( variable ) / mean ) : 0.0F;
+            output.deviation_hz[ index ] = static_cast< float32 >( glm::length( reference ) );
+        }
+    }
+
+    sample_count_ += samples;
+
+    return utils::success( );
+}
+
+auto BearingReceiver::process_iq( std::span< dsp::Iq const > const iq, BearingOutput const output )
+    -> utils::Result< void >
+{
+    auto const samples = iq.size( );
+    LTB_CHECK_VALID(
+        ( output.bearing_rad.size( ) == samples ) && ( output.variable_depth.size( ) == samples )
+            && ( output.deviation_hz.size( ) == samples ),
+        "Every output must hold one value per sample"
+    );
+
+    auto composite = std::array< float32, 256 >{ };
+    for ( auto start = 0_UZ; start < samples; start += composite.size( ) )
+    {
+        auto const count  = std::min( composite.size( ), samples - start );
+        auto const values = std::span( composite ).first( count );
+        LTB_CHECK( dsp::envelope( iq.subspan( start, count ), values ) );
+        LTB_CHECK( process(
+            values,
+            {
+                .bearing_rad    = output.bearing_rad.subspan( start, count ),
+                .variable_depth = output.variable_depth.subspan( start, count ),
+                .deviation_hz   = output.deviation_hz.subspan( start, count ),
+            }
+        ) );
+    }
+    return utils::success( );
+}
+
+auto BearingReceiver::discriminate( glm::dvec2 const filtered ) -> float64
+{
+    // The phase step between consecutive samples: arg(y[n] conj(y[n - 1])).
+    auto const step_re = ( filtered.x * previous_.x ) + ( filtered.y * previous_.y );
+    auto const step_im = ( filtered.y * previous_.x ) - ( filtered.x * previous_.y );
+    previous_          = filtered;
+
+    return std::atan2( step_im, step_re ) * params_.sample_rate_hz / glm::two_pi< float64 >( );
+}
+
+} // namespace ltb::vor
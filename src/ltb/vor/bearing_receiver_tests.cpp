@@ -0,0 +1,319 @@
+// project
+#include "ltb/dsp/iq_recording.hpp"
+#include "ltb/dsp/resampler.hpp"
+#include "ltb/vor/bearing_receiver.hpp"
+#include "ltb/vor/modulator.hpp"
+#include "ltb/vor/signal_chain.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+#include <gtest/gtest.h>
+
+// standard
+#include <cmath>
+#include <filesystem>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+/// \brief The smallest angle between two bearings.
+auto bearing_error( float32 const a, float32 const b ) -> float32
+{
+    auto const difference = std::remainder( a - b, glm::two_pi< float32 >( ) );
+    return std::abs( difference );
+}
+
+TEST( BearingReceiverTests, RecoversEveryBearing )
+{
+    constexpr auto sample_rate_hz = 48'000.0;
+    constexpr auto samples        = 4'800_UZ;
+
+    for ( auto degrees = 0; degrees < 360; degrees += 15 )
+    {
+        auto const bearing_rad = glm::radians( static_cast< float32 >( degrees ) );
+
+        auto modulator = vor::Modulator{ {
+            .sample_rate_hz = sample_rate_hz,
+            .start_time_s   = 1.25,
+            .bearing_rad    = bearing_rad,
+        } };
+        auto receiver  = vor::BearingReceiver{ { .sample_rate_hz = sample_rate_hz } };
+
+        auto composite      = std::vector< float32 >( samples );
+        auto bearing        = std::vector< float32 >( samples );
+        auto variable_depth = std::vector< float32 >( samples );
+        auto deviation_hz   = std::vector< float32 >( samples );
+
+        modulator.process( composite );
+        ASSERT_TRUE( receiver.process(
+            composite,
+            {
+                .bearing_rad    = bearing,
+                .variable_depth = variable_depth,
+                .deviation_hz   = deviation_hz,
+            }
+        ) );
+
+        // Settled after one 30 Hz period and the filter.
+        for ( auto i = 1'700_UZ; i < samples; i += 97_UZ )
+        {
+            EXPECT_LT( bearing_error( bearing[ i ], bearing_rad ), glm::radians( 0.05F ) )
+                << degrees << " deg, sample " << i;
+            EXPECT_NEAR( variable_depth[ i ], 0.3F, 1.0e-3F );
+            EXPECT_NEAR( deviation_hz[ i ], 480.0F, 2.0F );
+        }
+    }
+}
+
+TEST( BearingReceiverTests, ComplexBasebandIgnoresTheCarrierOffset )
+{
+    constexpr auto samples = 4'800_UZ;
+
+    auto const bearing_rad = glm::radians( 200.0F );
+
+    auto modulator = vor::Modulator{ { .bearing_rad = bearing_rad, .carrier_offset_hz = 750.0 } };
+    auto receiver  = vor::BearingReceiver{ { } };
+
+    auto iq             = std::vector< dsp::Iq >( samples );
+    auto bearing        = std::vector< float32 >( samples );
+    auto variable_depth = std::vector< float32 >( samples );
+    auto deviation_hz   = std::vector< float32 >( samples );
+
+    modulator.process_iq( std::span( iq ).first( 1'000 ) );
+    modulator.process_iq( std::span( iq ).subspan( 1'000 ) );
+    EXPECT_GT( std::abs( iq[ 10 ].y ), 0.1F );
+
+    ASSERT_TRUE( receiver.process_iq(
+        iq,
+        {
+            .bearing_rad    = bearing,
+            .variable_depth = variable_depth,
+            .deviation_hz   = deviation_hz,
+        }
+    ) );
+
+    EXPECT_LT( bearing_error( bearing.back( ), bearing_rad ), glm::radians( 0.05F ) );
+    EXPECT_NEAR( variable_depth.back( ), 0.3F, 1.0e-3F );
+    EXPECT_NEAR( deviation_hz.back( ), 480.0F, 2.0F );
+}
+
+TEST( BearingReceiverTests, StreamsThroughTheChain )
+{
+    auto const params = vor::ModulatorParams{ .bearing_rad = glm::radians( 123.0F ) };
+    auto       modulator = vor::Modulator{ params };
+    auto       receiver  = vor::BearingReceiver{ { } };
+
+    // Mismatched block sizes so the ring buffer wraps.
+    auto       last_bearing = 0.0F;
+    auto       received     = 0_UZ;
+    auto const throughput   = vor::run_signal_chain(
+        modulator,
+        receiver,
+        48'000,
+        { .modulator_block_size = 700, .receiver_block_size = 1'024 },
+        [ & ]( std::span< float32 const > const composite, vor::BearingOutput const& output )
+        {
+            EXPECT_EQ( composite.size( ), output.bearing_rad.size( ) );
+            received += composite.size( );
+            last_bearing = output.bearing_rad.back( );
+        }
+    );
+
+    ASSERT_TRUE( throughput ) << throughput.error( ).debug_error_message( );
+    EXPECT_EQ( received, 48'000_UZ );
+    EXPECT_EQ( modulator.sample_count( ), 48'000_UZ );
+    EXPECT_EQ( receiver.sample_count( ), 48'000_UZ );
+    EXPECT_GT( throughput->modulator_samples_per_s, 0.0 );
+    EXPECT_GT( throughput->receiver_samples_per_s, 0.0 );
+    EXPECT_LT( bearing_error( last_bearing, params.bearing_rad ), glm::radians( 0.05F ) );
+
+    // Streaming in pieces matches one call.
+    auto whole_modulator = vor::Modulator{ params };
+    auto whole           = std::vector< float32 >( 48'000 );
+    whole_modulator.process( whole );
+
+    auto piecewise = vor::Modulator{ params };
+    auto pieces    = std::vector< float32 >( 48'000 );
+    piecewise.process( std::span( pieces ).first( 10'001 ) );
+    piecewise.process( std::span( pieces ).subspan( 10'001 ) );
+    EXPECT_EQ( pieces, whole );
+}
+
+TEST( BearingReceiverTests, BearingErrorFallsAsNoiseDrops )
+{
+    constexpr auto trials      = 8U;
+    auto const     bearing_rad = glm::radians( 200.0F );
+
+    // Independent noise streams per trial, as parallel Monte-Carlo runs would use. The
+    // carrier is the composite's unit mean.
+    auto const rms_error_deg = [ bearing_rad ]( float64 const cnr_db ) -> float32
+    {
+        auto squares = 0.0F;
+        for ( auto trial = 0U; trial < trials; ++trial )
+        {
+            auto modulator = vor::Modulator{ { .bearing_rad = bearing_rad } };
+            auto receiver  = vor::BearingReceiver{ { } };
+            auto last      = 0.0F;
+
+            auto const chain = vor::ChainParams{
+                .impairments = {
+                    .noise_sigma = dsp::noise_sigma( 1.0, cnr_db ),
+                    .seed        = 17U,
+                    .stream      = trial,
+                },
+            };
+            auto const throughput = vor::run_signal_chain(
+                modulator,
+                receiver,
+                48'000,
+                chain,
+                [ &last ]( std::span< float32 const >, vor::BearingOutput const& output )
+                { last = output.bearing_rad.back( ); }
+            );
+            EXPECT_TRUE( throughput );
+
+            auto const error = glm::degrees( bearing_error( last, bearing_rad ) );
+            squares += error * error;
+        }
+        return std::sqrt( squares / static_cast< float32 >( trials ) );
+    };
+
+    // The error is proportional to the noise amplitude, about √10 less per 10 dB.
+    auto const noisy = rms_error_deg( 10.0 );
+    auto const fair  = rms_error_deg( 20.0 );
+    auto const clean = rms_error_deg( 30.0 );
+    EXPECT_GT( noisy, 2.0F * fair );
+    EXPECT_GT( fair, 2.0F * clean );
+    EXPECT_LT( clean, 0.5F );
+}
+
+TEST( BearingReceiverTests, DecodesARecording )
+{
+    auto const path        = std::filesystem::temp_directory_path( ) / "ltb_vor_recording.bin";
+    auto const bearing_rad = glm::radians( 310.0F );
+
+    // One second of a station received 500 Hz off tune, stored as 16-bit samples. The
+    // envelope peaks above 1, so it is scaled down to fit.
+    {
+        auto modulator = vor::Modulator{ {
+            .bearing_rad       = bearing_rad,
+            .carrier_offset_hz = 500.0,
+        } };
+        auto iq        = std::vector< dsp::Iq >( 48'000 );
+        modulator.process_iq( iq );
+        for ( auto& sample : iq )
+        {
+            sample *= 0.5F;
+        }
+        ASSERT_TRUE( dsp::write_iq_recording(
+            path,
+            { .format = dsp::IqFormat::Cs16, .sample_rate_hz = 48'000.0 },
+            iq
+        ) );
+    }
+
+    auto recording = dsp::IqRecording::open( path );
+    ASSERT_TRUE( recording );
+
+    // Skip the first half second; the receiver settles on the rest.
+    ASSERT_TRUE( recording->seek_time( 0.5 ) );
+
+    auto const sample_rate_hz = recording->info( ).sample_rate_hz;
+    auto       receiver       = vor::BearingReceiver{ { .sample_rate_hz = sample_rate_hz } };
+
+    auto bearing        = std::vector< float32 >( 1'024 );
+    auto variable_depth = std::vector< float32 >( 1'024 );
+    auto deviation_hz   = std::vector< float32 >( 1'024 );
+    auto last_bearing   = 0.0F;
+
+    for ( auto block = recording->next_block( 1'024 ); !block.empty( );
+          block      = recording->next_block( 1'024 ) )
+    {
+        auto const count = block.size( );
+        ASSERT_TRUE( receiver.process_iq(
+            block,
+            {
+                .bearing_rad    = std::span( bearing ).first( count ),
+                .variable_depth = std::span( variable_depth ).first( count ),
+                .deviation_hz   = std::span( deviation_hz ).first( count ),
+            }
+        ) );
+        last_bearing = bearing[ count - 1_UZ ];
+    }
+
+    EXPECT_EQ( receiver.sample_count( ), 24'000_UZ );
+    EXPECT_LT( bearing_error( last_bearing, bearing_rad ), glm::radians( 0.05F ) );
+
+    std::filesystem::remove( path );
+}
+
+TEST( BearingReceiverTests, DecodesAWidebandCapture )
+{
+    constexpr auto capture_rate_hz = 960'000.0;
+    constexpr auto decimation      = 20_UZ;
+    auto const     bearing_rad     = glm::radians( 75.0F );
+
+    // Half a second captured 20 times faster than the receiver runs, 5 kHz off tune.
+    auto modulator = vor::Modulator{ {
+        .sample_rate_hz    = capture_rate_hz,
+        .bearing_rad       = bearing_rad,
+        .carrier_offset_hz = 5'000.0,
+    } };
+    auto capture = std::vector< dsp::Iq >( 480'000 );
+    modulator.process_iq( capture );
+
+    auto front_end = dsp::ResamplerCascade{ dsp::decimation_stages( decimation, 0.8, 2 ) };
+    auto iq        = std::vector< dsp::Iq >( front_end.output_count( capture.size( ) ) );
+    ASSERT_EQ( iq.size( ), 24'000_UZ );
+    ASSERT_TRUE( front_end.process( capture, iq ) );
+
+    auto receiver = vor::BearingReceiver{ {
+        .sample_rate_hz = capture_rate_hz / static_cast< float64 >( decimation ),
+    } };
+
+    auto bearing        = std::vector< float32 >( iq.size( ) );
+    auto variable_depth = std::vector< float32 >( iq.size( ) );
+    auto deviation_hz   = std::vector< float32 >( iq.size( ) );
+    ASSERT_TRUE( receiver.process_iq(
+        iq,
+        {
+            .bearing_rad    = bearing,
+            .variable_depth = variable_depth,
+            .deviation_hz   = deviation_hz,
+        }
+    ) );
+
+    EXPECT_LT( bearing_error( bearing.back( ), bearing_rad ), glm::radians( 0.05F ) );
+    EXPECT_NEAR( variable_depth.back( ), 0.3F, 1.0e-3F );
+}
+
+TEST( BearingReceiverTests, RejectsInvalidParams )
+{
+    auto composite = std::vector< float32 >( 10 );
+    auto values    = std::vector< float32 >( 10 );
+    auto const output = vor::BearingOutput{
+        .bearing_rad    = values,
+        .variable_depth = values,
+        .deviation_hz   = values,
+    };
+
+    EXPECT_FALSE(
+        vor::BearingReceiver( { .sample_rate_hz = 48'010.0 } ).process( composite, output )
+    );
+    EXPECT_FALSE(
+        vor::BearingReceiver( { .sample_rate_hz = 12'000.0 } ).process( composite, output )
+    );
+    EXPECT_FALSE(
+        vor::BearingReceiver( { .subcarrier_filter_taps = 64 } ).process( composite, output )
+    );
+
+    auto receiver = vor::BearingReceiver{ { } };
+    EXPECT_TRUE( receiver.process( composite, output ) );
+    EXPECT_FALSE( receiver.process( std::span( composite ).first( 9 ), output ) );
+}
+
+} // namespace
+} // namespace ltb
@@ -0,0 +1,248 @@
+#include "ltb/vor/bearing_sweep.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <execution>
+#include <numeric>
+
+namespace ltb::vor
+{
+namespace
+{
+
+/// \brief Envelope samples per 30 Hz period. The envelope's harmonics fall off quickly, so
+///        they barely alias into the 30 Hz bin.
+constexpr auto envelope_samples = 16_UZ;
+
+/// \brief Far enough that the array looks like a point, used to align the station.
+constexpr auto alignment_range_m = 100'000.0;
+
+/// \brief \p angle wrapped to [0, 2π).
+auto wrap_angle( float64 const angle ) -> float64
+{
+    auto const wrapped = std::fmod( angle, glm::two_pi< float64 >( ) );
+    return ( wrapped < 0.0 ) ? ( wrapped + glm::two_pi< float64 >( ) ) : wrapped;
+}
+
+/// \brief \p angle wrapped to [-π, π).
+auto wrap_signed_angle( float64 const angle ) -> float64
+{
+    return wrap_angle( angle + glm::pi< float64 >( ) ) - glm::pi< float64 >( );
+}
+
+} // namespace
+
+auto square_layout( float32 const half_side_m ) -> std::vector< SidebandElement >
+{
+    return {
+        {
+            .position_m           = { -half_side_m, -half_side_m },
+            .modulation_phase_rad = 0.0F * glm::two_pi< float32 >( ),
+        },
+        {
+            .position_m           = { +half_side_m, +half_side_m },
+            .modulation_phase_rad = 0.5F * glm::two_pi< float32 >( ),
+        },
+        {
+            .position_m           = { -half_side_m, +half_side_m },
+            .modulation_phase_rad = 0.25F * glm::two_pi< float32 >( ),
+        },
+        {
+            .position_m           = { +half_side_m, -half_side_m },
+            .modulation_phase_rad = 0.75F * glm::two_pi< float32 >( ),
+        },
+    };
+}
+
+auto BearingErrorTable::at(
+    std::size_t const altitude,
+    std::size_t const radial,
+    std::size_t const range
+) const -> float32
+{
+    return altitude_plane( altitude )[ utils::array_index( range, radial, grid.ranges_m.size( ) ) ];
+}
+
+auto BearingErrorTable::altitude_plane( std::size_t const altitude ) const
+    -> std::span< float32 const >
+{
+    auto const plane_size = grid.radials_rad.size( ) * grid.ranges_m.size( );
+    return std::span( error_rad ).subspan( altitude * plane_size, plane_size );
+}
+
+BearingSweep::BearingSweep( StationParams params )
+    : params_( std::move( params ) )
+    , wavenumber_( wavenumber( params_.carrier_frequency_hz ) )
+{
+    carrier_sources_ = path_sources( { 0.0F, 0.0F, params_.antenna_height_m }, params_.reflectors );
+
+    for ( auto const& element : params_.sideband_elements )
+    {
+        element_sources_.push_back( path_sources(
+            glm::vec3( element.position_m, params_.antenna_height_m ),
+            params_.reflectors
+        ) );
+
+        auto& modulation = element_modulation_.emplace_back( envelope_samples );
+        for ( auto n = 0_UZ; n < envelope_samples; ++n )
+        {
+            auto const cycles
+                = static_cast< float64 >( n ) / static_cast< float64 >( envelope_samples );
+            modulation[ n ] = std::cos(
+                ( glm::two_pi< float64 >( ) * cycles )
+                - static_cast< float64 >( element.modulation_phase_rad )
+            );
+        }
+    }
+
+    if ( !params_.sideband_elements.empty( ) )
+    {
+        auto const north = glm::dvec3( 0.0, alignment_range_m, params_.antenna_height_m );
+        north_offset_rad_ = raw_bearing( north, true );
+    }
+}
+
+auto BearingSweep::params( ) const -> StationParams const&
+{
+    return params_;
+}
+
+auto BearingSweep::bearing( glm::dvec3 const position_m ) const -> float64
+{
+    return wrap_angle( raw_bearing( position_m, false ) - north_offset_rad_ );
+}
+
+auto BearingSweep::sweep( SweepGrid grid ) const -> utils::Result< BearingErrorTable >
+{
+    LTB_CHECK_VALID( params_.carrier_frequency_hz > 0.0 );
+    LTB_CHECK_VALID( !params_.sideband_elements.empty( ), "The station has no sideband elements" );
+    LTB_CHECK_VALID(
+        std::ranges::all_of( grid.ranges_m, []( float32 const range ) { return range > 0.0F; } ),
+        "Ranges must be positive"
+    );
+
+    auto const plane_size = grid.radials_rad.size( ) * grid.ranges_m.size( );
+
+    auto table = BearingErrorTable{
+        .grid      = std::move( grid ),
+        .error_rad = { },
+    };
+    table.error_rad.resize( plane_size * table.grid.altitudes_m.size( ) );
+
+    // One job per radial per altitude, each filling a contiguous run of ranges.
+    auto jobs = std::vector< std::size_t >( table.grid.altitudes_m.size( )
+                                            * table.grid.radials_rad.size( ) );
+    std::iota( jobs.begin( ), jobs.end( ), 0_UZ );
+
+    std::for_each(
+        std::execution::par,
+        jobs.begin( ),
+        jobs.end( ),
+        [ this, &table ]( std::size_t const job )
+        {
+            auto const& axes       = table.grid;
+            auto const  altitude_m = axes.altitudes_m[ job / axes.radials_rad.size( ) ];
+            auto const  radial_rad = axes.radials_rad[ job % axes.radials_rad.size( ) ];
+            auto const  direction  = glm::dvec2( std::sin( radial_rad ), std::cos( radial_rad ) );
+
+            auto const errors
+                = std::span( table.error_rad ).subspan( job * axes.ranges_m.size( ) );
+
+            for ( auto r = 0_UZ; r < axes.ranges_m.size( ); ++r )
+            {
+                auto const position = glm::dvec3(
+                    direction * static_cast< float64 >( axes.ranges_m[ r ] ),
+                    altitude_m
+                );
+                errors[ r ] = static_cast< float32 >(
+                    wrap_signed_angle( bearing( position ) - static_cast< float64 >( radial_rad ) )
+                );
+            }
+        }
+    );
+
+    return table;
+}
+
+auto BearingSweep::raw_bearing( glm::dvec3 const position_m, bool const direct_only ) const
+    -> float64
+{
+    // Phases are taken relative to the direct carrier path, which keeps them precise at
+    // long range, and amplitudes relative to it so the result doesn't depend on range.
+    auto const reference_m = glm::length( position_m - carrier_sources_.front( ).position_m );
+
+    auto const receive_from = [ & ]( std::vector< PathSource > const& sources )
+    { return receive( sources, position_m, reference_m, wavenumber_, direct_only ); };
+
+    // The field at every envelope sample, built up one sideband element at a time.
+    auto fields = std::array< glm::dvec2, envelope_samples >{ };
+    fields.fill( receive_from( carrier_sources_ ) );
+
+    for ( auto i = 0_UZ; i < element_sources_.size( ); ++i )
+    {
+        // The sidebands are fed in quadrature with the carrier, which brings the lobes of
+        // each antiphase pair back in phase with it.
+        auto const received = receive_from( element_sources_[ i ] );
+        auto const sideband = glm::dvec2( received.y, -received.x )
+                            * static_cast< float64 >( params_.sideband_amplitude );
+
+        for ( auto n = 0_UZ; n < envelope_samples; ++n )
+        {
+            fields[ n ] += sideband * element_modulation_[ i ][ n ];
+        }
+    }
+
+    // The 30 Hz component of the envelope is `cos(ωt - bearing)`.
+    auto variable = glm::dvec2( 0.0 );
+    for ( auto n = 0_UZ; n < envelope_samples; ++n )
+    {
+        auto const angle = glm::two_pi< float64 >( ) * static_cast< float64 >( n )
+                         / static_cast< float64 >( envelope_samples );
+        variable += glm::length( fields[ n ] )
+                  * glm::dvec2( std::cos( angle ), -std::sin( angle ) );
+    }
+
+    return wrap_angle( -std::atan2( variable.y, variable.x ) );
+}
+
+auto summarize( BearingErrorTable const& table, std::size_t const altitude ) -> ErrorSummary
+{
+    auto const errors = table.altitude_plane( altitude );
+    auto       report = ErrorSummary{ };
+    if ( errors.empty( ) )
+    {
+        return report;
+    }
+
+    auto sum_squares = 0.0;
+    auto worst       = 0_UZ;
+    for ( auto i = 0_UZ; i < errors.size( ); ++i )
+    {
+        auto const error = static_cast< float64 >( errors[ i ] );
+        sum_squares += error * error;
+
+        if ( std::abs( errors[ i ] ) > std::abs( errors[ worst ] ) )
+        {
+            worst = i;
+        }
+    }
+
+    auto const range_count    = table.grid.ranges_m.size( );
+    report.max_abs_error_rad  = std::abs( errors[ worst ] );
+    report.rms_error_rad      = static_cast< float32 >(
+        std::sqrt( sum_squares / static_cast< float64 >( errors.size( ) ) )
+    );
+    report.worst_radial_rad = table.grid.radials_rad[ worst / range_count ];
+    report.worst_range_m    = table.grid.ranges_m[ worst % range_count ];
+    return report;
+}
+
+} // namespace ltb::vor
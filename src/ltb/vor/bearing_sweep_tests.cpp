@@ -0,0 +1,124 @@
+// project
+#include "ltb/ils/course_analysis.hpp"
+#include "ltb/vor/bearing_sweep.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+#include <gtest/gtest.h>
+
+// standard
+#include <cmath>
+
+namespace ltb
+{
+namespace
+{
+
+auto every_degree( ) -> std::vector< float32 >
+{
+    auto radials = std::vector< float32 >{ };
+    for ( auto degree = 0; degree < 360; ++degree )
+    {
+        radials.push_back( glm::radians( static_cast< float32 >( degree ) ) );
+    }
+    return radials;
+}
+
+TEST( BearingSweepTests, OctantalErrorGrowsWithTheArray )
+{
+    auto const grid = vor::SweepGrid{
+        .radials_rad = every_degree( ),
+        .ranges_m    = ils::linspace( { .min = 1'000.0F, .max = 50'000.0F }, 20 ),
+        .altitudes_m = { 300.0F, 3'000.0F },
+    };
+
+    auto const small = vor::BearingSweep{ { .sideband_elements = vor::square_layout( 0.1F ) } };
+    auto const large = vor::BearingSweep{ { .sideband_elements = vor::square_layout( 0.5F ) } };
+
+    auto const small_table = small.sweep( grid );
+    auto const large_table = large.sweep( grid );
+    ASSERT_TRUE( small_table ) << small_table.error( ).debug_error_message( );
+    ASSERT_TRUE( large_table ) << large_table.error( ).debug_error_message( );
+
+    ASSERT_EQ( small_table->error_rad.size( ), 360_UZ * 20_UZ * 2_UZ );
+
+    auto const small_summary = vor::summarize( *small_table, 0 );
+    auto const large_summary = vor::summarize( *large_table, 0 );
+    EXPECT_LT( small_summary.max_abs_error_rad, glm::radians( 0.5F ) );
+    EXPECT_GT( large_summary.max_abs_error_rad, glm::radians( 5.0F ) );
+
+    // A square array is exact on the diagonals and the axes, and worst in between.
+    for ( auto radial = 0_UZ; radial < 360_UZ; radial += 45_UZ )
+    {
+        EXPECT_NEAR( large_table->at( 1, radial, 19 ), 0.0F, glm::radians( 0.05F ) ) << radial;
+    }
+    auto const worst_degrees = glm::degrees( large_summary.worst_radial_rad );
+    EXPECT_NEAR( std::fmod( worst_degrees, 45.0F ), 22.5F, 5.0F );
+}
+
+TEST( BearingSweepTests, TableMatchesSinglePoints )
+{
+    auto const sweep = vor::BearingSweep{ {
+        .reflectors = { ils::ground_plane( { -1.0F, 0.0F } ) },
+    } };
+
+    auto const grid = vor::SweepGrid{
+        .radials_rad = { 0.3F, 2.0F, 4.5F },
+        .ranges_m    = { 500.0F, 8'000.0F },
+        .altitudes_m = { 100.0F, 900.0F },
+    };
+    auto const table = sweep.sweep( grid );
+    ASSERT_TRUE( table ) << table.error( ).debug_error_message( );
+
+    for ( auto a = 0_UZ; a < grid.altitudes_m.size( ); ++a )
+    {
+        for ( auto r = 0_UZ; r < grid.radials_rad.size( ); ++r )
+        {
+            for ( auto d = 0_UZ; d < grid.ranges_m.size( ); ++d )
+            {
+                auto const radial   = static_cast< float64 >( grid.radials_rad[ r ] );
+                auto const range    = static_cast< float64 >( grid.ranges_m[ d ] );
+                auto const position = glm::dvec3(
+                    range * std::sin( radial ),
+                    range * std::cos( radial ),
+                    grid.altitudes_m[ a ]
+                );
+
+                auto expected = sweep.bearing( position ) - radial;
+                expected      = std::remainder( expected, glm::two_pi< float64 >( ) );
+                EXPECT_NEAR( table->at( a, r, d ), expected, 1.0e-5 );
+            }
+        }
+    }
+}
+
+TEST( BearingSweepTests, WallsOnlyDisturbRadialsTheyReflectInto )
+{
+    // A 200 m wide wall 300 m north of the station, facing it.
+    auto const wall
+        = ils::vertical_wall( { 100.0F, 300.0F }, { -100.0F, 300.0F }, 20.0F, { -0.5F, 0.0F } );
+    auto const clean  = vor::BearingSweep{ { } };
+    auto const siting = vor::BearingSweep{ { .reflectors = { wall } } };
+
+    // South of the station the wall reflects back toward the receiver...
+    auto const south = glm::dvec3( -870.0, -4'920.0, 100.0 );
+    EXPECT_GT( std::abs( siting.bearing( south ) - clean.bearing( south ) ), 0.01 );
+
+    // ...but the specular point for a receiver to the east misses the wall.
+    auto const east = glm::dvec3( 5'000.0, 0.0, 100.0 );
+    EXPECT_DOUBLE_EQ( siting.bearing( east ), clean.bearing( east ) );
+}
+
+TEST( BearingSweepTests, RejectsInvalidSweeps )
+{
+    auto const grid = vor::SweepGrid{
+        .radials_rad = { 0.0F },
+        .ranges_m    = { 0.0F },
+        .altitudes_m = { 100.0F },
+    };
+    EXPECT_FALSE( vor::BearingSweep{ { } }.sweep( grid ) );
+    EXPECT_FALSE( vor::BearingSweep{ { .sideband_elements = { } } }.sweep( { } ) );
+}
+
+} // namespace
+} // namespace ltb
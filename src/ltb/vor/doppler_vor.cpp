@@ -0,0 +1,273 @@
+#include "ltb/vor/doppler_vor.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <numeric>
+#include <type_traits>
+
+namespace ltb::vor
+{
+namespace
+{
+
+/// \brief The carrier scale, sideband phasors and active elements of one sample, shared by
+///        every receiver.
+struct Commutation
+{
+    float32     carrier_scale = 1.0F;
+    glm::vec2   upper         = { 0.0F, 0.0F };
+    glm::vec2   lower         = { 0.0F, 0.0F };
+    std::size_t element       = 0;
+    float32     weight        = 1.0F;
+    float32     next_weight   = 0.0F;
+};
+
+/// \brief The unit phasor `frequency * time` cycles around, reduced to one cycle first so
+///        large times keep their precision.
+auto phasor( float64 const cycles ) -> glm::dvec2
+{
+    auto const angle = glm::two_pi< float64 >( ) * ( cycles - std::floor( cycles ) );
+    return { std::cos( angle ), std::sin( angle ) };
+}
+
+} // namespace
+
+auto doppler_ring_radius_m( float64 const carrier_frequency_hz ) -> float64
+{
+    using Vor = Constants< float64 >;
+
+    auto const wavelength_m = Vor::speed_of_light_m_s( ) / carrier_frequency_hz;
+    return Vor::subcarrier_deviation_hz( ) * wavelength_m
+         / ( glm::two_pi< float64 >( ) * Vor::navigation_frequency_hz( ) );
+}
+
+DopplerVor::DopplerVor( DopplerParams params )
+    : params_( std::move( params ) )
+    , wavenumber_( wavenumber( params_.carrier_frequency_hz ) )
+{
+    carrier_sources_ = path_sources( { 0.0F, 0.0F, params_.antenna_height_m }, params_.reflectors );
+    for ( auto const position : element_positions( ) )
+    {
+        element_sources_.push_back(
+            path_sources( glm::vec3( position, params_.antenna_height_m ), params_.reflectors )
+        );
+    }
+}
+
+auto DopplerVor::params( ) const -> DopplerParams const&
+{
+    return params_;
+}
+
+auto DopplerVor::sample_count( ) const -> std::size_t
+{
+    return sample_count_;
+}
+
+auto DopplerVor::element_positions( ) const -> std::vector< glm::vec2 >
+{
+    auto positions = std::vector< glm::vec2 >( params_.element_count );
+    for ( auto i = 0_UZ; i < positions.size( ); ++i )
+    {
+        auto const bearing = glm::two_pi< float64 >( ) * static_cast< float64 >( i )
+                           / static_cast< float64 >( positions.size( ) );
+        positions[ i ] = glm::vec2(
+            glm::dvec2( std::sin( bearing ), std::cos( bearing ) ) * params_.ring_radius_m
+        );
+    }
+    return positions;
+}
+
+auto DopplerVor::set_receivers( std::span< glm::vec3 const > const positions_m ) -> void
+{
+    receiver_count_ = positions_m.size( );
+
+    auto const antenna_count = 1_UZ + element_sources_.size( );
+    path_re_.resize( antenna_count * receiver_count_ );
+    path_im_.resize( antenna_count * receiver_count_ );
+
+    auto const carrier_m = carrier_sources_.front( ).position_m;
+
+    auto receivers = std::vector< std::size_t >( receiver_count_ );
+    std::iota( receivers.begin( ), receivers.end( ), 0_UZ );
+
+    std::for_each(
+        std::execution::par,
+        receivers.begin( ),
+        receivers.end( ),
+        [ this, positions_m, carrier_m, antenna_count ]( std::size_t const r )
+        {
+            auto const position    = glm::dvec3( positions_m[ r ] );
+            auto const reference_m = glm::length( position - carrier_m );
+
+            for ( auto a = 0_UZ; a < antenna_count; ++a )
+            {
+                auto const& sources
+                    = ( 0_UZ == a ) ? carrier_sources_ : element_sources_[ a - 1_UZ ];
+                auto const path = receive( sources, position, reference_m, wavenumber_ );
+
+                auto const index = utils::array_index( r, a, receiver_count_ );
+                path_re_[ index ] = static_cast< float32 >( path.x );
+                path_im_[ index ] = static_cast< float32 >( path.y );
+            }
+        }
+    );
+}
+
+auto DopplerVor::receiver_count( ) const -> std::size_t
+{
+    return receiver_count_;
+}
+
+auto DopplerVor::process( std::span< float32 > const composite ) -> utils::Result< void >
+{
+    return synthesize( composite );
+}
+
+auto DopplerVor::process_iq( std::span< dsp::Iq > const iq ) -> utils::Result< void >
+{
+    return synthesize( iq );
+}
+
+template < typename Sample >
+auto DopplerVor::synthesize( std::span< Sample > const samples ) -> utils::Result< void >
+{
+    using Vor = Constants< float64 >;
+
+    auto const element_count = params_.element_count;
+
+    LTB_CHECK_VALID( params_.sample_rate_hz > 0.0 );
+    LTB_CHECK_VALID( params_.ring_radius_m > 0.0 );
+    LTB_CHECK_VALID(
+        ( element_count >= 4_UZ ) && ( 0_UZ == element_count % 2_UZ ),
+        "The ring needs an even number of at least four elements"
+    );
+    LTB_CHECK_VALID( receiver_count_ > 0_UZ, "No receivers have been placed" );
+    LTB_CHECK_VALID(
+        0_UZ == samples.size( ) % receiver_count_,
+        "The output must hold a whole number of samples for every receiver"
+    );
+
+    auto const count = samples.size( ) / receiver_count_;
+
+    // Everything that only depends on time is worked out once per sample.
+    auto commutations = std::vector< Commutation >( count );
+    for ( auto i = 0_UZ; i < count; ++i )
+    {
+        auto const elapsed_s
+            = static_cast< float64 >( sample_count_ + i ) / params_.sample_rate_hz;
+        auto const time_s = params_.start_time_s + elapsed_s;
+
+        auto const navigation = phasor( Vor::navigation_frequency_hz( ) * time_s );
+        auto const subcarrier = phasor( Vor::subcarrier_frequency_hz( ) * time_s );
+        auto const sideband   = static_cast< float64 >( params_.sideband_amplitude );
+
+        // The upper sideband starts on the east element and turns anticlockwise once per
+        // period, so the Doppler shift leads the reference by the receiver's radial.
+        auto cycles = 0.25 - ( Vor::navigation_frequency_hz( ) * time_s );
+        cycles -= std::floor( cycles );
+
+        auto const position = cycles * static_cast< float64 >( element_count );
+        auto const fraction = position - std::floor( position );
+
+        auto& commutation         = commutations[ i ];
+        commutation.carrier_scale = static_cast< float32 >(
+            1.0 + ( static_cast< float64 >( params_.reference_depth ) * navigation.x )
+        );
+        commutation.upper = glm::vec2( subcarrier * sideband );
+        commutation.lower = glm::vec2( glm::dvec2( subcarrier.x, -subcarrier.y ) * sideband );
+
+        if ( params_.blend )
+        {
+            // Constant-power crossfade from one element to the next.
+            auto const angle        = glm::half_pi< float64 >( ) * fraction;
+            commutation.element     = static_cast< std::size_t >( position ) % element_count;
+            commutation.weight      = static_cast< float32 >( std::cos( angle ) );
+            commutation.next_weight = static_cast< float32 >( std::sin( angle ) );
+        }
+        else
+        {
+            auto const nearest  = static_cast< std::size_t >( std::round( position ) );
+            commutation.element = nearest % element_count;
+        }
+    }
+
+    auto rows = std::vector< std::size_t >( count );
+    std::iota( rows.begin( ), rows.end( ), 0_UZ );
+
+    std::for_each(
+        std::execution::par,
+        rows.begin( ),
+        rows.end( ),
+        [ this, samples, &commutations, element_count ]( std::size_t const i )
+        {
+            auto const& commutation = commutations[ i ];
+
+            // Row 0 is the carrier, then the ring. The lower sideband is on the opposite
+            // element.
+            auto const half_ring = element_count / 2_UZ;
+            auto const upper     = 1_UZ + commutation.element;
+            auto const lower     = 1_UZ + ( ( commutation.element + half_ring ) % element_count );
+            auto const next      = [ element_count ]( std::size_t const row )
+            { return 1_UZ + ( row % element_count ); };
+
+            auto const row = [ this ]( std::vector< float32 > const& paths, std::size_t const a )
+            { return std::span( paths ).subspan( a * receiver_count_, receiver_count_ ); };
+
+            auto const carrier_re    = row( path_re_, 0_UZ );
+            auto const carrier_im    = row( path_im_, 0_UZ );
+            auto const upper_re      = row( path_re_, upper );
+            auto const upper_im      = row( path_im_, upper );
+            auto const upper_next_re = row( path_re_, next( upper ) );
+            auto const upper_next_im = row( path_im_, next( upper ) );
+            auto const lower_re      = row( path_re_, lower );
+            auto const lower_im      = row( path_im_, lower );
+            auto const lower_next_re = row( path_re_, next( lower ) );
+            auto const lower_next_im = row( path_im_, next( lower ) );
+
+            auto const output = samples.subspan( i * receiver_count_, receiver_count_ );
+
+            auto const scale = commutation.carrier_scale;
+            auto const w0    = commutation.weight;
+            auto const w1    = commutation.next_weight;
+            auto const u     = commutation.upper;
+            auto const l     = commutation.lower;
+
+            for ( auto r = 0_UZ; r < receiver_count_; ++r )
+            {
+                // Field of the active elements, crossfaded.
+                auto const ur = ( w0 * upper_re[ r ] ) + ( w1 * upper_next_re[ r ] );
+                auto const ui = ( w0 * upper_im[ r ] ) + ( w1 * upper_next_im[ r ] );
+                auto const lr = ( w0 * lower_re[ r ] ) + ( w1 * lower_next_re[ r ] );
+                auto const li = ( w0 * lower_im[ r ] ) + ( w1 * lower_next_im[ r ] );
+
+                auto const re = ( scale * carrier_re[ r ] ) + ( ( u.x * ur ) - ( u.y * ui ) )
+                              + ( ( l.x * lr ) - ( l.y * li ) );
+                auto const im = ( scale * carrier_im[ r ] ) + ( ( u.x * ui ) + ( u.y * ur ) )
+                              + ( ( l.x * li ) + ( l.y * lr ) );
+
+                if constexpr ( std::is_same_v< Sample, dsp::Iq > )
+                {
+                    output[ r ] = { re, im };
+                }
+                else
+                {
+                    output[ r ] = std::sqrt( ( re * re ) + ( im * im ) );
+                }
+            }
+        }
+    );
+
+    sample_count_ += count;
+    return utils::success( );
+}
+
+} // namespace ltb::vor
@@ -0,0 +1,169 @@
+// project
+#include "ltb/dsp/tone_bank.hpp"
+#include "ltb/vor/bearing_receiver.hpp"
+#include "ltb/vor/doppler_vor.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+#include <gtest/gtest.h>
+
+// standard
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+TEST( DopplerVorTests, RingGivesTheStandardModulationIndex )
+{
+    auto const radius_m   = vor::doppler_ring_radius_m( 113.0e6 );
+    auto const wavenumber = vor::wavenumber( 113.0e6 );
+
+    // The index of the Doppler FM is k r = 480 Hz / 30 Hz, which puts the ring about
+    // 13.5 m across at this frequency, as on real stations.
+    EXPECT_NEAR( wavenumber * radius_m, 16.0, 1.0e-9 );
+    EXPECT_NEAR( radius_m, 6.76, 0.01 );
+
+    auto const dvor = vor::DopplerVor{ { } };
+    EXPECT_EQ( dvor.element_positions( ).size( ), 48_UZ );
+    EXPECT_NEAR( dvor.element_positions( )[ 12 ].x, radius_m, 1.0e-4 );
+}
+
+TEST( DopplerVorTests, ConventionalReceiverReadsEveryRadial )
+{
+    constexpr auto sample_rate_hz = 48'000.0;
+    constexpr auto samples        = 24'000_UZ;
+
+    auto receivers = std::vector< glm::vec3 >{ };
+    auto radials   = std::vector< float64 >{ };
+    for ( auto degree = 5; degree < 360; degree += 30 )
+    {
+        auto const radial = glm::radians( static_cast< float64 >( degree ) );
+        receivers.emplace_back( glm::dvec3( std::sin( radial ), std::cos( radial ), 0.0 ) * 10'000.0
+                                + glm::dvec3( 0.0, 0.0, 300.0 ) );
+        radials.push_back( radial );
+    }
+
+    auto dvor = vor::DopplerVor{ { .sample_rate_hz = sample_rate_hz } };
+    dvor.set_receivers( receivers );
+    ASSERT_EQ( dvor.receiver_count( ), receivers.size( ) );
+
+    auto composite = std::vector< float32 >( samples * receivers.size( ) );
+    ASSERT_TRUE( dvor.process( composite ) );
+
+    // The whole batch at once, as generated: every receiver hears the same 30 Hz AM, since
+    // they're all the same distance from the station.
+    auto tones = dsp::ToneBank{ {
+        .sample_rate_hz = sample_rate_hz,
+        .tones_hz       = { 30.0 },
+        .channel_count  = receivers.size( ),
+    } };
+    ASSERT_TRUE( tones.process( composite ) );
+
+    auto am_phases = std::vector< float32 >( receivers.size( ) );
+    ASSERT_TRUE( tones.phases( 0, am_phases ) );
+
+    for ( auto r = 0_UZ; r < receivers.size( ); ++r )
+    {
+        auto const am_offset = std::remainder(
+            static_cast< float64 >( am_phases[ r ] - am_phases.front( ) ),
+            glm::two_pi< float64 >( )
+        );
+        EXPECT_NEAR( am_offset, 0.0, 1.0e-3 ) << glm::degrees( radials[ r ] );
+
+        auto channel = std::vector< float32 >( samples );
+        for ( auto n = 0_UZ; n < samples; ++n )
+        {
+            channel[ n ] = composite[ ( n * receivers.size( ) ) + r ];
+        }
+
+        auto bearing        = std::vector< float32 >( samples );
+        auto variable_depth = std::vector< float32 >( samples );
+        auto deviation_hz   = std::vector< float32 >( samples );
+
+        auto receiver = vor::BearingReceiver{ { .sample_rate_hz = sample_rate_hz } };
+        ASSERT_TRUE( receiver.process(
+            channel,
+            {
+                .bearing_rad    = bearing,
+                .variable_depth = variable_depth,
+                .deviation_hz   = deviation_hz,
+            }
+        ) );
+
+        auto const error = std::remainder(
+            static_cast< float64 >( bearing.back( ) ) - radials[ r ],
+            glm::two_pi< float64 >( )
+        );
+        EXPECT_LT( std::abs( glm::degrees( error ) ), 0.5 ) << glm::degrees( radials[ r ] );
+        EXPECT_NEAR( variable_depth.back( ), 0.3F, 0.02F );
+        EXPECT_NEAR( deviation_hz.back( ), 480.0F, 15.0F );
+    }
+}
+
+TEST( DopplerVorTests, BlocksMatchOneCall )
+{
+    auto const receivers = std::vector< glm::vec3 >{
+        { 100.0F, 2'000.0F, 50.0F },
+        { -3'000.0F, -400.0F, 900.0F },
+        { 20.0F, 30.0F, 10.0F },
+    };
+
+    auto whole = vor::DopplerVor{ { .start_time_s = 7.0 } };
+    whole.set_receivers( receivers );
+
+    auto pieces = vor::DopplerVor{ { .start_time_s = 7.0 } };
+    pieces.set_receivers( receivers );
+
+    auto expected = std::vector< float32 >( 1'000 * receivers.size( ) );
+    ASSERT_TRUE( whole.process( expected ) );
+
+    auto actual = std::vector< float32 >( expected.size( ) );
+    ASSERT_TRUE( pieces.process( std::span( actual ).first( 333 * receivers.size( ) ) ) );
+    ASSERT_TRUE( pieces.process( std::span( actual ).subspan( 333 * receivers.size( ) ) ) );
+
+    EXPECT_EQ( actual, expected );
+    EXPECT_EQ( pieces.sample_count( ), 1'000_UZ );
+}
+
+TEST( DopplerVorTests, CompositeIsTheBasebandEnvelope )
+{
+    auto const receivers = std::vector< glm::vec3 >{
+        { 4'000.0F, -2'500.0F, 600.0F },
+        { -150.0F, 800.0F, 40.0F },
+    };
+
+    auto detected = vor::DopplerVor{ { } };
+    auto baseband = vor::DopplerVor{ { } };
+    detected.set_receivers( receivers );
+    baseband.set_receivers( receivers );
+
+    auto composite = std::vector< float32 >( 500 * receivers.size( ) );
+    auto iq        = std::vector< dsp::Iq >( composite.size( ) );
+    ASSERT_TRUE( detected.process( composite ) );
+    ASSERT_TRUE( baseband.process_iq( iq ) );
+
+    for ( auto i = 0_UZ; i < iq.size( ); ++i )
+    {
+        EXPECT_NEAR( glm::length( iq[ i ] ), composite[ i ], 1.0e-5F ) << i;
+    }
+}
+
+TEST( DopplerVorTests, RejectsInvalidRings )
+{
+    auto composite = std::vector< float32 >( 10 );
+    auto receiver  = std::array{ glm::vec3( 0.0F, 1'000.0F, 0.0F ) };
+
+    auto unplaced = vor::DopplerVor{ { } };
+    EXPECT_FALSE( unplaced.process( composite ) );
+
+    auto odd = vor::DopplerVor{ { .element_count = 47 } };
+    odd.set_receivers( receiver );
+    EXPECT_FALSE( odd.process( composite ) );
+}
+
+} // namespace
+} // namespace ltb
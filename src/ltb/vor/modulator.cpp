@@ -0,0 +1,109 @@
+#include "ltb/vor/modulator.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+#include "ltb/vor/constants.hpp"
+
+// standard
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace ltb::vor
+{
+namespace
+{
+
+using Consts = Constants< float64 >;
+
+} // namespace
+
+Modulator::Modulator( ModulatorParams params )
+    : params_( params )
+{
+    auto const step = 1.0 / params_.sample_rate_hz;
+    navigation_ = dsp::Oscillator{ Consts::navigation_frequency_hz( ), params_.start_time_s, step };
+    subcarrier_ = dsp::Oscillator{ Consts::subcarrier_frequency_hz( ), params_.start_time_s, step };
+    set_bearing( params_.bearing_rad );
+}
+
+auto Modulator::params( ) const -> ModulatorParams const&
+{
+    return params_;
+}
+
+auto Modulator::set_bearing( float32 const bearing_rad ) -> void
+{
+    params_.bearing_rad = bearing_rad;
+
+    auto const bearing = static_cast< float64 >( bearing_rad );
+    bearing_           = { std::cos( bearing ), std::sin( bearing ) };
+}
+
+auto Modulator::sample_count( ) const -> std::size_t
+{
+    return sample_count_;
+}
+
+auto Modulator::process( std::span< float32 > const composite ) -> void
+{
+    constexpr auto index = Consts::subcarrier_deviation_hz( ) / Consts::navigation_frequency_hz( );
+
+    auto const variable_depth   = static_cast< float64 >( params_.variable_depth );
+    auto const subcarrier_depth = static_cast< float64 >( params_.subcarrier_depth );
+
+    for ( auto i = 0_UZ; i < composite.size( ); ++i )
+    {
+        auto const sample = sample_count_ + i;
+        if ( 0_UZ == ( sample % dsp::Oscillator::reseed_interval ) )
+        {
+            navigation_.reseed( sample );
+            subcarrier_.reseed( sample );
+        }
+
+        auto const navigation = navigation_.phasor( );
+        auto const subcarrier = subcarrier_.phasor( );
+
+        // cos(ω t - θ)
+        auto const variable = ( navigation.x * bearing_.x ) + ( navigation.y * bearing_.y );
+
+        // cos(Ω t + β sin(ω t))
+        auto const fm_phase  = index * navigation.y;
+        auto const reference = ( subcarrier.x * std::cos( fm_phase ) )
+                             - ( subcarrier.y * std::sin( fm_phase ) );
+
+        composite[ i ] = static_cast< float32 >(
+            1.0 + ( variable_depth * variable ) + ( subcarrier_depth * reference )
+        );
+
+        navigation_.advance( );
+        subcarrier_.advance( );
+    }
+
+    sample_count_ += composite.size( );
+}
+
+auto Modulator::process_iq( std::span< dsp::Iq > const iq ) -> void
+{
+    auto const start_s = params_.start_time_s
+                       + ( static_cast< float64 >( sample_count_ ) / params_.sample_rate_hz );
+    auto mixer = dsp::Mixer{ params_.carrier_offset_hz, params_.sample_rate_hz, start_s };
+
+    // The AM envelope is real, so only the carrier offset turns it.
+    auto composite = std::array< float32, 256 >{ };
+    for ( auto start = 0_UZ; start < iq.size( ); start += composite.size( ) )
+    {
+        auto const block  = iq.subspan( start, std::min( composite.size( ), iq.size( ) - start ) );
+        auto const values = std::span( composite ).first( block.size( ) );
+        process( values );
+        std::ranges::transform(
+            values,
+            block.begin( ),
+            []( float32 const value ) { return dsp::Iq( value, 0.0F ); }
+        );
+    }
+
+    mixer.process( iq );
+}
+
+} // namespace ltb::vor
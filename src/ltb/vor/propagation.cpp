@@ -0,0 +1,99 @@
+#include "ltb/vor/propagation.hpp"
+
+// project
+#include "ltb/vor/constants.hpp"
+
+// external
+#include <glm/gtc/constants.hpp>
+
+// standard
+#include <cmath>
+
+namespace ltb::vor
+{
+namespace
+{
+
+auto complex_multiply( glm::dvec2 const a, glm::dvec2 const b ) -> glm::dvec2
+{
+    return { ( a.x * b.x ) - ( a.y * b.y ), ( a.x * b.y ) + ( a.y * b.x ) };
+}
+
+/// \brief Whether the reflection from \p image reaches \p receiver, i.e. the receiver is in
+///        front of the reflector and the specular point lies inside its rectangle.
+auto reaches( glm::dvec3 const image, ils::Reflector const& reflector, glm::dvec3 const receiver )
+    -> bool
+{
+    auto const center = glm::dvec3( reflector.center_m );
+    auto const normal = glm::dvec3( reflector.normal );
+
+    auto const receiver_height = glm::dot( receiver - center, normal );
+    auto const image_height    = glm::dot( image - center, normal );
+    if ( ( receiver_height <= 0.0 ) || ( image_height >= 0.0 ) )
+    {
+        return false;
+    }
+
+    auto const t        = image_height / ( image_height - receiver_height );
+    auto const specular = image + ( ( receiver - image ) * t ) - center;
+
+    auto const tangent   = glm::dvec3( reflector.tangent );
+    auto const bitangent = glm::cross( normal, tangent );
+    return ( std::abs( glm::dot( specular, tangent ) ) <= reflector.half_size_m.x )
+        && ( std::abs( glm::dot( specular, bitangent ) ) <= reflector.half_size_m.y );
+}
+
+} // namespace
+
+auto wavenumber( float64 const frequency_hz ) -> float64
+{
+    return glm::two_pi< float64 >( ) * frequency_hz / Constants< float64 >::speed_of_light_m_s( );
+}
+
+auto path_sources( glm::vec3 const antenna_m, std::span< ils::Reflector const > const reflectors )
+    -> std::vector< PathSource >
+{
+    auto sources = std::vector< PathSource >{ { .position_m = glm::dvec3( antenna_m ) } };
+    for ( auto const& reflector : reflectors )
+    {
+        // An antenna behind the reflector cannot illuminate it.
+        if ( glm::dot( antenna_m - reflector.center_m, reflector.normal ) > 0.0F )
+        {
+            sources.push_back( {
+                .position_m  = glm::dvec3( ils::mirror( antenna_m, reflector ) ),
+                .coefficient = glm::dvec2( reflector.coefficient ),
+                .reflector   = reflector,
+            } );
+        }
+    }
+    return sources;
+}
+
+auto receive(
+    std::span< PathSource const > const sources,
+    glm::dvec3 const                    position_m,
+    float64 const                       reference_m,
+    float64 const                       wavenumber,
+    bool const                          direct_only
+) -> glm::dvec2
+{
+    auto sum = glm::dvec2( 0.0 );
+    for ( auto const& source : sources )
+    {
+        if ( source.reflector.has_value( )
+             && ( direct_only
+                  || !reaches( source.position_m, source.reflector.value( ), position_m ) ) )
+        {
+            continue;
+        }
+
+        auto const distance_m = glm::length( position_m - source.position_m );
+        auto const phase      = -wavenumber * ( distance_m - reference_m );
+        auto const path       = glm::dvec2( std::cos( phase ), std::sin( phase ) )
+                        * ( reference_m / distance_m );
+        sum += complex_multiply( source.coefficient, path );
+    }
+    return sum;
+}
+
+} // namespace ltb::vor
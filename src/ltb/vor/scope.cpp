@@ -0,0 +1,92 @@
+#include "ltb/vor/scope.hpp"
+
+// project
+#include "ltb/utils/size_utils.hpp"
+
+// standard
+#include <algorithm>
+#include <cmath>
+
+namespace ltb::vor
+{
+namespace
+{
+
+/// \brief Whole samples in \p duration_s, zero for invalid parameters.
+auto samples_in( float64 const duration_s, float64 const sample_rate_hz ) -> std::size_t
+{
+    auto const count = std::floor( duration_s * sample_rate_hz );
+    return ( count > 0.0 ) ? static_cast< std::size_t >( count ) : 0_UZ;
+}
+
+} // namespace
+
+Scope::Scope( ScopeParams params )
+    : params_( std::move( params ) )
+    , modulator_( params_.modulator )
+    , samples_( samples_in( params_.window_s, params_.modulator.sample_rate_hz ) )
+    , block_( params_.block_size )
+{
+}
+
+auto Scope::params( ) const -> ScopeParams const&
+{
+    return params_;
+}
+
+auto Scope::set_bearing( float32 const bearing_rad ) -> void
+{
+    params_.modulator.bearing_rad = bearing_rad;
+    modulator_.set_bearing( bearing_rad );
+}
+
+auto Scope::advance( float64 const elapsed_s ) -> utils::Result< std::size_t >
+{
+    LTB_CHECK_VALID( params_.modulator.sample_rate_hz > 0.0 );
+    LTB_CHECK_VALID( samples_.capacity( ) > 0_UZ, "The window holds no samples" );
+    LTB_CHECK_VALID( !block_.empty( ), "The block size must be positive" );
+    LTB_CHECK_VALID( elapsed_s >= 0.0, "Time can't run backwards" );
+
+    auto const sample_rate_hz = params_.modulator.sample_rate_hz;
+
+    // Anything older than the window would be overwritten before it is seen, so a long
+    // stall only produces one window's worth.
+    pending_s_ += elapsed_s;
+    auto const elapsed_samples = samples_in( pending_s_, sample_rate_hz );
+    pending_s_ -= static_cast< float64 >( elapsed_samples ) / sample_rate_hz;
+
+    auto const due = std::min( elapsed_samples, samples_.capacity( ) );
+
+    for ( auto produced = 0_UZ; produced < due; )
+    {
+        auto const block = std::span( block_ ).first( std::min( block_.size( ), due - produced ) );
+        modulator_.process( block );
+        samples_.overwrite( block );
+        produced += block.size( );
+    }
+
+    return due;
+}
+
+auto Scope::samples( ) const -> utils::RingBuffer< float32 > const&
+{
+    return samples_;
+}
+
+auto Scope::start_time_s( ) const -> float64
+{
+    return end_time_s( ) - ( static_cast< float64 >( samples_.size( ) ) * sample_period_s( ) );
+}
+
+auto Scope::end_time_s( ) const -> float64
+{
+    return params_.modulator.start_time_s
+         + ( static_cast< float64 >( modulator_.sample_count( ) ) * sample_period_s( ) );
+}
+
+auto Scope::sample_period_s( ) const -> float64
+{
+    return 1.0 / params_.modulator.sample_rate_hz;
+}
+
+} // namespace ltb::vor
@@ -0,0 +1,69 @@
+// project
+#include "ltb/vor/scope.hpp"
+
+// external
+#include <gtest/gtest.h>
+
+// standard
+#include <array>
+#include <vector>
+
+namespace ltb
+{
+namespace
+{
+
+TEST( ScopeTests, FramesOnlyAddTheElapsedSamples )
+{
+    auto scope = vor::Scope{ {
+        .modulator  = { .sample_rate_hz = 1'000.0, .bearing_rad = 1.0F },
+        .window_s   = 0.5,
+        .block_size = 64,
+    } };
+    EXPECT_EQ( scope.samples( ).capacity( ), 500_UZ );
+
+    // Uneven frame times; the fractions of a sample carry over.
+    auto total = 0_UZ;
+    for ( auto const frame_s : std::array{ 0.0166, 0.0171, 0.0004, 0.0157, 0.2, 0.4 } )
+    {
+        auto const produced = scope.advance( frame_s );
+        ASSERT_TRUE( produced ) << produced.error( ).debug_error_message( );
+        total += *produced;
+    }
+    EXPECT_EQ( total, 649_UZ );
+    EXPECT_NEAR( scope.end_time_s( ), 0.649, 1.0e-9 );
+    EXPECT_NEAR( scope.start_time_s( ), 0.149, 1.0e-9 );
+
+    // The ring holds exactly the newest window of one uninterrupted run.
+    auto modulator = vor::Modulator{ scope.params( ).modulator };
+    auto expected  = std::vector< float32 >( total );
+    modulator.process( expected );
+
+    auto const& samples = scope.samples( );
+    ASSERT_EQ( samples.size( ), 500_UZ );
+    for ( auto i = 0_UZ; i < samples.size( ); ++i )
+    {
+        EXPECT_EQ( samples[ i ], expected[ 149 + i ] ) << i;
+    }
+}
+
+TEST( ScopeTests, StallsOnlyCostOneWindow )
+{
+    auto scope = vor::Scope{ { .modulator = { .sample_rate_hz = 48'000.0 }, .window_s = 1.0 } };
+
+    auto const produced = scope.advance( 3'600.0 );
+    ASSERT_TRUE( produced );
+    EXPECT_EQ( *produced, 48'000_UZ );
+    EXPECT_EQ( scope.samples( ).size( ), 48'000_UZ );
+    EXPECT_NEAR( scope.end_time_s( ), 1.0, 1.0e-9 );
+}
+
+TEST( ScopeTests, RejectsInvalidParams )
+{
+    EXPECT_FALSE( vor::Scope{ { .window_s = 0.0 } }.advance( 0.1 ) );
+    EXPECT_FALSE( vor::Scope{ { .block_size = 0 } }.advance( 0.1 ) );
+    EXPECT_FALSE( vor::Scope{ { } }.advance( -0.1 ) );
+}
+
+} // namespace
+} // namespace ltb
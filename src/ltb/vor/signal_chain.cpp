@@ -0,0 +1,111 @@
+#include "ltb/vor/signal_chain.hpp"
+
+// project
+#include "ltb/utils/ignore.hpp"
+#include "ltb/utils/ring_buffer.hpp"
+#include "ltb/utils/size_utils.hpp"
+
+// standard
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+namespace ltb::vor
+{
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+auto seconds( Clock::duration const duration ) -> float64
+{
+    return std::chrono::duration_cast< std::chrono::duration< float64 > >( duration ).count( );
+}
+
+auto samples_per_s( std::size_t const samples, Clock::duration const duration ) -> float64
+{
+    auto const elapsed_s = seconds( duration );
+    return ( elapsed_s > 0.0 ) ? ( static_cast< float64 >( samples ) / elapsed_s ) : 0.0;
+}
+
+} // namespace
+
+auto run_signal_chain(
+    Modulator&                                                                      modulator,
+    BearingReceiver&                                                                receiver,
+    std::size_t const                                                               sample_count,
+    ChainParams const&                                                              params,
+    std::function< void( std::span< float32 const >, BearingOutput const& ) > const on_block
+) -> utils::Result< ChainThroughput >
+{
+    LTB_CHECK_VALID(
+        ( params.modulator_block_size > 0_UZ ) && ( params.receiver_block_size > 0_UZ )
+    );
+    LTB_CHECK_VALID(
+        modulator.params( ).sample_rate_hz == receiver.params( ).sample_rate_hz,
+        "The modulator and receiver must run at the same sample rate"
+    );
+
+    auto ring = utils::RingBuffer< float32 >{ params.modulator_block_size
+                                              + params.receiver_block_size };
+
+    auto generated      = std::vector< float32 >( params.modulator_block_size );
+    auto composite      = std::vector< float32 >( params.receiver_block_size );
+    auto bearing_rad    = std::vector< float32 >( params.receiver_block_size );
+    auto variable_depth = std::vector< float32 >( params.receiver_block_size );
+    auto deviation_hz   = std::vector< float32 >( params.receiver_block_size );
+
+    auto impairments = dsp::Impairments{ params.impairments, modulator.params( ).sample_rate_hz };
+
+    auto produced            = 0_UZ;
+    auto modulator_duration  = Clock::duration::zero( );
+    auto impairment_duration = Clock::duration::zero( );
+    auto receiver_duration   = Clock::duration::zero( );
+
+    while ( ( produced < sample_count ) || !ring.empty( ) )
+    {
+        auto const remaining = sample_count - produced;
+
+        // Fill the ring until a whole receiver block is ready or the signal ends.
+        if ( ( remaining > 0_UZ ) && ( ring.size( ) < params.receiver_block_size ) )
+        {
+            auto const count
+                = std::min( { params.modulator_block_size, remaining, ring.available( ) } );
+            auto const block = std::span( generated ).first( count );
+
+            auto const start = Clock::now( );
+            modulator.process( block );
+            auto const impaired = Clock::now( );
+            LTB_CHECK( impairments.apply( block ) );
+            modulator_duration += impaired - start;
+            impairment_duration += Clock::now( ) - impaired;
+
+            utils::ignore( ring.write( block ) );
+            produced += count;
+            continue;
+        }
+
+        auto const count  = ring.read( std::span( composite ).first( params.receiver_block_size ) );
+        auto const input  = std::span< float32 const >( composite ).first( count );
+        auto const output = BearingOutput{
+            .bearing_rad    = std::span( bearing_rad ).first( count ),
+            .variable_depth = std::span( variable_depth ).first( count ),
+            .deviation_hz   = std::span( deviation_hz ).first( count ),
+        };
+
+        auto const start = Clock::now( );
+        LTB_CHECK( receiver.process( input, output ) );
+        receiver_duration += Clock::now( ) - start;
+
+        on_block( input, output );
+    }
+
+    return ChainThroughput{
+        .sample_count             = sample_count,
+        .modulator_samples_per_s  = samples_per_s( sample_count, modulator_duration ),
+        .impairment_samples_per_s = samples_per_s( sample_count, impairment_duration ),
+        .receiver_samples_per_s   = samples_per_s( sample_count, receiver_duration ),
+    };
+}
+
+} // namespace ltb::vor